@@ -24,22 +24,45 @@
 //
 //       and edit layout.json in a text editor saving to trigger the reload
 //
+//  - with --diff, only the actors, styles and animations which changed are
+//    updated on reload, rather than the whole actor tree being rebuilt
+//       builder-run --diff layout.json
+//
 //------------------------------------------------------------------------------
 
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali-toolkit/devel-api/builder/builder.h>
+#include <dali-toolkit/devel-api/builder/json-parser.h>
 #include <dali-toolkit/devel-api/builder/tree-node.h>
 #include <dali/dali.h>
+#include <dali/devel-api/adaptor-framework/event-thread-callback.h>
 #include <dali/devel-api/adaptor-framework/file-loader.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <map>
+#include <memory>
+#include <set>
 #include <streambuf>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include <ctime>
 #include "sys/stat.h"
 
+#ifdef __linux__
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#include <cerrno>
+#define DALI_BUILDER_USE_INOTIFY 1
+#endif
+
 #include <dali/integration-api/debug.h>
 
 #define TOKEN_STRING(x) #x
@@ -74,6 +97,274 @@ std::string ReplaceQuotes(const std::string& single_quoted)
   return s;
 }
 
+/**
+ * Appends a string to the JSON, quoted and escaped.
+ */
+void AppendJsonString(const char* value, std::string& json)
+{
+  json += '"';
+  for(const char* c = value; *c; ++c)
+  {
+    if(*c == '"' || *c == '\\')
+    {
+      json += '\\';
+      json += *c;
+    }
+    else if(static_cast<unsigned char>(*c) < 0x20)
+    {
+      char escaped[8];
+      snprintf(escaped, sizeof(escaped), "\\u%04x", *c);
+      json += escaped;
+    }
+    else
+    {
+      json += *c;
+    }
+  }
+  json += '"';
+}
+
+/**
+ * Writes a parsed node back out as JSON, so that nodes can be compared and passed to the Builder.
+ */
+void SerializeJson(const TreeNode& node, std::string& json)
+{
+  switch(node.GetType())
+  {
+    case TreeNode::OBJECT:
+    case TreeNode::ARRAY:
+    {
+      const bool isObject = node.GetType() == TreeNode::OBJECT;
+      json += isObject ? '{' : '[';
+      for(TreeNode::ConstIterator iter = node.CBegin(); iter != node.CEnd(); ++iter)
+      {
+        if(iter != node.CBegin())
+        {
+          json += ',';
+        }
+        if(isObject)
+        {
+          AppendJsonString((*iter).first ? (*iter).first : "", json);
+          json += ':';
+        }
+        SerializeJson((*iter).second, json);
+      }
+      json += isObject ? '}' : ']';
+      break;
+    }
+    case TreeNode::STRING:
+    {
+      AppendJsonString(node.GetString(), json);
+      break;
+    }
+    case TreeNode::INTEGER:
+    {
+      json += std::to_string(node.GetInteger());
+      break;
+    }
+    case TreeNode::FLOAT:
+    {
+      char number[32];
+      snprintf(number, sizeof(number), "%.9g", node.GetFloat());
+      json += number;
+      break;
+    }
+    case TreeNode::BOOLEAN:
+    {
+      json += node.GetBoolean() ? "true" : "false";
+      break;
+    }
+    case TreeNode::IS_NULL:
+    {
+      json += "null";
+      break;
+    }
+  }
+}
+
+std::string SerializeJson(const TreeNode& node)
+{
+  std::string json;
+  SerializeJson(node, json);
+  return json;
+}
+
+/**
+ * Collects the names of the styles and animations referenced by an actor and its children.
+ */
+void CollectReferences(const TreeNode& node, bool isRoot, std::vector<std::string>& rootStyles, std::set<std::string>& childStyles, std::set<std::string>& animations)
+{
+  for(TreeNode::ConstIterator iter = node.CBegin(); iter != node.CEnd(); ++iter)
+  {
+    const char*     name  = (*iter).first;
+    const TreeNode& child = (*iter).second;
+    if(name && strcmp(name, "styles") == 0)
+    {
+      for(TreeNode::ConstIterator style = child.CBegin(); style != child.CEnd(); ++style)
+      {
+        if((*style).second.GetType() != TreeNode::STRING)
+        {
+          continue;
+        }
+        else if(isRoot)
+        {
+          rootStyles.push_back((*style).second.GetString());
+        }
+        else
+        {
+          childStyles.insert((*style).second.GetString());
+        }
+      }
+    }
+    else if(name && strcmp(name, "animation") == 0 && child.GetType() == TreeNode::STRING)
+    {
+      animations.insert(child.GetString());
+    }
+    else
+    {
+      // Signals & their actions can be nested anywhere, but only "actors" holds children.
+      CollectReferences(child, isRoot && !(name && strcmp(name, "actors") == 0), rootStyles, childStyles, animations);
+    }
+  }
+}
+
+/**
+ * An actor in the stage section of a script.
+ */
+struct StageEntry
+{
+  std::string              key;         ///< The actor's name, or its index in the stage section if it has none
+  std::string              json;        ///< The actor, serialized
+  std::string              structure;   ///< The parts which cannot be changed by setting properties: type, children, signals & styles
+  std::set<std::string>    properties;  ///< The names of the other keys, i.e. the properties set
+  std::vector<std::string> rootStyles;  ///< The styles applied to the actor itself, in order
+  std::set<std::string>    childStyles; ///< The styles applied to its children
+  std::set<std::string>    animations;  ///< The animations its signals (or its children's) refer to
+};
+
+/**
+ * A script broken into the parts which are compared between reloads.
+ */
+struct ParsedScript
+{
+  std::map<std::string, std::string> sections;   ///< The serialized top-level sections, except those below
+  std::map<std::string, std::string> styles;     ///< The serialized styles, by name
+  std::map<std::string, std::string> animations; ///< The serialized animations, by name
+  std::vector<StageEntry>            stage;      ///< The actors of the stage section, in order
+};
+
+/**
+ * Serializes each child of a section, by name.
+ */
+void SerializeChildren(const TreeNode& section, std::map<std::string, std::string>& children)
+{
+  for(TreeNode::ConstIterator iter = section.CBegin(); iter != section.CEnd(); ++iter)
+  {
+    children[(*iter).first ? (*iter).first : ""] = SerializeJson((*iter).second);
+  }
+}
+
+bool ParseScript(const std::string& data, ParsedScript& script)
+{
+  JsonParser parser = JsonParser::New();
+  parser.Parse(data);
+  if(parser.ParseError() || !parser.GetRoot())
+  {
+    return false;
+  }
+
+  const TreeNode& root = *parser.GetRoot();
+  for(TreeNode::ConstIterator iter = root.CBegin(); iter != root.CEnd(); ++iter)
+  {
+    const std::string name((*iter).first ? (*iter).first : "");
+    const TreeNode&   section = (*iter).second;
+    if(name == "styles")
+    {
+      SerializeChildren(section, script.styles);
+    }
+    else if(name == "animations")
+    {
+      SerializeChildren(section, script.animations);
+    }
+    else if(name != "stage")
+    {
+      script.sections[name] = SerializeJson(section);
+    }
+  }
+
+  if(const TreeNode* stage = root.Find("stage"))
+  {
+    std::set<std::string> keys;
+    unsigned int          index = 0u;
+    for(TreeNode::ConstIterator iter = stage->CBegin(); iter != stage->CEnd(); ++iter, ++index)
+    {
+      const TreeNode& actor = (*iter).second;
+      StageEntry      entry;
+
+      const TreeNode* name = actor.GetChild("name");
+      entry.key            = (name && name->GetType() == TreeNode::STRING) ? std::string("name:") + name->GetString() : std::string();
+      if(entry.key.empty() || !keys.insert(entry.key).second)
+      {
+        entry.key += "#" + std::to_string(index);
+      }
+
+      entry.json = SerializeJson(actor);
+      for(TreeNode::ConstIterator child = actor.CBegin(); child != actor.CEnd(); ++child)
+      {
+        const std::string key((*child).first ? (*child).first : "");
+        if(key == "type" || key == "actors" || key == "signals" || key == "styles")
+        {
+          entry.structure += key + "=" + SerializeJson((*child).second) + ";";
+        }
+        else
+        {
+          entry.properties.insert(key);
+        }
+      }
+      CollectReferences(actor, true, entry.rootStyles, entry.childStyles, entry.animations);
+      script.stage.push_back(entry);
+    }
+  }
+  return true;
+}
+
+/**
+ * Collects the names whose definitions differ between two sections, including those added or removed.
+ */
+std::set<std::string> FindChanges(const std::map<std::string, std::string>& before, const std::map<std::string, std::string>& after)
+{
+  std::set<std::string> changes;
+  for(const auto& definition : before)
+  {
+    auto match = after.find(definition.first);
+    if(match == after.end() || match->second != definition.second)
+    {
+      changes.insert(definition.first);
+    }
+  }
+  for(const auto& definition : after)
+  {
+    if(before.find(definition.first) == before.end())
+    {
+      changes.insert(definition.first);
+    }
+  }
+  return changes;
+}
+
+template<typename Names>
+bool Intersects(const Names& names, const std::set<std::string>& others)
+{
+  for(const std::string& name : names)
+  {
+    if(others.count(name))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
 } // namespace
 
 //------------------------------------------------------------------------------
@@ -101,6 +392,13 @@ public:
     return GetFileContents(mstringPath);
   };
 
+  /**
+   * Starts watching the file from a thread, which triggers the callback whenever the file is written or
+   * replaced (editors often save by renaming a new file over the old one).
+   * @return false if the platform cannot notify file changes, in which case FileHasChanged() has to be polled.
+   */
+  bool Watch(EventThreadCallback& changed);
+
 private:
   // compiler does
   // FileWatcher(const FileWatcher&);
@@ -109,6 +407,14 @@ private:
   std::time_t mLastTime;
   std::string mstringPath;
 
+#ifdef DALI_BUILDER_USE_INOTIFY
+  int         mInotify{-1};         ///< The inotify instance watching the file's directory
+  int         mStopPipe[2]{-1, -1}; ///< Its write end is closed on destruction to wake the watching thread
+  std::thread mThread;
+
+  void WatchLoop(std::string fileName, EventThreadCallback* changed);
+#endif
+
   std::string GetFileContents(const std::string& filename)
   {
     std::streampos     bufferSize = 0;
@@ -155,6 +461,22 @@ bool FileWatcher::FileHasChanged(void)
 
 FileWatcher::~FileWatcher()
 {
+#ifdef DALI_BUILDER_USE_INOTIFY
+  if(mThread.joinable())
+  {
+    // Closing the only write end hangs up the read end the thread polls, which wakes it without a write that could fail
+    close(mStopPipe[1]);
+    mStopPipe[1] = -1;
+    mThread.join();
+  }
+  for(int fd : {mInotify, mStopPipe[0], mStopPipe[1]})
+  {
+    if(fd >= 0)
+    {
+      close(fd);
+    }
+  }
+#endif
 }
 
 void FileWatcher::SetFilename(const std::string& fn)
@@ -167,6 +489,66 @@ std::string FileWatcher::GetFilename(void)
   return mstringPath;
 }
 
+bool FileWatcher::Watch(EventThreadCallback& changed)
+{
+#ifdef DALI_BUILDER_USE_INOTIFY
+  const size_t      separator = mstringPath.find_last_of('/');
+  const std::string directory = separator == std::string::npos ? std::string(".") : mstringPath.substr(0, separator + 1);
+  const std::string fileName  = separator == std::string::npos ? mstringPath : mstringPath.substr(separator + 1);
+
+  mInotify = inotify_init1(IN_CLOEXEC);
+  if(mInotify < 0 ||
+     inotify_add_watch(mInotify, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) < 0 ||
+     pipe2(mStopPipe, O_CLOEXEC) != 0)
+  {
+    return false;
+  }
+
+  mThread = std::thread(&FileWatcher::WatchLoop, this, fileName, &changed);
+  return true;
+#else
+  return false;
+#endif
+}
+
+#ifdef DALI_BUILDER_USE_INOTIFY
+void FileWatcher::WatchLoop(std::string fileName, EventThreadCallback* changed)
+{
+  alignas(struct inotify_event) char buffer[4096];
+  pollfd                             fds[2] = {{mInotify, POLLIN, 0}, {mStopPipe[0], POLLIN, 0}};
+  for(;;)
+  {
+    if(poll(fds, 2, -1) < 0)
+    {
+      if(errno == EINTR)
+      {
+        continue;
+      }
+      break;
+    }
+
+    if(fds[1].revents)
+    {
+      break; // Destroyed
+    }
+
+    const ssize_t length  = read(mInotify, buffer, sizeof(buffer));
+    bool          matched = false;
+    for(ssize_t offset = 0; offset < length;)
+    {
+      const inotify_event* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+      matched                    = matched || (event->len > 0 && fileName == event->name);
+      offset += sizeof(inotify_event) + event->len;
+    }
+
+    if(matched)
+    {
+      changed->Trigger();
+    }
+  }
+}
+#endif
+
 //------------------------------------------------------------------------------
 //
 //
@@ -176,7 +558,9 @@ class ExampleApp : public ConnectionTracker
 {
 public:
   ExampleApp(Application& app)
-  : mApp(app)
+  : mApp(app),
+    mIncremental(false),
+    mSceneValid(false)
   {
     app.InitSignal().Connect(this, &ExampleApp::Create);
   }
@@ -191,29 +575,59 @@ public:
     fw.SetFilename(fn);
   };
 
+  /**
+   * Only update the actors, styles & animations which changed on reload, rather than rebuilding the scene.
+   */
+  void SetIncremental(bool incremental)
+  {
+    mIncremental = incremental;
+  }
+
   void Create(Application& app)
   {
-    mTimer = Timer::New(500); // ms
-    mTimer.TickSignal().Connect(this, &ExampleApp::OnTimer);
-    mTimer.Start();
+    // Load the file now, then whenever it changes; the timer is only needed if changes cannot be notified.
+    fw.FileHasChanged();
+    OnFileChanged();
+
+    mFileChanged.reset(new EventThreadCallback(MakeCallback(this, &ExampleApp::OnFileChanged)));
+    if(!fw.Watch(*mFileChanged))
+    {
+      mTimer = Timer::New(500); // ms
+      mTimer.TickSignal().Connect(this, &ExampleApp::OnTimer);
+      mTimer.Start();
+    }
 
     // Connect to key events in order to exit
     app.GetWindow().KeyEventSignal().Connect(this, &ExampleApp::OnKeyEvent);
   }
 
 private:
+  /**
+   * An actor created from the stage section and the builder which created it, which has to outlive it
+   * for the actions of its signals.
+   */
+  struct SceneActor
+  {
+    Actor   actor;
+    Builder builder;
+  };
+
   Application& mApp;
   Layer        mRootLayer;
 
-  FileWatcher fw;
-  Timer       mTimer;
+  std::unique_ptr<EventThreadCallback> mFileChanged; ///< Declared before fw, so it outlives the watching thread
+  FileWatcher                          fw;
+  Timer                                mTimer;
 
-  void ReloadJsonFile(Builder& builder, Layer& layer)
-  {
-    Window window = mApp.GetWindow();
-    window.SetBackgroundColor(Color::WHITE);
+  bool                    mIncremental; ///< Whether only what changed is updated on reload
+  bool                    mSceneValid;  ///< Whether mScript & mScene describe what is on screen
+  std::string             mLoadedData;  ///< The contents of the file when it was last loaded
+  ParsedScript            mScript;      ///< The script last loaded
+  std::vector<SceneActor> mScene;       ///< The actors created from the stage section of mScript, in the same order
 
-    builder = Builder::New();
+  Builder CreateBuilder()
+  {
+    Builder builder = Builder::New();
     builder.QuitSignal().Connect(this, &ExampleApp::OnBuilderQuit);
 
     Property::Map defaultDirs;
@@ -222,6 +636,15 @@ private:
     defaultDirs[TOKEN_STRING(DEMO_SCRIPT_DIR)] = DEMO_SCRIPT_DIR;
 
     builder.AddConstants(defaultDirs);
+    return builder;
+  }
+
+  void ReloadJsonFile(Builder& builder, Layer& layer, const std::string& data)
+  {
+    Window window = mApp.GetWindow();
+    window.SetBackgroundColor(Color::WHITE);
+
+    builder = CreateBuilder();
 
     if(!layer)
     {
@@ -262,8 +685,6 @@ private:
       layer.Remove(layer.GetChildAt(0));
     }
 
-    std::string data(fw.GetFileContents());
-
     try
     {
       builder.LoadFromString(data);
@@ -274,13 +695,151 @@ private:
     }
 
     builder.AddActors(layer);
+
+    // Remember what each actor was created from, to compare with the next version of the file
+    mScene.clear();
+    mScript     = ParsedScript();
+    mSceneValid = mIncremental && ParseScript(data, mScript) && layer.GetChildCount() == mScript.stage.size();
+    for(unsigned int i = 0; mSceneValid && i < layer.GetChildCount(); ++i)
+    {
+      mScene.push_back(SceneActor{layer.GetChildAt(i), builder});
+    }
+  }
+
+  /**
+   * Compares the file with the script last loaded and only updates the actors which changed: those whose
+   * properties changed are updated in place, those whose type, children, signals or removed properties
+   * changed, or which use a style or animation which changed, are recreated.
+   *
+   * @return false if the scene has to be rebuilt instead, e.g. because the constants or templates changed.
+   */
+  bool UpdateScene(const std::string& data, std::string& summary)
+  {
+    ParsedScript script;
+    if(!mSceneValid || !ParseScript(data, script) || script.sections != mScript.sections)
+    {
+      return false;
+    }
+
+    Builder builder = CreateBuilder();
+    try
+    {
+      builder.LoadFromString(data);
+    }
+    catch(...)
+    {
+      return false;
+    }
+
+    const std::set<std::string> changedStyles     = FindChanges(mScript.styles, script.styles);
+    const std::set<std::string> changedAnimations = FindChanges(mScript.animations, script.animations);
+
+    std::map<std::string, size_t> previous;
+    for(size_t i = 0; i < mScript.stage.size(); ++i)
+    {
+      previous[mScript.stage[i].key] = i;
+    }
+
+    std::vector<SceneActor> scene;
+    std::vector<bool>       kept(mScene.size(), false);
+    unsigned int            created = 0;
+    unsigned int            updated = 0;
+    for(const StageEntry& entry : script.stage)
+    {
+      auto match    = previous.find(entry.key);
+      bool recreate = match == previous.end() ||
+                      Intersects(entry.childStyles, changedStyles) ||
+                      Intersects(entry.animations, changedAnimations);
+      if(!recreate)
+      {
+        const StageEntry& before = mScript.stage[match->second];
+        const bool        edited = entry.json != before.json;
+
+        // Properties can be set again, but not unset, and the rest is only applied on creation
+        recreate = edited && (entry.structure != before.structure ||
+                              !std::includes(entry.properties.begin(), entry.properties.end(), before.properties.begin(), before.properties.end()));
+        if(!recreate)
+        {
+          SceneActor sceneActor = mScene[match->second];
+          if(edited || Intersects(entry.rootStyles, changedStyles))
+          {
+            Handle handle(sceneActor.actor);
+            for(const std::string& style : entry.rootStyles)
+            {
+              builder.ApplyStyle(style, handle);
+            }
+            builder.ApplyFromJson(handle, entry.json); // The actor's own properties override its styles
+            ++updated;
+          }
+          kept[match->second] = true;
+          scene.push_back(sceneActor);
+        }
+      }
+
+      if(recreate)
+      {
+        Actor actor = Actor::DownCast(builder.CreateFromJson(entry.json));
+        if(!actor)
+        {
+          return false;
+        }
+        mRootLayer.Add(actor);
+        scene.push_back(SceneActor{actor, builder});
+        ++created;
+      }
+    }
+
+    unsigned int removed = 0;
+    for(size_t i = 0; i < mScene.size(); ++i)
+    {
+      if(!kept[i])
+      {
+        mRootLayer.Remove(mScene[i].actor);
+        ++removed;
+      }
+    }
+
+    // New actors were added on top, so restore the order of the stage section
+    for(size_t i = scene.size(); i-- > 1;)
+    {
+      scene[i - 1].actor.LowerBelow(scene[i].actor);
+    }
+
+    mBuilder = builder;
+    mScript  = std::move(script);
+    mScene   = std::move(scene);
+
+    summary = std::to_string(created) + " created, " + std::to_string(updated) + " updated, " +
+              std::to_string(removed) + " removed of " + std::to_string(mScene.size()) + " actors";
+    return true;
+  }
+
+  void OnFileChanged()
+  {
+    std::string data(fw.GetFileContents());
+    if(data == mLoadedData)
+    {
+      return; // e.g. several notifications for one save
+    }
+    mLoadedData = data;
+
+    const auto  start = std::chrono::steady_clock::now();
+    std::string summary;
+    if(!mIncremental || !UpdateScene(data, summary))
+    {
+      summary = "rebuilt";
+      ReloadJsonFile(mBuilder, mRootLayer, data);
+    }
+
+    const double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "Reloaded " << fw.GetFilename() << ": " << summary << " in " << milliseconds << " ms" << std::endl;
   }
 
   bool OnTimer(void)
   {
     if(fw.FileHasChanged())
     {
-      ReloadJsonFile(mBuilder, mRootLayer);
+      OnFileChanged();
     }
 
     return true;
@@ -316,10 +875,17 @@ int DALI_EXPORT_API main(int argc, char** argv)
   Application dali_app = Application::New(&argc, &argv, DEMO_THEME_PATH);
   ExampleApp  app(dali_app);
 
-  if(argc > 1)
+  int fileArg = 1;
+  if(argc > fileArg && std::string(argv[fileArg]) == "--diff")
+  {
+    app.SetIncremental(true);
+    ++fileArg;
+  }
+
+  if(argc > fileArg)
   {
-    std::cout << "Loading file:" << argc << " " << argv[1] << std::endl;
-    app.SetJSONFilename(argv[1]);
+    std::cout << "Loading file:" << argc << " " << argv[fileArg] << std::endl;
+    app.SetJSONFilename(argv[fileArg]);
   }
   else
   {
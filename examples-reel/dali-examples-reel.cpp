@@ -17,15 +17,26 @@
 
 // EXTERNAL INCLUDES
 #include <dali/dali.h>
+#include <dali/integration-api/debug.h>
 
 // INTERNAL INCLUDES
 #include "shared/dali-demo-strings.h"
 #include "shared/dali-table-view.h"
+#include "shared/execute-process.h"
 
 using namespace Dali;
 
 int DALI_EXPORT_API main(int argc, char** argv)
 {
+  // Read before the Application consumes its own options, and to start the time-to-first-frame clock.
+  const LauncherOptions options = LauncherOptions::FromCommandLine(argc, argv);
+
+  // Fork the zygote while there is only one thread.
+  if(options.zygote && !StartExecuteProcessZygote())
+  {
+    DALI_LOG_ERROR("Unable to start the zygote, examples will be exec'd\n");
+  }
+
   // Configure gettext for internalization
 #ifdef INTERNATIONALIZATION_ENABLED
   bindtextdomain(DALI_DEMO_DOMAIN_LOCAL, DEMO_LOCALE_DIR);
@@ -36,7 +47,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
   Application app = Application::New(&argc, &argv, DEMO_STYLE_DIR "/examples-theme.json");
 
   // Create the demo launcher
-  DaliTableView demo(app);
+  DaliTableView demo(app, options);
 
   demo.AddExample(Example("animated-images.example", DALI_DEMO_STR_TITLE_ANIMATED_IMAGES));
   demo.AddExample(Example("animated-shapes.example", DALI_DEMO_STR_TITLE_ANIMATED_SHAPES));
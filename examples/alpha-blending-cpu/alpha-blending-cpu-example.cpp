@@ -18,6 +18,8 @@
 #include <dali-toolkit/dali-toolkit.h>
 #include <cstring>
 
+#include "shared/launch-latency.h"
+
 using namespace Dali;
 
 namespace
@@ -153,6 +155,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application            application = Application::New(&argc, &argv);
   ImageViewAlphaBlendApp test(application);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
   return 0;
 }
@@ -21,6 +21,8 @@
 #include <dali/integration-api/debug.h>
 #include <iostream>
 
+#include "shared/launch-latency.h"
+
 using namespace Dali;
 using namespace Dali::Toolkit;
 
@@ -833,6 +835,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 
   CardController test(application);
 
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
 
   return 0;
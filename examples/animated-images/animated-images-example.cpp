@@ -20,6 +20,8 @@
 #include <dali-toolkit/devel-api/controls/table-view/table-view.h>
 #include <dali-toolkit/devel-api/visuals/animated-image-visual-actions-devel.h>
 
+#include "shared/launch-latency.h"
+
 using namespace Dali;
 using namespace Dali::Toolkit;
 
@@ -377,6 +379,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 
   AnimatedImageController test(application);
 
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
 
   return 0;
@@ -17,6 +17,7 @@
 
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali/dali.h>
+#include "shared/launch-latency.h"
 #include "shared/view.h"
 
 #include <sstream>
@@ -460,6 +461,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application           application = Application::New(&argc, &argv);
   AnimatedShapesExample test(application);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
   return 0;
 }
@@ -22,6 +22,8 @@
 #include <dali-toolkit/devel-api/visuals/arc-visual-properties-devel.h>
 #include <dali-toolkit/devel-api/visuals/visual-properties-devel.h>
 
+#include "shared/launch-latency.h"
+
 using namespace Dali;
 using namespace Dali::Toolkit;
 
@@ -237,6 +239,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application      application = Application::New(&argc, &argv);
   ArcVisualExample test(application);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
   return 0;
 }
@@ -17,8 +17,14 @@
 
 // EXTERNAL INCLUDES
 #include <dali-toolkit/dali-toolkit.h>
+#include <dali/devel-api/common/stage-devel.h>
+#include <chrono>
+#include <fstream>
+#include <iostream>
 
 // INTERNAL INCLUDES
+#include "shared/frame-time-recorder.h"
+#include "shared/launch-latency.h"
 #include "shared/utility.h"
 
 using namespace Dali;
@@ -181,6 +187,8 @@ bool         gNinePatch(false);
 unsigned int gRowsPerPage(25);
 unsigned int gColumnsPerPage(25);
 unsigned int gPageCount(13);
+bool         gHeadless(false);
+std::string  gReportPath;
 
 Renderer CreateRenderer(unsigned int index, Geometry geometry, Shader shader)
 {
@@ -202,7 +210,8 @@ Renderer CreateRenderer(unsigned int index, Geometry geometry, Shader shader)
 // -p NumberOfPages (Modifies the nimber of pages )
 // --use-mesh ( Use new renderer API (as ImageView) but shares renderers between actors when possible )
 // --nine-patch ( Use nine patch images )
-
+// --headless ( Render offscreen, ignore touch and write a frame-time report to stdout once the show, scroll & hide phases are done )
+// --report=FILE ( Write the JSON frame-time report to FILE instead of stdout, implies recording )
 //
 class Benchmark : public ConnectionTracker
 {
@@ -231,12 +240,21 @@ public:
 
     mSize = Vector3(windowSize.x / mColumnsPerPage, windowSize.y / mRowsPerPage, 0.0f);
 
-    // Respond to a click anywhere on the window
-    window.GetRootLayer().TouchedSignal().Connect(this, &Benchmark::OnTouch);
+    if(gHeadless)
+    {
+      // Nothing needs to be presented, so render into a frame-buffer rather than the window surface
+      RenderOffscreen(windowSize);
+    }
+    else
+    {
+      // Respond to a click anywhere on the window
+      window.GetRootLayer().TouchedSignal().Connect(this, &Benchmark::OnTouch);
+    }
 
     // Respond to key events
     window.KeyEventSignal().Connect(this, &Benchmark::OnKeyEvent);
 
+    auto creationStart = std::chrono::steady_clock::now();
     if(gUseMesh)
     {
       CreateMeshActors();
@@ -245,10 +263,97 @@ public:
     {
       CreateImageViews();
     }
+    mCreationTimeMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - creationStart).count();
+
+    if(IsRecording())
+    {
+      DevelStage::AddFrameCallback(Stage::GetCurrent(), mFrameTimeRecorder, window.GetRootLayer());
+    }
 
     ShowAnimation();
   }
 
+  /**
+   * @brief Whether frame times are being recorded for a report.
+   */
+  bool IsRecording() const
+  {
+    return gHeadless || !gReportPath.empty();
+  }
+
+  /**
+   * @brief Redirects the default render-task to an offscreen frame-buffer of the given size.
+   */
+  void RenderOffscreen(const Vector2& size)
+  {
+    const uint32_t width  = static_cast<uint32_t>(size.width);
+    const uint32_t height = static_cast<uint32_t>(size.height);
+
+    Texture     texture     = Texture::New(TextureType::TEXTURE_2D, Pixel::RGB888, width, height);
+    FrameBuffer frameBuffer = FrameBuffer::New(width, height, FrameBuffer::Attachment::NONE);
+    frameBuffer.AttachColorTexture(texture);
+    mApplication.GetWindow().GetRenderTaskList().GetTask(0u).SetFrameBuffer(frameBuffer);
+  }
+
+  /**
+   * @brief Stores the frame times recorded since the last call under the given phase name and starts recording the next phase.
+   */
+  void EndPhase(const char* phaseName)
+  {
+    if(IsRecording())
+    {
+      mPhaseFrameTimes.emplace_back(phaseName, mFrameTimeRecorder.Stop());
+      mFrameTimeRecorder.Start();
+    }
+  }
+
+  /**
+   * @brief Writes the configuration and the per-phase frame-time statistics as JSON.
+   */
+  void WriteReport()
+  {
+    std::ofstream file;
+    if(!gReportPath.empty())
+    {
+      file.open(gReportPath);
+      if(!file.is_open())
+      {
+        std::cerr << "Unable to write benchmark report to " << gReportPath << std::endl;
+      }
+    }
+    std::ostream& stream = file.is_open() ? file : std::cout;
+
+    const unsigned int actorCount = mRowsPerPage * mColumnsPerPage * mPageCount;
+    const unsigned int imageCount = !gNinePatch ? NUM_IMAGES : NUM_NINEPATCH_IMAGES;
+
+    stream << "{\n"
+           << "  \"mode\": \"" << (gUseMesh ? "mesh" : "image-view") << "\",\n"
+           << "  \"ninePatch\": " << (gNinePatch ? "true" : "false") << ",\n"
+           << "  \"rowsPerPage\": " << mRowsPerPage << ",\n"
+           << "  \"columnsPerPage\": " << mColumnsPerPage << ",\n"
+           << "  \"pageCount\": " << mPageCount << ",\n"
+           << "  \"actorCount\": " << actorCount << ",\n"
+           << "  \"rendererCount\": " << (gUseMesh ? std::min(imageCount, actorCount) : actorCount) << ",\n"
+           << "  \"creationTimeMs\": " << mCreationTimeMs << ",\n"
+           << "  \"phases\": {\n";
+
+    std::vector<float> allFrameTimes;
+    for(size_t i = 0; i < mPhaseFrameTimes.size(); ++i)
+    {
+      const auto& phase = mPhaseFrameTimes[i];
+      allFrameTimes.insert(allFrameTimes.end(), phase.second.begin(), phase.second.end());
+
+      stream << "    \"" << phase.first << "\": ";
+      DemoHelper::WriteJson(stream, DemoHelper::CalculateFrameTimeStatistics(phase.second));
+      stream << (i + 1 < mPhaseFrameTimes.size() ? ",\n" : "\n");
+    }
+
+    stream << "  },\n"
+           << "  \"total\": ";
+    DemoHelper::WriteJson(stream, DemoHelper::CalculateFrameTimeStatistics(std::move(allFrameTimes)));
+    stream << "\n}" << std::endl;
+  }
+
   bool OnTouch(Actor actor, const TouchEvent& touch)
   {
     // quit the application
@@ -306,14 +411,23 @@ public:
   {
     if(source == mShow)
     {
+      EndPhase("show");
       ScrollAnimation();
     }
     else if(source == mScroll)
     {
+      EndPhase("scroll");
       HideAnimation();
     }
     else
     {
+      if(IsRecording())
+      {
+        EndPhase("hide");
+        mFrameTimeRecorder.Stop();
+        DevelStage::RemoveFrameCallback(Stage::GetCurrent(), mFrameTimeRecorder);
+        WriteReport();
+      }
       mApplication.Quit();
     }
   }
@@ -369,6 +483,11 @@ public:
     }
     mShow.Play();
     mShow.FinishedSignal().Connect(this, &Benchmark::OnAnimationEnd);
+
+    if(IsRecording())
+    {
+      mFrameTimeRecorder.Start();
+    }
   }
 
   void ScrollAnimation()
@@ -466,6 +585,10 @@ private:
   Animation mShow;
   Animation mScroll;
   Animation mHide;
+
+  DemoHelper::FrameTimeRecorder                            mFrameTimeRecorder; ///< Records the frame times when benchmarking.
+  std::vector<std::pair<const char*, std::vector<float>>> mPhaseFrameTimes;   ///< The recorded frame times of each finished phase.
+  float                                                    mCreationTimeMs{0.0f};
 };
 
 int DALI_EXPORT_API main(int argc, char** argv)
@@ -483,6 +606,14 @@ int DALI_EXPORT_API main(int argc, char** argv)
     {
       gNinePatch = true;
     }
+    else if(arg.compare("--headless") == 0)
+    {
+      gHeadless = true;
+    }
+    else if(arg.compare(0, 9, "--report=") == 0)
+    {
+      gReportPath = arg.substr(9);
+    }
     else if(arg.compare(0, 2, "-r") == 0)
     {
       gRowsPerPage = atoi(arg.substr(2, arg.size()).c_str());
@@ -498,6 +629,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
   }
 
   Benchmark test(application);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
 
   return 0;
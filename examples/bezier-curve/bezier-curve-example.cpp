@@ -18,6 +18,7 @@
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali-toolkit/devel-api/controls/table-view/table-view.h>
 #include <dali/dali.h>
+#include "shared/launch-latency.h"
 #include "shared/view.h"
 
 #include <sstream>
@@ -612,6 +613,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
   Application application = Application::New(&argc, &argv);
 
   BezierCurveExample test(application);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
   return 0;
 }
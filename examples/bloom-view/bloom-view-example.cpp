@@ -19,6 +19,8 @@
 #include <dali-toolkit/devel-api/controls/bloom-view/bloom-view.h>
 #include <dali/dali.h>
 
+#include "shared/launch-latency.h"
+
 using namespace Dali;
 using namespace Dali::Toolkit;
 
@@ -211,6 +213,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
   Application application = Application::New(&argc, &argv);
 
   BloomExample theApp(application);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
 
   return 0;
@@ -18,6 +18,7 @@
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali-toolkit/devel-api/controls/bubble-effect/bubble-emitter.h>
 #include <dali/dali.h>
+#include "shared/launch-latency.h"
 #include "shared/utility.h"
 #include "shared/view.h"
 
@@ -304,6 +305,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application         app = Application::New(&argc, &argv, DEMO_THEME_PATH);
   BubbleEffectExample theApp(app);
+  DemoHelper::ReportLaunchLatency(app);
   app.MainLoop();
   return 0;
 }
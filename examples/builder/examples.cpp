@@ -27,12 +27,18 @@
 #include <dali-toolkit/devel-api/controls/navigation-view/navigation-view.h>
 #include <dali-toolkit/devel-api/controls/popup/popup.h>
 #include <dali/dali.h>
+#include <dali/devel-api/adaptor-framework/application-devel.h>
+#include <dali/devel-api/adaptor-framework/event-thread-callback.h>
 
 #include <dirent.h>
 #include <stdio.h>
+#include <atomic>
+#include <chrono>
+#include <deque>
 #include <fstream>
 #include <iostream>
 #include <map>
+#include <memory>
 #include <sstream>
 #include <streambuf>
 #include <string>
@@ -43,6 +49,10 @@
 
 #include <dali/devel-api/adaptor-framework/file-loader.h>
 #include <dali/integration-api/debug.h>
+#include "shared/cache-directory.h"
+#include "shared/launch-latency.h"
+#include "shared/pooled-item-factory.h"
+#include "shared/thread-pool.h"
 #include "shared/view.h"
 
 #define TOKEN_STRING(x) #x
@@ -153,6 +163,96 @@ const std::string ShortName(const std::string& name)
   }
 }
 
+typedef std::chrono::steady_clock Clock;
+
+double MillisecondsSince(Clock::time_point start)
+{
+  return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+/**
+ * The size & modification time (in nanoseconds) of a file, which tell whether it has been written since they were read.
+ */
+struct FileVersion
+{
+  uint64_t size{0u};
+  int64_t  modified{0};
+
+  bool operator==(const FileVersion& rhs) const
+  {
+    return size == rhs.size && modified == rhs.modified;
+  }
+
+  bool operator!=(const FileVersion& rhs) const
+  {
+    return !(*this == rhs);
+  }
+};
+
+FileVersion GetFileVersion(const std::string& fn)
+{
+  FileVersion version;
+  DemoHelper::GetFileSizeAndTime(fn, version.size, version.modified);
+  return version;
+}
+
+/**
+ * A script in the directory, read & validated on a worker thread at startup, then loaded into a Builder
+ * when the event thread is idle, so that opening it only has to add its actors.
+ */
+struct Script
+{
+  enum Status
+  {
+    VALID,       ///< Has a stage section with actors
+    PARSE_ERROR, ///< Is not valid JSON
+    NO_STAGE,    ///< Has no stage section
+    EMPTY_STAGE  ///< Has a stage section without actors
+  };
+
+  std::string path;                   ///< The file
+  std::string data;                   ///< Its contents when last read
+  FileVersion version;                ///< Its size & modification time when last read
+  Status      status{VALID};          ///< The result of validating it
+  std::string error;                  ///< The parse error, if any
+  double      parseMilliseconds{0.0}; ///< The time taken to read & validate it
+  double      loadMilliseconds{0.0};  ///< The time taken to load it into the builder
+  Builder     builder;                ///< Its builder, once loaded on idle; consumed when the script is opened
+};
+
+/**
+ * Reads & validates a script; runs on a worker thread.
+ */
+void ParseScript(Script& script)
+{
+  const Clock::time_point start = Clock::now();
+  script.version                = GetFileVersion(script.path);
+  script.data                   = GetFileContents(script.path);
+
+  // The parser is created & destroyed on this thread and does not touch the scene.
+  JsonParser parser = JsonParser::New();
+  parser.Parse(script.data);
+
+  if(parser.ParseError())
+  {
+    std::ostringstream error;
+    error << parser.GetErrorLineNumber() << "(" << parser.GetErrorColumn() << "):" << parser.GetErrorDescription();
+    script.status = Script::PARSE_ERROR;
+    script.error  = error.str();
+  }
+  else if(const TreeNode* node = parser.GetRoot() ? parser.GetRoot()->Find("stage") : nullptr)
+  {
+    // only those with a stage section
+    script.status = node->Size() ? Script::VALID : Script::EMPTY_STAGE;
+  }
+  else
+  {
+    script.status = Script::NO_STAGE;
+  }
+
+  script.parseMilliseconds = MillisecondsSince(start);
+}
+
 //------------------------------------------------------------------------------
 //
 //
@@ -238,11 +338,14 @@ std::string FileWatcher::GetFilename(void) const
 //
 //
 //------------------------------------------------------------------------------
-class ExampleApp : public ConnectionTracker, public Toolkit::ItemFactory
+class ExampleApp : public ConnectionTracker, public DemoHelper::PooledItemFactory
 {
 public:
   ExampleApp(Application& app)
-  : mApp(app)
+  : mApp(app),
+    mCurrentScript(0),
+    mIdleLoading(false),
+    mParsedCount(0)
   {
     app.InitSignal().Connect(this, &ExampleApp::Create);
   }
@@ -277,8 +380,6 @@ public:
     mTapDetector = TapGestureDetector::New();
     mTapDetector.DetectedSignal().Connect(this, &ExampleApp::OnTap);
 
-    mFiles.clear();
-
     mItemView = ItemView::New(*this);
 
     mItemView.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
@@ -291,7 +392,6 @@ public:
 
     mItemView.SetProperty(Actor::Property::KEYBOARD_FOCUSABLE, true);
 
-    mFiles.clear();
     FileList files;
 
     if(USER_DIRECTORY.size())
@@ -305,47 +405,19 @@ public:
 
     std::sort(files.begin(), files.end());
 
-    ItemId itemId = 0;
-    for(FileList::iterator iter = files.begin(); iter != files.end(); ++iter)
+    // Read & validate the scripts in the background; the list is filled once they all have been
+    mScriptsParsed.reset(new EventThreadCallback(MakeCallback(this, &ExampleApp::OnScriptsParsed)));
+    mParsedScripts.resize(files.size());
+    for(size_t i = 0; i < files.size(); ++i)
     {
-      JsonParser parser = JsonParser::New();
-
-      std::string data(GetFileContents(*iter));
-
-      parser.Parse(data);
-
-      if(parser.ParseError())
-      {
-        std::cout << "Parser Error:" << *iter << std::endl;
-        std::cout << parser.GetErrorLineNumber() << "(" << parser.GetErrorColumn() << "):" << parser.GetErrorDescription() << std::endl;
-        exit(1);
-      }
-
-      if(parser.GetRoot())
-      {
-        if(const TreeNode* node = parser.GetRoot()->Find("stage"))
-        {
-          // only those with a stage section
-          if(node->Size())
-          {
-            mFiles.push_back(*iter);
-
-            mItemView.InsertItem(Item(itemId,
-                                      MenuItem(ShortName(*iter))),
-                                 0.5f);
-
-            itemId++;
-          }
-          else
-          {
-            std::cout << "Ignored file (stage has no nodes?):" << *iter << std::endl;
-          }
-        }
-        else
+      mParsedScripts[i].path = files[i];
+      mParsePool.Submit([this, i]() {
+        ParseScript(mParsedScripts[i]);
+        if(++mParsedCount == mParsedScripts.size())
         {
-          std::cout << "Ignored file (no stage section):" << *iter << std::endl;
+          mScriptsParsed->Trigger();
         }
-      }
+      });
     }
 
     // Activate the layout
@@ -360,9 +432,9 @@ public:
     LoadFromFileList(id);
   }
 
-  Actor MenuItem(const std::string& text)
+  Actor CreateItem(unsigned int type) override
   {
-    TextLabel label = TextLabel::New(ShortName(text));
+    TextLabel label = TextLabel::New();
     label.SetStyleName("BuilderLabel");
     label.SetResizePolicy(ResizePolicy::FILL_TO_PARENT, Dimension::WIDTH);
 
@@ -372,21 +444,99 @@ public:
     return label;
   }
 
-  bool OnTimer()
+  /**
+   * Fills the list with the valid scripts once the worker threads have read them all, then queues them
+   * to be loaded into builders when idle.
+   */
+  void OnScriptsParsed()
   {
-    if(mFileWatcher.FileHasChanged())
+    ItemId itemId = 0;
+    for(Script& script : mParsedScripts)
+    {
+      switch(script.status)
+      {
+        case Script::VALID:
+        {
+          std::cout << "Parsed " << ShortName(script.path) << " (" << script.data.size() << " bytes) in " << script.parseMilliseconds << " ms" << std::endl;
+
+          mScripts.push_back(std::move(script));
+
+          mItemView.InsertItem(Item(itemId,
+                                    NewItem(itemId)),
+                               0.5f);
+
+          QueueLoad(itemId);
+
+          itemId++;
+          break;
+        }
+        case Script::PARSE_ERROR:
+        {
+          std::cout << "Parser Error:" << script.path << std::endl;
+          std::cout << script.error << std::endl;
+          exit(1);
+        }
+        case Script::NO_STAGE:
+        {
+          std::cout << "Ignored file (no stage section):" << script.path << std::endl;
+          break;
+        }
+        case Script::EMPTY_STAGE:
+        {
+          std::cout << "Ignored file (stage has no nodes?):" << script.path << std::endl;
+          break;
+        }
+      }
+    }
+
+    mParsedScripts.clear();
+  }
+
+  void QueueLoad(size_t index)
+  {
+    mPendingLoads.push_back(index);
+    if(!mIdleLoading)
     {
-      LoadFromFile(mFileWatcher.GetFilename());
+      mIdleLoading = DevelApplication::AddIdleWithReturnValue(mApp, MakeCallback(this, &ExampleApp::OnIdleLoad));
     }
+  }
 
-    return true;
+  /**
+   * Idle callback loading the queued scripts into builders, one at a time.
+   */
+  bool OnIdleLoad()
+  {
+    if(!mPendingLoads.empty())
+    {
+      Script& script = mScripts[mPendingLoads.front()];
+      mPendingLoads.pop_front();
+
+      if(!script.builder)
+      {
+        LoadScript(script);
+        std::cout << "Loaded " << ShortName(script.path) << " in " << script.loadMilliseconds << " ms" << std::endl;
+      }
+    }
+
+    mIdleLoading = !mPendingLoads.empty();
+    return mIdleLoading;
   }
 
-  void ReloadJsonFile(const std::string& filename, Builder& builder, Layer& layer)
+  /**
+   * Loads a script into a new builder, reading it again if it has been modified since it was last read.
+   */
+  void LoadScript(Script& script)
   {
-    Window window = mApp.GetWindow();
+    const FileVersion version = GetFileVersion(script.path);
+    if(version != script.version)
+    {
+      script.version = version;
+      script.data     = GetFileContents(script.path);
+    }
 
-    builder = Builder::New();
+    const Clock::time_point start = Clock::now();
+
+    Builder builder = Builder::New();
     builder.QuitSignal().Connect(this, &ExampleApp::OnQuitOrBack);
 
     Property::Map defaultDirs;
@@ -396,6 +546,43 @@ public:
 
     builder.AddConstants(defaultDirs);
 
+    try
+    {
+      builder.LoadFromString(script.data);
+    }
+    catch(...)
+    {
+      builder.LoadFromString(ReplaceQuotes(JSON_BROKEN));
+    }
+
+    script.builder          = builder;
+    script.loadMilliseconds = MillisecondsSince(start);
+  }
+
+  bool OnTimer()
+  {
+    if(mFileWatcher.FileHasChanged())
+    {
+      LoadFromFileList(mCurrentScript);
+    }
+
+    return true;
+  }
+
+  void ReloadJsonFile(Script& script, Builder& builder, Layer& layer)
+  {
+    Window window = mApp.GetWindow();
+
+    // Use the builder loaded when idle, unless the script has been modified since
+    const Clock::time_point start  = Clock::now();
+    const bool              cached = script.builder && GetFileVersion(script.path) == script.version;
+    if(!cached)
+    {
+      LoadScript(script);
+    }
+    builder = script.builder;
+    script.builder.Reset();
+
     // render tasks may have been setup last load so remove them
     RenderTaskList taskList = window.GetRenderTaskList();
     if(taskList.GetTaskCount() > 1)
@@ -426,41 +613,34 @@ public:
       layer.Remove(layer.GetChildAt(0));
     }
 
-    std::string data(GetFileContents(filename));
-
-    try
-    {
-      builder.LoadFromString(data);
-    }
-    catch(...)
-    {
-      builder.LoadFromString(ReplaceQuotes(JSON_BROKEN));
-    }
+    const Clock::time_point addStart = Clock::now();
 
     builder.AddActors(layer);
+
+    std::cout << "Opened " << ShortName(script.path) << ": loaded in " << script.loadMilliseconds << " ms"
+              << (cached ? " when idle" : "") << ", actors added in " << MillisecondsSince(addStart) << " ms, "
+              << MillisecondsSince(start) << " ms in total" << std::endl;
   }
 
   void LoadFromFileList(size_t index)
   {
-    if(index < mFiles.size())
+    if(index < mScripts.size())
     {
-      const std::string& name = mFiles[index];
-      mFileWatcher.SetFilename(name);
-      LoadFromFile(name);
-    }
-  }
+      Script& script = mScripts[index];
+      mCurrentScript = index;
+      mFileWatcher.SetFilename(script.path);
 
-  void LoadFromFile(const std::string& name)
-  {
-    ReloadJsonFile(name, mBuilder, mBuilderLayer);
+      ReloadJsonFile(script, mBuilder, mBuilderLayer);
+      QueueLoad(index); // So that it opens as quickly the next time
 
-    mBuilderLayer.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::BOTTOM_CENTER);
-    mBuilderLayer.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::BOTTOM_CENTER);
-    Dali::Vector3 size = mApp.GetWindow().GetRootLayer().GetCurrentProperty<Vector3>(Actor::Property::SIZE);
-    size.y -= DemoHelper::DEFAULT_VIEW_STYLE.mToolBarHeight;
-    mBuilderLayer.SetProperty(Actor::Property::SIZE, size);
+      mBuilderLayer.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::BOTTOM_CENTER);
+      mBuilderLayer.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::BOTTOM_CENTER);
+      Dali::Vector3 size = mApp.GetWindow().GetRootLayer().GetCurrentProperty<Vector3>(Actor::Property::SIZE);
+      size.y -= DemoHelper::DEFAULT_VIEW_STYLE.mToolBarHeight;
+      mBuilderLayer.SetProperty(Actor::Property::SIZE, size);
 
-    mNavigationView.Push(mBuilderLayer);
+      mNavigationView.Push(mBuilderLayer);
+    }
   }
 
   void Create(Application& app)
@@ -516,13 +696,13 @@ public:
 
   virtual unsigned int GetNumberOfItems()
   {
-    return mFiles.size();
+    return mScripts.size();
   }
 
-  virtual Actor NewItem(unsigned int itemId)
+  void BindItem(unsigned int itemId, Actor actor) override
   {
-    DALI_ASSERT_DEBUG(itemId < mFiles.size());
-    return MenuItem(ShortName(mFiles[itemId]));
+    DALI_ASSERT_DEBUG(itemId < mScripts.size());
+    actor.SetProperty(TextLabel::Property::TEXT, ShortName(mScripts[itemId].path));
   }
 
   /**
@@ -573,10 +753,19 @@ private:
   // builder
   Builder mBuilder;
 
-  FileList mFiles;
+  std::vector<Script> mScripts;       ///< The valid scripts, in the order of the list
+  size_t              mCurrentScript; ///< The script shown last
+  std::deque<size_t>  mPendingLoads;  ///< The scripts to load into builders when idle
+  bool                mIdleLoading;   ///< Whether the idle callback loading them is installed
+
+  std::vector<Script>                  mParsedScripts; ///< The scripts being read & validated by the worker threads
+  std::atomic<size_t>                  mParsedCount;   ///< The number of those done
+  std::unique_ptr<EventThreadCallback> mScriptsParsed; ///< Triggered when they all are
 
   FileWatcher mFileWatcher;
   Timer       mTimer;
+
+  DemoHelper::ThreadPool mParsePool; ///< Last, so its threads finish before the members they use are destroyed
 };
 
 //------------------------------------------------------------------------------
@@ -598,6 +787,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 
   ExampleApp dali_app(app);
 
+  DemoHelper::ReportLaunchLatency(app);
   app.MainLoop();
 
   return 0;
@@ -18,6 +18,8 @@
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali-toolkit/devel-api/controls/table-view/table-view.h>
 
+#include "shared/launch-latency.h"
+
 using namespace Dali;
 using namespace Dali::Toolkit;
 
@@ -231,6 +233,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application                   application = Application::New(&argc, &argv);
   ClippingDrawOrderVerification verification(application);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
   return 0;
 }
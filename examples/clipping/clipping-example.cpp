@@ -23,6 +23,7 @@
 // INTERNAL INCLUDES
 #include "clipping-item-factory.h"
 #include "item-view-orientation-constraint.h"
+#include "shared/launch-latency.h"
 
 using namespace Dali;
 using namespace Dali::Toolkit;
@@ -204,6 +205,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application     app = Application::New(&argc, &argv, DEMO_THEME_PATH);
   ClippingExample test(app);
+  DemoHelper::ReportLaunchLatency(app);
   app.MainLoop();
   return 0;
 }
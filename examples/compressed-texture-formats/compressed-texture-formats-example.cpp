@@ -21,6 +21,7 @@
 #include <dali/dali.h>
 
 // INTERNAL INCLUDES
+#include "shared/launch-latency.h"
 #include "shared/utility.h"
 
 using namespace Dali;
@@ -205,6 +206,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application                        application = Application::New(&argc, &argv);
   CompressedTextureFormatsController test(application);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
   return 0;
 }
@@ -25,6 +25,7 @@
 // INTERNAL INCLUDES
 #include "contact-card-layouter.h"
 #include "contact-data.h"
+#include "shared/launch-latency.h"
 
 using namespace Dali;
 using namespace Dali::Toolkit;
@@ -117,6 +118,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application           application = Application::New(&argc, &argv, THEME_PATH);
   ContactCardController contactCardController(application);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
   return 0;
 }
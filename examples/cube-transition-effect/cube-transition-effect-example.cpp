@@ -19,6 +19,7 @@
 #include <math.h>
 
 // INTERNAL INCLUDES
+#include "shared/launch-latency.h"
 #include "shared/utility.h"
 #include "shared/view.h"
 
@@ -410,6 +411,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application       application = Application::New(&argc, &argv, DEMO_THEME_PATH);
   CubeTransitionApp test(application);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
 
   return 0;
@@ -14,12 +14,18 @@
  * limitations under the License.
  *
  */
+#include <chrono>
 #include <cstring>
 #include <iostream>
+#include <memory>
 #include <random>
 #include "dali/dali.h"
+#include "dali/devel-api/common/stage-devel.h"
 #include "dali/public-api/actors/actor.h"
 #include "dali/public-api/rendering/renderer.h"
+#include "light-tiles.h"
+#include "shared/frame-time-recorder.h"
+#include "shared/launch-latency.h"
 
 using namespace Dali;
 
@@ -27,16 +33,41 @@ namespace
 {
 //=============================================================================
 // Demonstrates deferred shading with multiple render targets (for color,
-// position, and normal), a Phong lighting model and 32 point lights.
+// position, and normal), a Phong lighting model and up to 512 point lights.
+//
+// The lights are binned by screen tile on the CPU every frame; the lighting
+// pass then only iterates over the lights of the tile each pixel is in, read
+// from float textures rather than uniforms.
 //
 // Invoked with the --show-lights it will render a mesh at each light position.
+// Invoked with --lights N it will use N lights rather than 32.
+// Invoked with --light-sweep it will print the frame times for increasing
+// numbers of lights, then quit.
 //=============================================================================
 
 #define QUOTE(x) DALI_COMPOSE_SHADER(x)
 
-#define MAX_LIGHTS 32
+#define MAX_LIGHTS 512
+#define DEFAULT_LIGHT_COUNT 32
+
+#define TILE_SIZE 32
+#define MAX_LIGHTS_PER_TILE 128
+#define LIGHT_INDEX_TEXTURE_WIDTH 1024
+
+// Attenuation = radius / (CONST + LINEAR * distance + QUADRATIC * distance^2) - CUTOFF,
+// so that a light's range, beyond which it is culled, is where it reaches zero.
+#define ATTENUATION_CONST .05f
+#define ATTENUATION_LINEAR .1f
+#define ATTENUATION_QUADRATIC .15f
+#define ATTENUATION_CUTOFF .00390625f
 
-#define DEFINE_MAX_LIGHTS "const int kMaxLights = " QUOTE(MAX_LIGHTS) ";"
+#define DEFINE_TILE_SIZE "const int kTileSize = " QUOTE(TILE_SIZE) ";"
+#define DEFINE_LIGHT_INDEX_TEXTURE_WIDTH "const int kLightIndexTextureWidth = " QUOTE(LIGHT_INDEX_TEXTURE_WIDTH) ";"
+#define DEFINE_ATTENUATION                                                      \
+  "const float kAttenuationConst = " QUOTE(ATTENUATION_CONST) ";"             \
+  "const float kAttenuationLinear = " QUOTE(ATTENUATION_LINEAR) ";"           \
+  "const float kAttenuationQuadratic = " QUOTE(ATTENUATION_QUADRATIC) ";"     \
+  "const float kAttenuationCutoff = " QUOTE(ATTENUATION_CUTOFF) ";"
 
 #define DEFINE(x) "#define " DALI_COMPOSE_SHADER(x) DALI_COMPOSE_SHADER(\n)
 
@@ -127,14 +158,13 @@ void main()
 
 //=============================================================================
 const char* const MAINPASS_FSH = DALI_COMPOSE_SHADER(#version 300 es\n
-precision mediump float;\n)
-  DEFINE_MAX_LIGHTS
+precision mediump float;\n
+precision highp int;\n)
+  DEFINE_TILE_SIZE
+  DEFINE_LIGHT_INDEX_TEXTURE_WIDTH
+  DEFINE_ATTENUATION
   DALI_COMPOSE_SHADER(
 
-const float kAttenuationConst = .05f;
-const float kAttenuationLinear = .1f;
-const float kAttenuationQuadratic = .15f;
-
 // G-buffer
 uniform sampler2D uTextureNormal;
 uniform sampler2D uTexturePosition;
@@ -148,15 +178,12 @@ uniform vec3 uDepth_InvDepth_Near;\n)
   DEFINE(NEAR uDepth_InvDepth_Near.z)
   DALI_COMPOSE_SHADER(
 
-// Light source uniforms
-struct Light
-{
-  vec3 position;    // view space
-  float radius;
-  vec3 color;
-};
-
-uniform Light uLights[kMaxLights];
+// Lights: one column per light, rows are the view space position, the color and the radius.
+uniform highp sampler2D uLightData;
+// Lights in each screen tile: offset of the first index and number of indices.
+uniform highp sampler2D uTileLights;
+// Light indices of all tiles, three per texel.
+uniform highp sampler2D uLightIndices;
 
 in vec2 vUv;
 
@@ -174,20 +201,32 @@ vec3 CalculateLighting(vec3 pos, vec3 normal)
   vec3 viewDir = normalize(pos);
   vec3 viewDirRefl = -reflect(viewDir, normal);
 
+  highp vec2 tileLights = texelFetch(uTileLights, ivec2(gl_FragCoord.xy) / kTileSize, 0).xy;
+  int offset = int(tileLights.x);
+  int count = int(tileLights.y);
+
   vec3 light = vec3(0.04f); // fake ambient term
-  for (int i = 0; i < kMaxLights; ++i)
+  for (int i = offset; i < offset + count; ++i)
   {
-    vec3 rel = pos - uLights[i].position;
+    int texel = i / 3;
+    highp vec3 indices = texelFetch(uLightIndices, ivec2(texel % kLightIndexTextureWidth, texel / kLightIndexTextureWidth), 0).xyz;
+    int index = int(indices[i - texel * 3]);
+
+    highp vec3 lightPosition = texelFetch(uLightData, ivec2(index, 0), 0).xyz;
+    vec3 lightColor = texelFetch(uLightData, ivec2(index, 1), 0).xyz;
+    float lightRadius = texelFetch(uLightData, ivec2(index, 2), 0).x;
+
+    vec3 rel = pos - lightPosition;
     float distance = length(rel);
     rel /= distance;
 
-    float a = uLights[i].radius / (kAttenuationConst + kAttenuationLinear * distance +
-      kAttenuationQuadratic * distance * distance);     // attenuation
+    float a = max(0.f, lightRadius / (kAttenuationConst + kAttenuationLinear * distance +
+      kAttenuationQuadratic * distance * distance) - kAttenuationCutoff);     // attenuation
 
     float l = max(0.f, dot(normal, rel));   // lambertian
     float s = pow(max(0.f, dot(viewDirRefl, rel)), 256.f);  // specular
 
-    light += (uLights[i].color * (l + s)) * a;
+    light += (lightColor * (l + s)) * a;
   }
 
   return light;
@@ -458,27 +497,35 @@ void RegisterDepthProperties(float depth, float near, Handle& h)
   h.RegisterProperty("uDepth_InvDepth_Near", Vector3(depth, 1.f / depth, near));
 }
 
-} // namespace
-
 //=============================================================================
-/// Create a String whose size can be evaluated at compile time
-struct ConstantString
+// Distance at which the attenuated light of the given radius reaches zero.
+float CalculateLightRange(float radius)
 {
-  const char* const string;
-  const uint16_t    size;
-
-  template<uint16_t inputSize>
-  constexpr ConstantString(const char (&input)[inputSize])
-  : string(input),
-    size(inputSize)
+  // Solve radius / (const + linear * d + quadratic * d^2) = cutoff for d.
+  const float c = ATTENUATION_CONST - radius / ATTENUATION_CUTOFF;
+  if(c >= 0.f)
   {
+    return 0.f;
   }
-};
+  return (std::sqrt(ATTENUATION_LINEAR * ATTENUATION_LINEAR - 4.f * ATTENUATION_QUADRATIC * c) - ATTENUATION_LINEAR) / (2.f * ATTENUATION_QUADRATIC);
+}
+
+//=============================================================================
+PixelData CreateFloatPixelData(const float* data, uint32_t width, uint32_t height)
+{
+  const uint32_t size   = width * height * 3u * sizeof(float);
+  uint8_t*       buffer = new uint8_t[size];
+  memcpy(buffer, data, size);
+  return PixelData::New(buffer, size, width, height, Pixel::RGB32F, PixelData::ReleaseFunction::DELETE_ARRAY);
+}
+
+//=============================================================================
+const uint32_t LIGHT_SWEEP_COUNTS[] = {32u, 64u, 128u, 256u, 512u};
+const uint32_t LIGHT_SWEEP_WARM_UP_MS(1000u);
+const uint32_t LIGHT_SWEEP_STEP_MS(4000u);
+const uint32_t LIGHT_UPDATE_INTERVAL_MS(16u);
 
-constexpr ConstantString POSITION_STRING("position");
-constexpr ConstantString RADIUS_STRING("radius");
-constexpr ConstantString COLOR_STRING("color");
-constexpr uint16_t       LIGHT_SOURCE_BUFFER_SIZE(128u);
+} // namespace
 
 //=============================================================================
 class DeferredShadingExample : public ConnectionTracker
@@ -490,12 +537,14 @@ public:
     {
       NONE        = 0x0,
       SHOW_LIGHTS = 0x1,
+      LIGHT_SWEEP = 0x2,
     };
   };
 
-  DeferredShadingExample(Application& app, uint32_t options = Options::NONE)
+  DeferredShadingExample(Application& app, uint32_t options = Options::NONE, uint32_t lightCount = DEFAULT_LIGHT_COUNT)
   : mApp(app),
-    mOptions(options)
+    mOptions(options),
+    mLightCount(std::min(std::max(lightCount, 1u), static_cast<uint32_t>(MAX_LIGHTS)))
   {
     app.InitSignal().Connect(this, &DeferredShadingExample::Create);
     app.TerminateSignal().Connect(this, &DeferredShadingExample::Destroy);
@@ -512,10 +561,12 @@ private:
     Vector2 windowSize = window.GetSize();
 
     float unit = windowSize.y / 24.f;
+    mUnit      = unit;
 
     // Get camera - we'll be re-using the same old camera in the two passes.
     RenderTaskList tasks  = window.GetRenderTaskList();
     CameraActor    camera = tasks.GetTask(0).GetCameraActor();
+    mCamera               = camera;
 
     auto zCameraPos = camera.GetProperty(Actor::Property::POSITION_Z).Get<float>();
     camera.SetFarClippingPlane(zCameraPos + windowSize.y * .5f);
@@ -625,11 +676,22 @@ private:
     finalImageTextures.SetTexture(1, rttPosition);
     finalImageTextures.SetTexture(2, rttColor);
 
+    // Create the light textures: light properties, the lights in each tile and their indices.
+    mLightTiles.reset(new LightTiles(width, height, TILE_SIZE, MAX_LIGHTS_PER_TILE, LIGHT_INDEX_TEXTURE_WIDTH));
+    mLightData    = Texture::New(TextureType::TEXTURE_2D, Pixel::RGB32F, MAX_LIGHTS, 3u);
+    mTileLights   = Texture::New(TextureType::TEXTURE_2D, Pixel::RGB32F, mLightTiles->GetTileCountX(), mLightTiles->GetTileCountY());
+    mLightIndices = Texture::New(TextureType::TEXTURE_2D, Pixel::RGB32F, LIGHT_INDEX_TEXTURE_WIDTH, mLightTiles->GetIndexTextureHeight());
+    finalImageTextures.SetTexture(3, mLightData);
+    finalImageTextures.SetTexture(4, mTileLights);
+    finalImageTextures.SetTexture(5, mLightIndices);
+    UploadLightTiles(); // No lights in any tile until the first update.
+
     Sampler sampler = Sampler::New();
     sampler.SetFilterMode(FilterMode::NEAREST, FilterMode::NEAREST);
-    finalImageTextures.SetSampler(0, sampler);
-    finalImageTextures.SetSampler(1, sampler);
-    finalImageTextures.SetSampler(2, sampler);
+    for(uint32_t i = 0; i < 6; ++i)
+    {
+      finalImageTextures.SetSampler(i, sampler);
+    }
 
     Shader   shdMain            = Shader::New(MAINPASS_VSH, MAINPASS_FSH);
     Geometry finalImageGeom     = CreateTexturedQuadGeometry(true);
@@ -654,38 +716,17 @@ private:
     auto lights = Actor::New();
     CenterActor(lights);
     sceneRoot.Add(lights);
+    mLights = lights;
 
     // Create Lights
-    const bool showLights = mOptions & Options::SHOW_LIGHTS;
-    Renderer   lightRenderer;
-    if(showLights)
+    if(mOptions & Options::SHOW_LIGHTS)
     {
       Geometry lightMesh = CreateOctahedron(true);
-      lightRenderer      = CreateRenderer(noTexturesThanks, lightMesh, preShader, OPTION_DEPTH_TEST | OPTION_DEPTH_WRITE);
-      lightRenderer.SetProperty(Renderer::Property::FACE_CULLING_MODE, FaceCullingMode::FRONT);
+      mLightRenderer     = CreateRenderer(noTexturesThanks, lightMesh, preShader, OPTION_DEPTH_TEST | OPTION_DEPTH_WRITE);
+      mLightRenderer.SetProperty(Renderer::Property::FACE_CULLING_MODE, FaceCullingMode::FRONT);
     }
 
-    Vector3 lightPos{unit * 12.f, 0.f, 0.f};
-    float   theta    = M_PI * 2.f / MAX_LIGHTS;
-    float   cosTheta = std::cos(theta);
-    float   sinTheta = std::sin(theta);
-    for(int i = 0; i < MAX_LIGHTS; ++i)
-    {
-      Vector3 color = FromHueSaturationLightness(Vector3((360.f * i) / MAX_LIGHTS, .5f, 1.f));
-
-      Actor light = CreateLight(lightPos * (1 + (i % 8)) / 8.f, unit * 16.f, color, camera, finalImageRenderer);
-
-      float z  = (((i & 1) << 1) - 1) * unit * 8.f;
-      lightPos = Vector3(cosTheta * lightPos.x - sinTheta * lightPos.y, sinTheta * lightPos.x + cosTheta * lightPos.y, z);
-
-      if(showLights)
-      {
-        light.SetProperty(Actor::Property::SIZE, Vector3::ONE * unit / 8.f);
-        light.AddRenderer(lightRenderer);
-      }
-
-      lights.Add(light);
-    }
+    CreateLights(mLightCount);
 
     // Take them for a spin.
     Animation animLights = Animation::New(40.f);
@@ -693,6 +734,20 @@ private:
     animLights.AnimateBy(Property(lights, Actor::Property::ORIENTATION), Quaternion(Radian(M_PI * 2.f), Vector3::YAXIS));
     animLights.Play();
 
+    // Bin the lights as they move.
+    mLightTimer = Timer::New(LIGHT_UPDATE_INTERVAL_MS);
+    mLightTimer.TickSignal().Connect(this, &DeferredShadingExample::OnLightTimer);
+    mLightTimer.Start();
+
+    if(mOptions & Options::LIGHT_SWEEP)
+    {
+      DevelStage::AddFrameCallback(Stage::GetCurrent(), mFrameTimeRecorder, window.GetRootLayer());
+      std::cout << "lights, frames, medianMs, p95Ms, meanMs, binningMs, lightsPerTile, maxLightsPerTile" << std::endl;
+
+      mSweepStep = 0u;
+      StartSweepStep();
+    }
+
     // Event handling
     window.KeyEventSignal().Connect(this, &DeferredShadingExample::OnKeyEvent);
 
@@ -703,6 +758,13 @@ private:
 
   void Destroy(Application& app)
   {
+    mLightTimer.Stop();
+    if(mSweepTimer)
+    {
+      mSweepTimer.Stop();
+      DevelStage::RemoveFrameCallback(Stage::GetCurrent(), mFrameTimeRecorder);
+    }
+
     app.GetWindow().GetRenderTaskList().RemoveTask(mSceneRender);
     mSceneRender.Reset();
 
@@ -710,52 +772,144 @@ private:
     UnparentAndReset(mFinalImage);
   }
 
-  Actor CreateLight(Vector3 position, float radius, Vector3 color, CameraActor camera, Renderer renderer)
+  void CreateLights(uint32_t count)
+  {
+    while(mLights.GetChildCount() > 0u)
+    {
+      mLights.Remove(mLights.GetChildAt(0u));
+    }
+
+    mLightCount = count;
+    mLightPositions.resize(count);
+    mLightRanges.resize(count);
+    mViewPositions.resize(count * 3u);
+
+    // Keep the overall brightness when there are more lights, which also makes them smaller.
+    const float radius = mUnit * 16.f * std::min(1.f, static_cast<float>(DEFAULT_LIGHT_COUNT) / count);
+    const float range  = CalculateLightRange(radius);
+
+    // Colors in the first row, radii in the second.
+    std::vector<float> lightProperties(MAX_LIGHTS * 3u * 2u, 0.f);
+
+    Vector3 lightPos{mUnit * 12.f, 0.f, 0.f};
+    float   theta    = M_PI * 2.f / count;
+    float   cosTheta = std::cos(theta);
+    float   sinTheta = std::sin(theta);
+    for(uint32_t i = 0; i < count; ++i)
+    {
+      Vector3 color    = FromHueSaturationLightness(Vector3((360.f * i) / count, .5f, 1.f));
+      Vector3 position = lightPos * (1 + (i % 8)) / 8.f;
+
+      mLightPositions[i] = position;
+      mLightRanges[i]    = range;
+      memcpy(lightProperties.data() + i * 3u, color.AsFloat(), sizeof(float) * 3u);
+      lightProperties[(MAX_LIGHTS + i) * 3u] = radius;
+
+      float z  = (((i & 1) << 1) - 1) * mUnit * 8.f;
+      lightPos = Vector3(cosTheta * lightPos.x - sinTheta * lightPos.y, sinTheta * lightPos.x + cosTheta * lightPos.y, z);
+
+      if(mLightRenderer)
+      {
+        Actor light = Actor::New();
+        CenterActor(light);
+        light.SetProperty(Actor::Property::COLOR, Color::WHITE);
+        light.SetProperty(Actor::Property::POSITION, position);
+        light.SetProperty(Actor::Property::SIZE, Vector3::ONE * mUnit / 8.f);
+        light.AddRenderer(mLightRenderer);
+        mLights.Add(light);
+      }
+    }
+
+    mLightData.Upload(CreateFloatPixelData(lightProperties.data(), MAX_LIGHTS, 2u), 0u, 0u, 0u, 1u, MAX_LIGHTS, 2u);
+  }
+
+  bool OnLightTimer()
   {
-    Actor light = Actor::New();
-    CenterActor(light);
-    light.SetProperty(Actor::Property::COLOR, Color::WHITE);
-    light.SetProperty(Actor::Property::POSITION, position);
+    UpdateLightTiles();
+    return true;
+  }
 
-    auto iPropRadius     = light.RegisterProperty("radius", radius);
-    auto iPropLightColor = light.RegisterProperty("lightcolor", color);
+  // Bins the lights by screen tile, using their positions from the last frame, and uploads the result.
+  void UpdateLightTiles()
+  {
+    auto start = std::chrono::steady_clock::now();
 
-    // Create light source uniforms on lighting shader.
-    char  buffer[LIGHT_SOURCE_BUFFER_SIZE];
-    char* writep = buffer + snprintf(buffer, LIGHT_SOURCE_BUFFER_SIZE, "uLights[%d].", mNumLights);
-    ++mNumLights;
+    const Matrix lightsWorld = mLights.GetCurrentProperty<Matrix>(Actor::Property::WORLD_MATRIX);
+    const Matrix view        = mCamera.GetCurrentProperty<Matrix>(CameraActor::Property::VIEW_MATRIX);
+    const Matrix projection  = mCamera.GetCurrentProperty<Matrix>(CameraActor::Property::PROJECTION_MATRIX);
+    for(uint32_t i = 0; i < mLightCount; ++i)
+    {
+      const Vector3& position = mLightPositions[i];
+      Vector4        viewPos  = view * (lightsWorld * Vector4(position.x, position.y, position.z, 1.f));
+      memcpy(mViewPositions.data() + i * 3u, viewPos.AsFloat(), sizeof(float) * 3u);
+    }
 
-    strncpy(writep, POSITION_STRING.string, POSITION_STRING.size);
-    auto oPropLightPos = renderer.RegisterProperty(buffer, position);
+    mLightTiles->Assign(mViewPositions.data(), mLightRanges.data(), mLightCount, projection.AsFloat());
 
-    strncpy(writep, RADIUS_STRING.string, RADIUS_STRING.size);
-    auto oPropLightRadius = renderer.RegisterProperty(buffer, radius);
+    mLightData.Upload(CreateFloatPixelData(mViewPositions.data(), mLightCount, 1u), 0u, 0u, 0u, 0u, mLightCount, 1u);
+    UploadLightTiles();
 
-    strncpy(writep, COLOR_STRING.string, COLOR_STRING.size);
-    auto oPropLightColor = renderer.RegisterProperty(buffer, color);
+    if(mFrameTimeRecorder.IsRecording())
+    {
+      mBinningMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+      mBinnedIndices += mLightTiles->GetIndexCount();
+      mMaxTileLights = std::max(mMaxTileLights, mLightTiles->GetMaxTileLightCount());
+      ++mBinningCount;
+    }
+  }
 
-    // Constrain the light position, radius and color to lighting shader uniforms.
-    // Convert light position to view space;
-    Constraint cLightPos = Constraint::New<Vector3>(renderer, oPropLightPos, [](Vector3& output, const PropertyInputContainer& input) {
-      Vector4 worldPos(input[0]->GetVector3());
-      worldPos.w = 1.f;
+  void UploadLightTiles()
+  {
+    const uint32_t tileCountX = mLightTiles->GetTileCountX();
+    const uint32_t tileCountY = mLightTiles->GetTileCountY();
+    mTileLights.Upload(CreateFloatPixelData(mLightTiles->GetTileData().data(), tileCountX, tileCountY));
 
-      worldPos = input[1]->GetMatrix() * worldPos;
-      output   = Vector3(worldPos);
-    });
-    cLightPos.AddSource(Source(light, Actor::Property::WORLD_POSITION));
-    cLightPos.AddSource(Source(camera, CameraActor::Property::VIEW_MATRIX));
-    cLightPos.Apply();
+    // Only the rows in use.
+    const uint32_t rows = mLightTiles->GetIndexRowCount();
+    mLightIndices.Upload(CreateFloatPixelData(mLightTiles->GetIndexData().data(), LIGHT_INDEX_TEXTURE_WIDTH, rows), 0u, 0u, 0u, 0u, LIGHT_INDEX_TEXTURE_WIDTH, rows);
+  }
+
+  // Sets the light count for the next step of the sweep and waits for it to settle.
+  void StartSweepStep()
+  {
+    CreateLights(LIGHT_SWEEP_COUNTS[mSweepStep]);
+
+    mSweepTimer = Timer::New(LIGHT_SWEEP_WARM_UP_MS);
+    mSweepTimer.TickSignal().Connect(this, &DeferredShadingExample::OnSweepTimer);
+    mSweepTimer.Start();
+  }
+
+  bool OnSweepTimer()
+  {
+    if(!mFrameTimeRecorder.IsRecording())
+    {
+      mBinningMs     = 0.0;
+      mBinnedIndices = 0u;
+      mMaxTileLights = 0u;
+      mBinningCount  = 0u;
+      mFrameTimeRecorder.Start();
+      mSweepTimer.SetInterval(LIGHT_SWEEP_STEP_MS);
+      return true;
+    }
 
-    Constraint cLightRadius = Constraint::New<float>(renderer, oPropLightRadius, EqualToConstraint());
-    cLightRadius.AddSource(Source(light, iPropRadius));
-    cLightRadius.Apply();
+    const DemoHelper::FrameTimeStatistics statistics = DemoHelper::CalculateFrameTimeStatistics(mFrameTimeRecorder.Stop());
 
-    Constraint cLightColor = Constraint::New<Vector3>(renderer, oPropLightColor, EqualToConstraint());
-    cLightColor.AddSource(Source(light, iPropLightColor));
-    cLightColor.Apply();
+    const double tileCount = mLightTiles->GetTileCountX() * mLightTiles->GetTileCountY();
+    const double binningMs = mBinningCount ? mBinningMs / mBinningCount : 0.0;
+    const double perTile   = mBinningCount ? mBinnedIndices / (tileCount * mBinningCount) : 0.0;
+    std::cout << mLightCount << ", " << statistics.frameCount << ", " << statistics.median << ", "
+              << statistics.percentile95 << ", " << statistics.mean << ", " << binningMs << ", "
+              << perTile << ", " << mMaxTileLights << std::endl;
 
-    return light;
+    if(++mSweepStep < std::extent<decltype(LIGHT_SWEEP_COUNTS)>::value)
+    {
+      StartSweepStep();
+    }
+    else
+    {
+      mApp.Quit();
+    }
+    return false;
   }
 
   void OnPan(Actor, PanGesture const& gesture)
@@ -780,29 +934,63 @@ private:
 
   Application& mApp;
   uint32_t     mOptions;
+  uint32_t     mLightCount;
+  float        mUnit = 1.f;
 
-  Actor mSceneRoot;
-  Actor mAxis;
+  Actor       mSceneRoot;
+  Actor       mAxis;
+  Actor       mLights;
+  CameraActor mCamera;
 
   RenderTask mSceneRender;
   Actor      mFinalImage;
 
-  int mNumLights = 0;
+  // Lights, binned by screen tile whenever mLightTimer ticks.
+  std::vector<Vector3>        mLightPositions; // relative to mLights
+  std::vector<float>          mLightRanges;
+  std::vector<float>          mViewPositions;
+  std::unique_ptr<LightTiles> mLightTiles;
+  Texture                     mLightData;
+  Texture                     mTileLights;
+  Texture                     mLightIndices;
+  Renderer                    mLightRenderer; // only with --show-lights
+  Timer                       mLightTimer;
+
+  // --light-sweep
+  DemoHelper::FrameTimeRecorder mFrameTimeRecorder;
+  Timer                         mSweepTimer;
+  uint32_t                      mSweepStep = 0u;
+  double                        mBinningMs = 0.0;
+  uint64_t                      mBinnedIndices = 0u;
+  uint32_t                      mMaxTileLights = 0u;
+  uint32_t                      mBinningCount = 0u;
 
   PanGestureDetector mPanDetector;
 };
 
-int main(int argc, char** argv)
+int DALI_EXPORT_API main(int argc, char** argv)
 {
-  const bool showLights = [](int argc, char** argv) {
-    auto endArgs = argv + argc;
-    return std::find_if(argv, endArgs, [](const char* arg) {
-             return strcmp(arg, "--show-lights") == 0;
-           }) != endArgs;
-  }(argc, argv);
+  uint32_t options    = DeferredShadingExample::Options::NONE;
+  uint32_t lightCount = DEFAULT_LIGHT_COUNT;
+  for(int i = 1; i < argc; ++i)
+  {
+    if(strcmp(argv[i], "--show-lights") == 0)
+    {
+      options |= DeferredShadingExample::Options::SHOW_LIGHTS;
+    }
+    else if(strcmp(argv[i], "--light-sweep") == 0)
+    {
+      options |= DeferredShadingExample::Options::LIGHT_SWEEP;
+    }
+    else if(strcmp(argv[i], "--lights") == 0 && i + 1 < argc)
+    {
+      lightCount = static_cast<uint32_t>(atoi(argv[++i]));
+    }
+  }
 
   Application            app = Application::New(&argc, &argv);
-  DeferredShadingExample example(app, (showLights ? DeferredShadingExample::Options::SHOW_LIGHTS : 0));
+  DeferredShadingExample example(app, options, lightCount);
+  DemoHelper::ReportLaunchLatency(app);
   app.MainLoop();
   return 0;
 }
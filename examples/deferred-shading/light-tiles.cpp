@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// HEADER
+#include "light-tiles.h"
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+const uint32_t INDICES_PER_TEXEL = 3u;
+const float    MIN_W             = 1e-4f; // Corners closer to the eye plane than this make the light cover the whole screen.
+
+uint32_t DivideRoundingUp(uint32_t value, uint32_t divisor)
+{
+  return (value + divisor - 1u) / divisor;
+}
+
+} // namespace
+
+LightTiles::LightTiles(uint32_t width, uint32_t height, uint32_t tileSize, uint32_t maxLightsPerTile, uint32_t indexTextureWidth)
+: mWidth(width),
+  mHeight(height),
+  mTileSize(tileSize),
+  mTileCountX(DivideRoundingUp(width, tileSize)),
+  mTileCountY(DivideRoundingUp(height, tileSize)),
+  mMaxLightsPerTile(maxLightsPerTile),
+  mIndexTextureWidth(indexTextureWidth),
+  mTileCounts(mTileCountX * mTileCountY),
+  mTileData(mTileCountX * mTileCountY * 3u),
+  mIndexData(GetIndexTextureHeight() * indexTextureWidth * INDICES_PER_TEXEL)
+{
+}
+
+uint32_t LightTiles::GetIndexTextureHeight() const
+{
+  return std::max(1u, DivideRoundingUp(mTileCountX * mTileCountY * mMaxLightsPerTile, mIndexTextureWidth * INDICES_PER_TEXEL));
+}
+
+uint32_t LightTiles::GetIndexRowCount() const
+{
+  return std::max(1u, DivideRoundingUp(mIndexCount, mIndexTextureWidth * INDICES_PER_TEXEL));
+}
+
+LightTiles::TileRect LightTiles::GetTileRect(const float* center, float range, const float* projection) const
+{
+  const TileRect none{1u, 0u, 0u, 0u};
+  const TileRect all{0u, 0u, mTileCountX - 1u, mTileCountY - 1u};
+
+  // Project the corners of the box around the sphere; its screen rectangle bounds the sphere's.
+  float minX = 1.f, minY = 1.f, maxX = -1.f, maxY = -1.f;
+  bool  behind = true;
+  bool  across = false;
+  for(uint32_t corner = 0u; corner < 8u; ++corner)
+  {
+    const float x = center[0] + ((corner & 1u) ? range : -range);
+    const float y = center[1] + ((corner & 2u) ? range : -range);
+    const float z = center[2] + ((corner & 4u) ? range : -range);
+
+    const float clipX = projection[0] * x + projection[4] * y + projection[8] * z + projection[12];
+    const float clipY = projection[1] * x + projection[5] * y + projection[9] * z + projection[13];
+    const float clipW = projection[3] * x + projection[7] * y + projection[11] * z + projection[15];
+    if(clipW < MIN_W)
+    {
+      across = true;
+      continue;
+    }
+
+    behind = false;
+    minX   = std::min(minX, clipX / clipW);
+    maxX   = std::max(maxX, clipX / clipW);
+    minY   = std::min(minY, clipY / clipW);
+    maxY   = std::max(maxY, clipY / clipW);
+  }
+
+  if(behind)
+  {
+    return none;
+  }
+  if(across)
+  {
+    return all;
+  }
+  if(maxX < -1.f || minX > 1.f || maxY < -1.f || minY > 1.f)
+  {
+    return none;
+  }
+
+  // Normalized device coordinates to tiles, y up to match gl_FragCoord.
+  auto toTile = [this](float ndc, uint32_t size, uint32_t tileCount) {
+    const float pixel = (std::min(std::max(ndc, -1.f), 1.f) * .5f + .5f) * size;
+    return std::min(static_cast<uint32_t>(pixel) / mTileSize, tileCount - 1u);
+  };
+
+  return TileRect{toTile(minX, mWidth, mTileCountX), toTile(minY, mHeight, mTileCountY), toTile(maxX, mWidth, mTileCountX), toTile(maxY, mHeight, mTileCountY)};
+}
+
+void LightTiles::Assign(const float* viewPositions, const float* ranges, uint32_t lightCount, const float* projection)
+{
+  // Count the lights in each tile, then lay the tiles' index lists out one after the other.
+  mLightRects.resize(lightCount);
+  std::fill(mTileCounts.begin(), mTileCounts.end(), 0u);
+  for(uint32_t i = 0u; i < lightCount; ++i)
+  {
+    const TileRect rect = ranges[i] > 0.f ? GetTileRect(viewPositions + i * 3u, ranges[i], projection) : TileRect{1u, 0u, 0u, 0u};
+    mLightRects[i]      = rect;
+    for(uint32_t y = rect.y0; rect.x0 <= rect.x1 && y <= rect.y1; ++y)
+    {
+      uint32_t* counts = mTileCounts.data() + y * mTileCountX;
+      for(uint32_t x = rect.x0; x <= rect.x1; ++x)
+      {
+        counts[x] = std::min(counts[x] + 1u, mMaxLightsPerTile);
+      }
+    }
+  }
+
+  uint32_t offset    = 0u;
+  mMaxTileLightCount = 0u;
+  for(uint32_t tile = 0u; tile < mTileCounts.size(); ++tile)
+  {
+    mTileData[tile * 3u]      = static_cast<float>(offset);
+    mTileData[tile * 3u + 1u] = 0.f; // Incremented as the indices are written.
+    offset += mTileCounts[tile];
+    mMaxTileLightCount = std::max(mMaxTileLightCount, mTileCounts[tile]);
+  }
+  mIndexCount = offset;
+
+  for(uint32_t i = 0u; i < lightCount; ++i)
+  {
+    const TileRect& rect = mLightRects[i];
+    for(uint32_t y = rect.y0; rect.x0 <= rect.x1 && y <= rect.y1; ++y)
+    {
+      for(uint32_t x = rect.x0; x <= rect.x1; ++x)
+      {
+        float*         tileData = mTileData.data() + (y * mTileCountX + x) * 3u;
+        const uint32_t count    = static_cast<uint32_t>(tileData[1]);
+        if(count < mTileCounts[y * mTileCountX + x])
+        {
+          mIndexData[static_cast<uint32_t>(tileData[0]) + count] = static_cast<float>(i);
+          tileData[1]                                            = static_cast<float>(count + 1u);
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,140 @@
+#ifndef DALI_DEMO_DEFERRED_SHADING_LIGHT_TILES_H
+#define DALI_DEMO_DEFERRED_SHADING_LIGHT_TILES_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Bins point lights by the screen tiles their spheres of influence overlap.
+ *
+ * The result is laid out for upload as RGB32F textures, so that the lighting shader only needs to
+ * iterate the lights of the tile a fragment falls into:
+ * - the tile texture has one texel per tile holding the offset of its first light index and the number of indices;
+ * - the index texture has GetIndexTextureWidth() texels per row, each holding three light indices.
+ */
+class LightTiles
+{
+public:
+  /**
+   * @brief Creates the tile grid.
+   * @param[in]  width             The width of the screen in pixels.
+   * @param[in]  height            The height of the screen in pixels.
+   * @param[in]  tileSize          The width & height of a tile in pixels.
+   * @param[in]  maxLightsPerTile  The number of lights a tile may hold, any more are dropped.
+   * @param[in]  indexTextureWidth The width of the index texture in texels.
+   */
+  LightTiles(uint32_t width, uint32_t height, uint32_t tileSize, uint32_t maxLightsPerTile, uint32_t indexTextureWidth);
+
+  /**
+   * @brief Assigns the lights to the tiles.
+   * @param[in]  viewPositions  The view space positions of the lights, three floats each.
+   * @param[in]  ranges         The distance beyond which each light has no effect.
+   * @param[in]  lightCount     The number of lights.
+   * @param[in]  projection     The column-major projection matrix of the camera.
+   */
+  void Assign(const float* viewPositions, const float* ranges, uint32_t lightCount, const float* projection);
+
+  uint32_t GetTileCountX() const
+  {
+    return mTileCountX;
+  }
+
+  uint32_t GetTileCountY() const
+  {
+    return mTileCountY;
+  }
+
+  /**
+   * @brief Retrieves the texels of the tile texture: offset of the first index, index count, 0.
+   */
+  const std::vector<float>& GetTileData() const
+  {
+    return mTileData;
+  }
+
+  /**
+   * @brief Retrieves the texels of the index texture, only the first GetIndexRowCount() rows are in use.
+   */
+  const std::vector<float>& GetIndexData() const
+  {
+    return mIndexData;
+  }
+
+  uint32_t GetIndexTextureWidth() const
+  {
+    return mIndexTextureWidth;
+  }
+
+  /**
+   * @brief Retrieves the number of rows of the index texture which is needed to hold all the light indices.
+   */
+  uint32_t GetIndexTextureHeight() const;
+
+  /**
+   * @brief Retrieves the number of rows of the index texture in use after the last Assign().
+   */
+  uint32_t GetIndexRowCount() const;
+
+  /**
+   * @brief Retrieves the total number of light indices in all the tiles after the last Assign().
+   */
+  uint32_t GetIndexCount() const
+  {
+    return mIndexCount;
+  }
+
+  /**
+   * @brief Retrieves the most lights any tile had after the last Assign().
+   */
+  uint32_t GetMaxTileLightCount() const
+  {
+    return mMaxTileLightCount;
+  }
+
+private:
+  struct TileRect
+  {
+    uint32_t x0, y0, x1, y1; ///< Covered tiles, inclusive; x1 < x0 if none.
+  };
+
+  /**
+   * @brief Calculates the tiles covered by the bounding box of a light's sphere of influence.
+   */
+  TileRect GetTileRect(const float* center, float range, const float* projection) const;
+
+private:
+  uint32_t mWidth;
+  uint32_t mHeight;
+  uint32_t mTileSize;
+  uint32_t mTileCountX;
+  uint32_t mTileCountY;
+  uint32_t mMaxLightsPerTile;
+  uint32_t mIndexTextureWidth;
+  uint32_t mIndexCount{0u};
+  uint32_t mMaxTileLightCount{0u};
+
+  std::vector<TileRect> mLightRects; ///< The tiles covered by each light.
+  std::vector<uint32_t> mTileCounts; ///< The number of lights in each tile.
+  std::vector<float>    mTileData;   ///< See GetTileData().
+  std::vector<float>    mIndexData;  ///< See GetIndexData().
+};
+
+#endif // DALI_DEMO_DEFERRED_SHADING_LIGHT_TILES_H
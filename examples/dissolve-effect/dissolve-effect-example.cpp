@@ -19,6 +19,7 @@
 #include <math.h>
 
 // INTERNAL INCLUDES
+#include "shared/launch-latency.h"
 #include "shared/view.h"
 
 #include <dali-toolkit/dali-toolkit.h>
@@ -438,6 +439,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application       application = Application::New(&argc, &argv, DEMO_THEME_PATH);
   DissolveEffectApp test(application);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
 
   return 0;
@@ -20,6 +20,8 @@
 #include <dali/devel-api/actors/actor-devel.h>
 #include <dali/integration-api/debug.h>
 
+#include "shared/launch-latency.h"
+
 using namespace Dali;
 using Dali::Toolkit::TextLabel;
 using namespace Dali::Toolkit;
@@ -274,6 +276,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application        application = Application::New(&argc, &argv);
   DragAndDropExample test(application);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
   return 0;
 }
@@ -16,6 +16,7 @@
  */
 
 #include <sstream>
+#include "shared/launch-latency.h"
 #include "shared/view.h"
 
 #include <dali-toolkit/dali-toolkit.h>
@@ -360,6 +361,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application          app = Application::New(&argc, &argv, DEMO_THEME_PATH);
   FlexContainerExample test(app);
+  DemoHelper::ReportLaunchLatency(app);
   app.MainLoop();
   return 0;
 }
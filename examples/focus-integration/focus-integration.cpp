@@ -17,6 +17,7 @@
 
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali-toolkit/devel-api/controls/table-view/table-view.h>
+#include "shared/launch-latency.h"
 #include "shared/view.h"
 
 using namespace Dali;
@@ -198,6 +199,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 
   FocusIntegrationExample test(application);
 
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
 
   return 0;
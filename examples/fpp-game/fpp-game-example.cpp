@@ -15,6 +15,7 @@
  *
  */
 
+#include "game-model-benchmark.h"
 #include "game-model.h"
 #include "game-renderer.h"
 #include "game-scene.h"
@@ -24,6 +25,8 @@
 
 #include <dali-toolkit/dali-toolkit.h>
 
+#include "shared/launch-latency.h"
+
 using namespace Dali;
 
 namespace
@@ -46,6 +49,9 @@ const char* SCENE_URL =
 
    GameTexture - manages textures. Loads them, creates samplers and wraps DALi TextureSet
 
+   GameResourceLoader - loads models and textures on worker threads so the scene shows up
+                        straight away, handing them to the entities as they arrive
+
    GameRenderer - binds texture and model. It's created per entity. While renderer is always unique
                   for entity, the texture and model may be reused
 
@@ -72,6 +78,9 @@ const char* SCENE_URL =
 .--------------.  .--------------.
 | GameTexture  |  |  GameModel   |
 '--------------'  '--------------'
+
+   Run with "--benchmark-model-loader [vertexCount] [iterations] [file.mod...]" to time loading
+   model files instead of showing the scene.
  */
 class GameController : public ConnectionTracker
 {
@@ -129,8 +138,33 @@ private:
 
 int DALI_EXPORT_API main(int argc, char** argv)
 {
+  if(argc > 1 && std::string(argv[1]) == "--benchmark-model-loader")
+  {
+    std::vector<unsigned int> numbers;
+    std::vector<std::string>  files;
+    for(int i = 2; i < argc; ++i)
+    {
+      if(isdigit(argv[i][0]))
+      {
+        numbers.push_back(atoi(argv[i]));
+      }
+      else
+      {
+        files.push_back(argv[i]);
+      }
+    }
+    if(files.empty())
+    {
+      files.push_back(DEMO_GAME_DIR "/tile_1.010.mod");
+    }
+    unsigned int vertexCount = numbers.size() > 0u ? numbers[0] : 1000000u;
+    unsigned int iterations  = numbers.size() > 1u ? numbers[1] : 10u;
+    return RunModelLoaderBenchmark(files, vertexCount, iterations) ? 0 : 1;
+  }
+
   Application    application = Application::New(&argc, &argv);
   GameController test(application);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
   return 0;
 }
@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+
+#include "game-model-benchmark.h"
+#include "game-model.h"
+#include "game-utils.h"
+
+#include <dali/devel-api/adaptor-framework/file-stream.h>
+
+using namespace GameUtils;
+
+namespace
+{
+typedef std::chrono::steady_clock Clock;
+
+const uint32_t MODV_TAG(0x4D4F4456);
+const uint32_t VERTEX_STRIDE(sizeof(float) * 8u);
+
+/**
+ * Stands in for the copy VertexBuffer::SetData() makes
+ */
+struct UploadBuffer
+{
+  std::vector<char> data;
+
+  bool Upload(const char* bytes, size_t size, const ModelHeader& header)
+  {
+    data.resize(header.vertexBufferSize);
+    memcpy(data.data(), bytes + header.dataBeginOffset, header.vertexBufferSize);
+    return size > 0u;
+  }
+};
+
+/**
+ * The old LoadFile(): resize() already value-initializes the buffer, std::fill() clears it again
+ */
+bool LoadZeroFilled(const char* filename, UploadBuffer& upload)
+{
+  ByteArray        bytes;
+  Dali::FileStream fileStream(filename, Dali::FileStream::READ | Dali::FileStream::BINARY);
+  FILE*            fin = fileStream.GetFile();
+  if(!fin || fseek(fin, 0, SEEK_END))
+  {
+    return false;
+  }
+  bytes.resize(ftell(fin));
+  std::fill(bytes.begin(), bytes.end(), 0);
+  if(fseek(fin, 0, SEEK_SET) || fread(bytes.data(), 1, bytes.size(), fin) != bytes.size())
+  {
+    return false;
+  }
+
+  ModelHeader header;
+  return GameModel::ReadHeader(bytes.data(), bytes.size(), header) && upload.Upload(bytes.data(), bytes.size(), header);
+}
+
+bool LoadRead(const char* filename, UploadBuffer& upload)
+{
+  ByteArray   bytes;
+  ModelHeader header;
+  return LoadFile(filename, bytes) && GameModel::ReadHeader(bytes.data(), bytes.size(), header) && upload.Upload(bytes.data(), bytes.size(), header);
+}
+
+bool LoadMapped(const char* filename, UploadBuffer& upload)
+{
+  ModelData data;
+  return GameModel::LoadData(filename, data) && upload.Upload(data.file.GetData(), data.file.GetSize(), data.header);
+}
+
+double Measure(bool (*load)(const char*, UploadBuffer&), const char* filename, unsigned int iterations, bool& success)
+{
+  UploadBuffer        upload;
+  std::vector<double> times;
+  for(unsigned int i = 0u; i < iterations; ++i)
+  {
+    Clock::time_point start = Clock::now();
+    success &= load(filename, upload);
+    times.push_back(std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+  }
+  std::sort(times.begin(), times.end());
+  return times[times.size() / 2];
+}
+
+void StoreHeader(char* out, const ModelHeader& header, bool bigEndian)
+{
+  const uint32_t* words = reinterpret_cast<const uint32_t*>(&header);
+  for(size_t i = 0u; i < sizeof(ModelHeader) / sizeof(uint32_t); ++i)
+  {
+    uint32_t word = words[i];
+    for(unsigned int byte = 0u; byte < 4u; ++byte)
+    {
+      out[i * 4u + byte] = char(word >> (bigEndian ? (24u - byte * 8u) : (byte * 8u)));
+    }
+  }
+}
+
+/**
+ * Writes a model file laid out like the exported ones: big-endian copy followed by little-endian copy
+ */
+bool WriteSyntheticModel(const std::string& filename, unsigned int vertexCount)
+{
+  const size_t halfSize = sizeof(ModelHeader) + size_t(vertexCount) * VERTEX_STRIDE;
+  ByteArray    bytes(halfSize * 2u);
+
+  for(unsigned int half = 0u; half < 2u; ++half)
+  {
+    const bool  bigEndian = (half == 0u);
+    char*       begin     = bytes.data() + half * halfSize;
+    ModelHeader header;
+    memset(&header, 0, sizeof(header));
+    header.tag              = MODV_TAG;
+    header.version          = 1u;
+    header.vertexBufferSize = vertexCount * VERTEX_STRIDE;
+    header.attributeCount   = 3u;
+    header.vertexStride     = VERTEX_STRIDE;
+    header.dataBeginOffset  = uint32_t(half * halfSize + sizeof(ModelHeader));
+    StoreHeader(begin, header, bigEndian);
+
+    float* vertices = reinterpret_cast<float*>(begin + sizeof(ModelHeader));
+    for(size_t i = 0u; i < size_t(vertexCount) * 8u; ++i)
+    {
+      vertices[i] = float(i % 1024u) * 0.01f;
+    }
+  }
+
+  FILE* file = fopen(filename.c_str(), "wb");
+  if(!file)
+  {
+    return false;
+  }
+  const bool written = fwrite(bytes.data(), 1, bytes.size(), file) == bytes.size();
+  return (fclose(file) == 0) && written;
+}
+
+} // namespace
+
+bool RunModelLoaderBenchmark(const std::vector<std::string>& files, unsigned int vertexCount, unsigned int iterations)
+{
+  std::vector<std::string> paths(files);
+  iterations = std::max(iterations, 1u);
+
+  std::string syntheticPath;
+  if(vertexCount)
+  {
+    const char* tempDir = getenv("TMPDIR");
+    syntheticPath       = std::string(tempDir ? tempDir : "/tmp") + "/fpp-game-benchmark.mod";
+    if(!WriteSyntheticModel(syntheticPath, vertexCount))
+    {
+      printf("Failed to write %s\n", syntheticPath.c_str());
+      return false;
+    }
+    paths.push_back(syntheticPath);
+  }
+
+  printf("%-50s %10s %14s %10s %10s %8s\n", "file", "KB", "zero-fill(ms)", "read(ms)", "mmap(ms)", "speedup");
+
+  bool success = true;
+  for(const std::string& path : paths)
+  {
+    // one untimed load so all the methods find the file in the page cache
+    UploadBuffer warmUp;
+    if(!LoadMapped(path.c_str(), warmUp))
+    {
+      printf("%-50s is not a valid model file\n", path.c_str());
+      success = false;
+      continue;
+    }
+
+    const double zeroFilled = Measure(LoadZeroFilled, path.c_str(), iterations, success);
+    const double read       = Measure(LoadRead, path.c_str(), iterations, success);
+    const double mapped     = Measure(LoadMapped, path.c_str(), iterations, success);
+
+    DemoHelper::MemoryMappedFile file(path);
+    printf("%-50s %10.1f %14.3f %10.3f %10.3f %7.2fx\n", path.c_str(), file.GetSize() / 1024.0, zeroFilled, read, mapped, mapped > 0.0 ? zeroFilled / mapped : 0.0);
+  }
+
+  if(!syntheticPath.empty())
+  {
+    remove(syntheticPath.c_str());
+  }
+
+  return success;
+}
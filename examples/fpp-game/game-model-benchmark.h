@@ -0,0 +1,36 @@
+#ifndef GAME_MODEL_BENCHMARK_H
+#define GAME_MODEL_BENCHMARK_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <string>
+#include <vector>
+
+/**
+ * Times loading '.mod' files the old way (a buffer that is zero-filled again after resize()), with
+ * LoadFile() (resize() only) and memory-mapped, each followed by the copy VertexBuffer::SetData() makes of the vertex data.
+ * Runs without DALi so can be started before the Application.
+ *
+ * @param[in] files Model files to load; a synthetic file is used as well if vertexCount is not 0
+ * @param[in] vertexCount Number of vertices of the synthetic model
+ * @param[in] iterations Number of times each file is loaded, the median time is reported
+ * @return true if all files loaded successfully
+ */
+bool RunModelLoaderBenchmark(const std::vector<std::string>& files, unsigned int vertexCount, unsigned int iterations);
+
+#endif
@@ -15,6 +15,8 @@
  *
  */
 
+#include <string.h>
+
 #include "game-model.h"
 #include "game-utils.h"
 
@@ -24,30 +26,74 @@ namespace
 {
 // 'MODV' tag stored in the big-endian (network) order
 const uint32_t MODV_TAG(0x4D4F4456);
+
+const uint32_t MODEL_VERSION(1u);
+const uint32_t MAX_ATTRIBUTES(16u);
+
+// aPosition, aNormal & aTexCoord, see GameModel::Create()
+const uint32_t VERTEX_STRIDE(sizeof(float) * 8u);
 } // namespace
 
 GameModel::GameModel(const char* filename)
 : mUniqueId(false),
   mIsReady(false)
 {
-  ByteArray bytes;
-  if(!LoadFile(filename, bytes))
+  ModelData data;
+  if(LoadData(filename, data))
+  {
+    Create(filename, data);
+  }
+}
+
+GameModel::GameModel(const char* filename, const ModelData& data)
+: mUniqueId(false),
+  mIsReady(false)
+{
+  Create(filename, data);
+}
+
+bool GameModel::LoadData(const char* filename, ModelData& data)
+{
+  return data.file.Open(filename) && ReadHeader(data.file.GetData(), data.file.GetSize(), data.header);
+}
+
+bool GameModel::ReadHeader(const char* bytes, size_t size, ModelHeader& header)
+{
+  if(size < sizeof(ModelHeader))
   {
-    return;
+    return false;
   }
 
-  mHeader = *(reinterpret_cast<ModelHeader*>(bytes.data()));
+  // copied out as the little-endian header is not necessarily aligned
+  memcpy(&header, bytes, sizeof(ModelHeader));
 
   // expect big-endian
-  if(MODV_TAG != mHeader.tag)
+  if(MODV_TAG != header.tag)
   {
     // jump to little-endian variant
-    mHeader = *(reinterpret_cast<ModelHeader*>(bytes.data() + bytes.size() / 2));
+    if(size - size / 2 < sizeof(ModelHeader))
+    {
+      return false;
+    }
+    memcpy(&header, bytes + size / 2, sizeof(ModelHeader));
   }
 
+  return header.tag == MODV_TAG &&
+         header.version == MODEL_VERSION &&
+         header.attributeCount <= MAX_ATTRIBUTES &&
+         header.vertexStride == VERTEX_STRIDE &&
+         header.vertexBufferSize >= header.vertexStride &&
+         uint64_t(header.dataBeginOffset) + header.vertexBufferSize <= size;
+}
+
+void GameModel::Create(const char* filename, const ModelData& data)
+{
+  mHeader = data.header;
+
   mVertexBuffer = Dali::VertexBuffer::New(Dali::Property::Map().Add("aPosition", Dali::Property::VECTOR3).Add("aNormal", Dali::Property::VECTOR3).Add("aTexCoord", Dali::Property::VECTOR2));
 
-  mVertexBuffer.SetData(bytes.data() + mHeader.dataBeginOffset, mHeader.vertexBufferSize / mHeader.vertexStride);
+  // the vertex data is ready to use, so it is uploaded straight from the mapping
+  mVertexBuffer.SetData(data.file.GetData() + mHeader.dataBeginOffset, mHeader.vertexBufferSize / mHeader.vertexStride);
 
   mGeometry = Dali::Geometry::New();
   mGeometry.AddVertexBuffer(mVertexBuffer);
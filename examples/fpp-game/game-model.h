@@ -23,6 +23,10 @@
 
 #include <inttypes.h>
 
+#include "game-utils.h"
+
+#include "shared/memory-mapped-file.h"
+
 /**
  * @brief The ModelHeader struct
  * Model file header structure
@@ -41,6 +45,17 @@ struct ModelHeader
   uint32_t dataBeginOffset;     /// start of actual vertex data
 };
 
+/**
+ * @brief The ModelData struct
+ * Model file mapped into memory, before any DALi object is created. Loading it
+ * touches no DALi handles so it may be done on a worker thread.
+ */
+struct ModelData
+{
+  DemoHelper::MemoryMappedFile file;   /// whole file, vertex data is uploaded straight from it
+  ModelHeader                  header; /// validated header matching the architecture
+};
+
 /**
  * @brief The GameModel class
  * GameModel represents model geometry. It loads model data from external model file ( .mod file ).
@@ -58,6 +73,13 @@ public:
    */
   GameModel(const char* filename);
 
+  /**
+   * Creates an instance of GameModel from already loaded model data
+   * @param[in] filename Name of the file the data was loaded from
+   * @param[in] data Model data loaded by LoadData()
+   */
+  GameModel(const char* filename, const ModelData& data);
+
   /**
    * Destroys an instance of GameModel
    */
@@ -81,6 +103,29 @@ public:
    */
   uint32_t GetUniqueId();
 
+  /**
+   * Maps the '.mod' file without creating any DALi object, may be called from any thread
+   * @param[in] filename Name of file to load
+   * @param[out] data Loaded model data
+   * @return true if the file has been loaded and its header is valid
+   */
+  static bool LoadData(const char* filename, ModelData& data);
+
+  /**
+   * Reads the header matching the architecture and checks it describes vertex data within the file
+   * @param[in] bytes Contents of the model file
+   * @param[in] size Size of the file in bytes
+   * @param[out] header Header of the model
+   * @return true if the header is valid
+   */
+  static bool ReadHeader(const char* bytes, size_t size, ModelHeader& header);
+
+private:
+  /**
+   * Creates the vertex buffer & geometry from the loaded data
+   */
+  void Create(const char* filename, const ModelData& data);
+
 private:
   Dali::Geometry     mGeometry;
   Dali::VertexBuffer mVertexBuffer;
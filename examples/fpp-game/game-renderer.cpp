@@ -75,7 +75,8 @@ void GameRenderer::SetMainTexture(GameTexture* texture)
 
 void GameRenderer::Setup()
 {
-  if(!mRenderer && mModel)
+  // wait for both, so a renderer is never shown without its texture
+  if(!mRenderer && mModel && mTexture)
   {
     Dali::Shader shader = Dali::Shader::New(VERTEX_SHADER, FRAGMENT_SHADER);
     mRenderer           = Dali::Renderer::New(mModel->GetGeometry(), shader);
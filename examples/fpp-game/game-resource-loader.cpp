@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <thread>
+
+#include "game-resource-loader.h"
+#include "game-texture.h"
+#include "game-utils.h"
+
+#include <dali/devel-api/adaptor-framework/image-loading.h>
+#include <dali/integration-api/debug.h>
+#include <dali/public-api/signals/callback.h>
+
+using namespace GameUtils;
+
+namespace
+{
+// Loading is mostly waiting on storage, more threads than this do not help
+const unsigned int MAX_LOADER_THREADS(4u);
+
+unsigned int GetLoaderThreadCount()
+{
+  return std::min(std::max(std::thread::hardware_concurrency(), 1u), MAX_LOADER_THREADS);
+}
+
+/**
+ * Finds a resource in the cache by its unique id
+ */
+template<typename T>
+T* FindResource(GameContainer<T*>& cache, uint32_t hash)
+{
+  for(typename GameContainer<T*>::Iterator iter = cache.Begin(); iter != cache.End(); ++iter)
+  {
+    if((*iter)->GetUniqueId() == hash)
+    {
+      return (*iter);
+    }
+  }
+  return NULL;
+}
+} // namespace
+
+GameResourceLoader::GameResourceLoader(ModelArray& modelCache, TextureArray& textureCache)
+: mModelCache(modelCache),
+  mTextureCache(textureCache),
+  mTriggered(false),
+  mCancelled(false),
+  mEventThreadCallback(new Dali::EventThreadCallback(Dali::MakeCallback(this, &GameResourceLoader::OnLoaded))),
+  mThreadPool(GetLoaderThreadCount())
+{
+}
+
+GameResourceLoader::~GameResourceLoader()
+{
+  // The thread pool is destroyed first, which waits for the workers; they skip whatever is still queued.
+  mCancelled = true;
+}
+
+void GameResourceLoader::LoadModel(const std::string& path, ModelCallback callback)
+{
+  uint32_t hash(HashString(path.c_str()));
+
+  if(GameModel* model = FindResource(mModelCache, hash))
+  {
+    callback(model);
+    return;
+  }
+
+  std::vector<ModelCallback>& callbacks = mModelRequests[hash];
+  callbacks.push_back(callback);
+  if(callbacks.size() == 1u)
+  {
+    Submit(path, hash, true);
+  }
+}
+
+void GameResourceLoader::LoadTexture(const std::string& path, TextureCallback callback)
+{
+  uint32_t hash(HashString(path.c_str()));
+
+  if(GameTexture* texture = FindResource(mTextureCache, hash))
+  {
+    callback(texture);
+    return;
+  }
+
+  std::vector<TextureCallback>& callbacks = mTextureRequests[hash];
+  callbacks.push_back(callback);
+  if(callbacks.size() == 1u)
+  {
+    Submit(path, hash, false);
+  }
+}
+
+size_t GameResourceLoader::GetPendingCount() const
+{
+  return mModelRequests.size() + mTextureRequests.size();
+}
+
+void GameResourceLoader::Submit(const std::string& path, uint32_t hash, bool isModel)
+{
+  std::unique_ptr<LoadedResource> resource(new LoadedResource());
+  resource->hash    = hash;
+  resource->path    = path;
+  resource->isModel = isModel;
+  resource->success = false;
+
+  mThreadPool.Submit([this, resource = std::move(resource)]() mutable { Load(std::move(resource)); });
+}
+
+void GameResourceLoader::Load(std::unique_ptr<LoadedResource> resource)
+{
+  if(mCancelled)
+  {
+    return;
+  }
+
+  if(resource->isModel)
+  {
+    resource->success = GameModel::LoadData(resource->path.c_str(), resource->modelData);
+  }
+  else
+  {
+    resource->pixelBuffer = Dali::LoadImageFromFile(resource->path);
+    resource->success     = bool(resource->pixelBuffer);
+  }
+
+  // Only trigger once per batch, whatever finishes before the event thread wakes up joins it.
+  // The resource is moved, so the worker keeps no reference to the pixel buffer.
+  bool trigger(false);
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mLoaded.push_back(std::move(resource));
+    trigger    = !mTriggered;
+    mTriggered = true;
+  }
+
+  if(trigger)
+  {
+    mEventThreadCallback->Trigger();
+  }
+}
+
+void GameResourceLoader::OnLoaded()
+{
+  std::vector<std::unique_ptr<LoadedResource>> loaded;
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    loaded.swap(mLoaded);
+    mTriggered = false;
+  }
+
+  for(std::unique_ptr<LoadedResource>& resource : loaded)
+  {
+    if(!resource->success)
+    {
+      DALI_LOG_ERROR("Failed to load %s\n", resource->path.c_str());
+    }
+
+    // The callbacks are taken out first as they may request more resources
+    if(resource->isModel)
+    {
+      std::vector<ModelCallback> callbacks;
+      callbacks.swap(mModelRequests[resource->hash]);
+      mModelRequests.erase(resource->hash);
+
+      GameModel* model(NULL);
+      if(resource->success)
+      {
+        model = new GameModel(resource->path.c_str(), resource->modelData);
+        mModelCache.PushBack(model);
+      }
+
+      for(ModelCallback& callback : callbacks)
+      {
+        callback(model);
+      }
+    }
+    else
+    {
+      std::vector<TextureCallback> callbacks;
+      callbacks.swap(mTextureRequests[resource->hash]);
+      mTextureRequests.erase(resource->hash);
+
+      GameTexture* texture(NULL);
+      if(resource->success)
+      {
+        texture = new GameTexture();
+        texture->Create(resource->path.c_str(), Dali::Devel::PixelBuffer::Convert(resource->pixelBuffer));
+        mTextureCache.PushBack(texture);
+      }
+      resource->pixelBuffer.Reset();
+
+      for(TextureCallback& callback : callbacks)
+      {
+        callback(texture);
+      }
+    }
+  }
+}
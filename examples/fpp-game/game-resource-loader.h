@@ -0,0 +1,137 @@
+#ifndef GAME_RESOURCE_LOADER_H
+#define GAME_RESOURCE_LOADER_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "game-container.h"
+#include "game-model.h"
+
+#include "shared/thread-pool.h"
+
+#include <dali/devel-api/adaptor-framework/event-thread-callback.h>
+#include <dali/devel-api/adaptor-framework/pixel-buffer.h>
+
+class GameTexture;
+
+typedef GameContainer<GameTexture*> TextureArray;
+typedef GameContainer<GameModel*>   ModelArray;
+
+/**
+ * @brief The GameResourceLoader class
+ * Loads models and textures asynchronously. Files are read and decoded on a pool of worker
+ * threads, then the finished resources are handed back to the event thread in batches, where
+ * their VertexBuffer & Texture objects are created and the requesters are notified.
+ *
+ * Resources are identified by the hash of their path: requesting a resource which is already
+ * loaded notifies the requester immediately, and requesting one which is still being loaded
+ * only adds the requester to the in-flight request.
+ */
+class GameResourceLoader
+{
+public:
+  typedef std::function<void(GameModel*)>   ModelCallback;   ///< Receives the model, NULL if it failed to load
+  typedef std::function<void(GameTexture*)> TextureCallback; ///< Receives the texture, NULL if it failed to load
+
+  /**
+   * Creates an instance of the GameResourceLoader
+   * @param[in] modelCache Cache receiving the loaded models, which it owns
+   * @param[in] textureCache Cache receiving the loaded textures, which it owns
+   */
+  GameResourceLoader(ModelArray& modelCache, TextureArray& textureCache);
+
+  /**
+   * Destroys an instance of the GameResourceLoader, cancelling any pending requests
+   */
+  ~GameResourceLoader();
+
+  /**
+   * Requests a model, the callback is called on the event thread once it has been loaded
+   * @param[in] path Path to the model file
+   * @param[in] callback Called with the model
+   */
+  void LoadModel(const std::string& path, ModelCallback callback);
+
+  /**
+   * Requests a texture, the callback is called on the event thread once it has been loaded
+   * @param[in] path Path to the texture file
+   * @param[in] callback Called with the texture
+   */
+  void LoadTexture(const std::string& path, TextureCallback callback);
+
+  /**
+   * Returns the number of requests which have not completed yet
+   * @return Number of pending requests
+   */
+  size_t GetPendingCount() const;
+
+private:
+  /**
+   * A resource loaded by a worker thread, waiting for its DALi objects to be created.
+   * It is owned by one thread at a time, so the event thread is the one releasing its pixel buffer.
+   */
+  struct LoadedResource
+  {
+    uint32_t                 hash;
+    std::string              path;
+    bool                     isModel;
+    bool                     success;
+    ModelData                modelData;
+    Dali::Devel::PixelBuffer pixelBuffer;
+  };
+
+  /**
+   * Queues the resource to be loaded by a worker thread
+   */
+  void Submit(const std::string& path, uint32_t hash, bool isModel);
+
+  /**
+   * Runs on a worker thread: loads and decodes the file, then hands the resource over to the event thread
+   */
+  void Load(std::unique_ptr<LoadedResource> resource);
+
+  /**
+   * Runs on the event thread: creates the DALi objects of the resources loaded since the last batch
+   */
+  void OnLoaded();
+
+private:
+  ModelArray&   mModelCache;
+  TextureArray& mTextureCache;
+
+  // In-flight requests by hash, only used on the event thread
+  std::map<uint32_t, std::vector<ModelCallback>>   mModelRequests;
+  std::map<uint32_t, std::vector<TextureCallback>> mTextureRequests;
+
+  std::mutex                                   mMutex;     ///< Guards mLoaded & mTriggered
+  std::vector<std::unique_ptr<LoadedResource>> mLoaded;    ///< Resources loaded but not handed back yet, owned by the event thread
+  bool                                         mTriggered; ///< Whether the event thread has been triggered for mLoaded
+  std::atomic<bool>                            mCancelled; ///< Set on destruction so the workers skip the remaining requests
+
+  std::unique_ptr<Dali::EventThreadCallback> mEventThreadCallback;
+  DemoHelper::ThreadPool                     mThreadPool; ///< Declared last so its threads are joined first
+};
+
+#endif
@@ -25,17 +25,121 @@
 #include "game-scene.h"
 #include "game-texture.h"
 
-#include "third-party/pico-json.h"
+#include "shared/json-stream-parser.h"
 
 #include <dali/dali.h>
 
 using namespace Dali;
-using namespace picojson;
 
 using std::vector;
 
 using namespace GameUtils;
 
+namespace
+{
+/**
+ * Entity as described by the scene file
+ */
+struct EntityDescription
+{
+  std::string name;
+  std::string model;
+  std::string texture;
+  float       location[3]{0.0f, 0.0f, 0.0f};
+  float       rotation[4]{0.0f, 0.0f, 0.0f, 1.0f};
+  float       scale[3]{1.0f, 1.0f, 1.0f};
+  float       size[3]{1.0f, 1.0f, 1.0f};
+  bool        hasLocation{false};
+  bool        hasRotation{false};
+  bool        hasScale{false};
+  bool        hasSize{false};
+};
+
+/**
+ * Fills the entity descriptions as the scene file is parsed, the file being
+ * a single object with one member per entity
+ */
+class SceneJsonHandler : public DemoHelper::JsonStreamHandler
+{
+public:
+  SceneJsonHandler(vector<EntityDescription>& entities)
+  : mEntities(entities)
+  {
+  }
+
+  bool OnObjectStart(const DemoHelper::JsonPath& path) override
+  {
+    if(path.GetDepth() == 1)
+    {
+      mEntities.emplace_back();
+      mEntities.back().name = path.GetKey(0);
+    }
+    return true;
+  }
+
+  bool OnNumber(const DemoHelper::JsonPath& path, double value) override
+  {
+    if(!path.Matches({"*", "*", nullptr}) || mEntities.empty())
+    {
+      return true;
+    }
+
+    EntityDescription& entity = mEntities.back();
+    const std::string& name   = path.GetKey(1);
+    const size_t       index  = path.GetIndex(2);
+    if(name == "location" && index < 3)
+    {
+      entity.location[index] = value;
+      entity.hasLocation     = true;
+    }
+    else if(name == "rotation" && index < 4)
+    {
+      entity.rotation[index] = value;
+      entity.hasRotation     = true;
+    }
+    else if(name == "scale" && index < 3)
+    {
+      entity.scale[index] = value;
+      entity.hasScale     = true;
+    }
+    else if(name == "size" && index < 3)
+    {
+      entity.size[index] = value;
+      entity.hasSize     = true;
+    }
+    return true;
+  }
+
+  bool OnString(const DemoHelper::JsonPath& path, const std::string& value) override
+  {
+    if(path.Matches({"*", "model"}) && !mEntities.empty())
+    {
+      mEntities.back().model = value;
+    }
+    else if(path.Matches({"*", "texture"}) && !mEntities.empty())
+    {
+      mEntities.back().texture = value;
+    }
+    return true;
+  }
+
+private:
+  vector<EntityDescription>& mEntities;
+};
+
+/**
+ * Returns the full path of a resource referenced by the scene file
+ */
+std::string GetResourcePath(const std::string& filename)
+{
+  std::string path(DEMO_GAME_DIR);
+  path += "/";
+  path += filename;
+  return path;
+}
+
+} // namespace
+
 GameScene::GameScene()
 {
 }
@@ -52,93 +156,73 @@ bool GameScene::Load(Window window, const char* filename)
     return false;
   }
 
-  // add EOL
-  bytes.push_back('\0');
+  // parse straight into the descriptions, without building a json tree
+  vector<EntityDescription> descriptions;
+  SceneJsonHandler          handler(descriptions);
+  if(!DemoHelper::ParseJsonStream(bytes.data(), bytes.data() + bytes.size(), handler).empty())
+  {
+    return false;
+  }
 
-  picojson::value root;
-  picojson::parse(root, bytes.data());
+  // created here rather than in the constructor as it needs the adaptor to be running
+  if(!mResourceLoader)
+  {
+    mResourceLoader.reset(new GameResourceLoader(mModelCache, mTextureCache));
+  }
 
   bool failed(false);
 
-  if(root.is<object>())
+  for(const EntityDescription& description : descriptions)
   {
-    object rootObject = root.get<object>();
-    for(object::iterator it = rootObject.begin(); it != rootObject.end(); ++it)
-    {
-      std::string entityName((*it).first);
-
-      GameEntity* entity = new GameEntity(entityName.c_str());
-      mEntities.PushBack(entity);
+    GameEntity* entity = new GameEntity(description.name.c_str());
+    mEntities.PushBack(entity);
 
-      value& val((*it).second);
-      value& vLocation = val.get("location");
-      value& vRotation = val.get("rotation");
-      value& vScale    = val.get("scale");
-      value& vSize     = val.get("size");
-      value& vModel    = val.get("model");
-      value& vTexture  = val.get("texture");
-
-      if(!vLocation.is<null>())
-      {
-        array& location = vLocation.get<array>();
-        entity->SetLocation(Vector3(
-          location.at(0).get<double>(),
-          location.at(1).get<double>(),
-          location.at(2).get<double>()));
-      }
-
-      if(!vRotation.is<null>())
-      {
-        array& rotation = vRotation.get<array>();
-        entity->SetRotation(Quaternion(Vector4(
-          -rotation.at(0).get<double>(),
-          rotation.at(1).get<double>(),
-          -rotation.at(2).get<double>(),
-          rotation.at(3).get<double>())));
-      }
+    if(description.hasLocation)
+    {
+      const float* location = description.location;
+      entity->SetLocation(Vector3(location[0], location[1], location[2]));
+    }
 
-      if(!vScale.is<null>())
-      {
-        array& scale = vScale.get<array>();
-        entity->SetScale(Vector3(
-          scale.at(0).get<double>(),
-          scale.at(1).get<double>(),
-          scale.at(2).get<double>()));
-      }
+    if(description.hasRotation)
+    {
+      const float* rotation = description.rotation;
+      entity->SetRotation(Quaternion(Vector4(-rotation[0], rotation[1], -rotation[2], rotation[3])));
+    }
 
-      if(!vSize.is<null>())
-      {
-        array& size = vSize.get<array>();
-        entity->SetSize(Vector3(
-          size.at(0).get<double>(),
-          size.at(1).get<double>(),
-          size.at(2).get<double>()));
-      }
+    if(description.hasScale)
+    {
+      const float* scale = description.scale;
+      entity->SetScale(Vector3(scale[0], scale[1], scale[2]));
+    }
 
-      GameModel*   model(NULL);
-      GameTexture* texture(NULL);
+    if(description.hasSize)
+    {
+      const float* size = description.size;
+      entity->SetSize(Vector3(size[0], size[1], size[2]));
+    }
 
-      if(!vModel.is<null>())
-      {
-        std::string& strModel = vModel.get<std::string>();
-        model                 = GetResource(strModel.c_str(), mModelCache);
-      }
+    if(description.model.empty() || description.texture.empty())
+    {
+      failed = true;
+      break;
+    }
 
-      if(!vTexture.is<null>())
+    // renderer is set up as soon as both model and texture have been loaded
+    mResourceLoader->LoadModel(GetResourcePath(description.model), [entity](GameModel* model) {
+      if(model)
       {
-        std::string& strTexture = vTexture.get<std::string>();
-        texture                 = GetResource(strTexture.c_str(), mTextureCache);
+        entity->GetGameRenderer().SetModel(model);
+        entity->UpdateRenderer();
       }
+    });
 
-      if(!model || !texture)
+    mResourceLoader->LoadTexture(GetResourcePath(description.texture), [entity](GameTexture* texture) {
+      if(texture)
       {
-        failed = true;
-        break;
+        entity->GetGameRenderer().SetMainTexture(texture);
+        entity->UpdateRenderer();
       }
-
-      entity->GetGameRenderer().SetModel(model);
-      entity->GetGameRenderer().SetMainTexture(texture);
-    }
+    });
   }
 
   if(failed)
@@ -169,6 +253,11 @@ bool GameScene::Load(Window window, const char* filename)
   return true;
 }
 
+bool GameScene::IsLoadingResources() const
+{
+  return mResourceLoader && mResourceLoader->GetPendingCount() > 0u;
+}
+
 Dali::Actor& GameScene::GetRootActor()
 {
   return mRootActor;
@@ -20,10 +20,12 @@
 
 #include <inttypes.h>
 #include <stdint.h>
+#include <memory>
 #include <vector>
 
 #include "game-camera.h"
 #include "game-container.h"
+#include "game-resource-loader.h"
 #include "game-utils.h"
 
 #include <dali/public-api/actors/actor.h>
@@ -37,9 +39,7 @@ class GameModel;
 /**
  * Container based types owning heap allocated data of specifed types
  */
-typedef GameContainer<GameEntity*>  EntityArray;
-typedef GameContainer<GameTexture*> TextureArray;
-typedef GameContainer<GameModel*>   ModelArray;
+typedef GameContainer<GameEntity*> EntityArray;
 
 class GameScene
 {
@@ -57,6 +57,9 @@ public:
   /**
    * Loads scene from formatted JSON file, returns true on success
    *
+   * The entities are created straight away, while their models and textures are
+   * loaded in the background; each entity starts rendering once both have arrived.
+   *
    * @param[in] window The window to load the scene on
    * @param[in] filename Path to the scene file
    * @return true if suceess
@@ -64,13 +67,10 @@ public:
   bool Load(Dali::Window window, const char* filename);
 
   /**
-   * Loads resource ( model or texture ) or gets if from cache if already loaded
-   * @param[in] filename Path to the resource file
-   * @param[in] cache Reference to the cache array to be used
-   * @return Pointer to the resource or NULL otherwise
+   * Checks whether resources of the scene are still being loaded
+   * @return true if any model or texture has not arrived yet
    */
-  template<typename T>
-  T* GetResource(const char* filename, GameContainer<T*>& cache);
+  bool IsLoadingResources() const;
 
   /**
    * Returns scene root actor
@@ -87,35 +87,9 @@ private:
   TextureArray mTextureCache;
 
   Dali::Actor mRootActor;
-};
 
-template<typename T>
-T* GameScene::GetResource(const char* filename, GameContainer<T*>& cache)
-{
-  std::string path(DEMO_GAME_DIR);
-  path += "/";
-  path += filename;
-
-  uint32_t hash(GameUtils::HashString(path.c_str()));
-
-  for(typename GameContainer<T*>::Iterator iter = cache.Begin(); iter != cache.End(); ++iter)
-  {
-    if((*iter)->GetUniqueId() == hash)
-    {
-      return (*iter);
-    }
-  }
-
-  // load resource
-  T* resource = new T(path.c_str());
-  if(!resource->IsReady())
-  {
-    return NULL;
-  }
-
-  cache.PushBack(resource);
-
-  return resource;
-}
+  // destroyed first, so no callback can reach an entity being destroyed
+  std::unique_ptr<GameResourceLoader> mResourceLoader;
+};
 
 #endif
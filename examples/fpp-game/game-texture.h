@@ -18,6 +18,7 @@
  *
  */
 
+#include <dali/public-api/images/pixel-data.h>
 #include <dali/public-api/rendering/sampler.h>
 #include <dali/public-api/rendering/texture-set.h>
 #include <dali/public-api/rendering/texture.h>
@@ -48,6 +49,14 @@ public:
    */
   bool Load(const char* filename);
 
+  /**
+   * @brief Creates the texture from already decoded pixels
+   * @param[in] filename Name of the file the pixels were decoded from
+   * @param[in] pixelData Decoded pixels
+   * @return Returns true if success
+   */
+  bool Create(const char* filename, Dali::PixelData pixelData);
+
   /**
    * Checks status of texture, returns false if failed to load
    * @return true if texture has been loaded, false otherwise
@@ -35,14 +35,14 @@ bool LoadFile(const char* filename, ByteArray& bytes)
     {
       return false;
     }
-    bytes.resize(ftell(fin));
-    std::fill(bytes.begin(), bytes.end(), 0);
-    if(fseek(fin, 0, SEEK_SET))
+    long size = ftell(fin);
+    if(size <= 0 || fseek(fin, 0, SEEK_SET))
     {
       return false;
     }
+    bytes.resize(size);
     size_t result = fread(bytes.data(), 1, bytes.size(), fin);
-    return (result != 0);
+    return (result == bytes.size());
   }
 
   return false;
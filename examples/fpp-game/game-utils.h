@@ -28,6 +28,8 @@ typedef std::vector<char> ByteArray;
 
 /**
  * Loads file from the storage and returns byte array
+ * @note The array is sized with resize(), which value-initializes it before the file is read into it
+ * @return true if the whole file was read
  */
 bool LoadFile(const char* filename, ByteArray& out);
 
@@ -21,6 +21,7 @@
 
 // INTERNAL INCLUDES
 #include "frame-callback.h"
+#include "shared/launch-latency.h"
 
 using namespace Dali;
 using namespace Dali::Toolkit;
@@ -184,6 +185,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application             application = Application::New(&argc, &argv);
   FrameCallbackController controller(application);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
   return 0;
 }
@@ -20,6 +20,8 @@
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali-toolkit/devel-api/controls/gaussian-blur-view/gaussian-blur-view.h>
 
+#include "shared/launch-latency.h"
+
 using namespace Dali;
 using Dali::Toolkit::GaussianBlurView;
 using Dali::Toolkit::TextLabel;
@@ -172,6 +174,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 
   GaussianBlurViewExample test(application);
 
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
 
   return 0;
@@ -19,6 +19,9 @@
 #include <dali-toolkit/dali-toolkit.h>
 #include <string>
 
+// INTERNAL INCLUDES
+#include "shared/launch-latency.h"
+
 using namespace Dali;
 using namespace Dali::Toolkit;
 using namespace std;
@@ -473,6 +476,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application    application = Application::New(&argc, &argv);
   GestureExample controller(application);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
   return 0;
 }
@@ -17,6 +17,8 @@
 
 #include <dali-toolkit/dali-toolkit.h>
 
+#include "shared/launch-latency.h"
+
 using namespace Dali;
 using Dali::Toolkit::TextLabel;
 
@@ -79,6 +81,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application          application = Application::New(&argc, &argv);
   HelloWorldController test(application);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
   return 0;
 }
@@ -18,23 +18,25 @@
 // EXTERNAL INCLUDES
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali/devel-api/actors/actor-devel.h>
+#include <dali/devel-api/common/stage-devel.h>
+#include <algorithm>
+#include <fstream>
 #include <iostream>
+#include <memory>
 #include <sstream>
 
 #include <dali-toolkit/devel-api/controls/table-view/table-view.h>
 #include <dali-toolkit/devel-api/visual-factory/visual-factory.h>
 
+// INTERNAL INCLUDES
+#include "homescreen-scenario.h"
+#include "shared/launch-latency.h"
+
 using namespace Dali;
 using Dali::Toolkit::TextLabel;
 
 namespace
 {
-enum IconType
-{
-  IMAGEVIEW,
-  CHECKBOX
-};
-
 const char* IMAGE_PATH_PREFIX(DEMO_IMAGE_DIR "application-icon-");
 const char* IMAGE_PATH_POSTFIX(".png");
 const int   TOTAL_ICON_DEFINITIONS(147);
@@ -42,15 +44,9 @@ const int   TOTAL_ICON_DEFINITIONS(147);
 const char* BACKGROUND_IMAGE(DEMO_IMAGE_DIR "background-3.jpg");
 const float PAGE_SCALE_FACTOR_X(0.95f);
 const float PAGE_SCALE_FACTOR_Y(0.95f);
-const float PAGE_DURATION_SCALE_FACTOR(10.0f); ///< Time-scale factor, larger = animation is slower
+const float SHOW_DURATION(1.0f);
 
-const float    DEFAULT_OPT_ROW_COUNT(5);
-const float    DEFAULT_OPT_COL_COUNT(4);
-const float    DEFAULT_OPT_PAGE_COUNT(10);
-const bool     DEFAULT_OPT_USE_TABLEVIEW(true);
-const bool     DEFAULT_OPT_ICON_LABELS(true);
-const IconType DEFAULT_OPT_ICON_TYPE(IMAGEVIEW);
-const bool     DEFAULT_OPT_USE_TEXT_LABEL(false);
+const unsigned int POPULATE_INTERVAL(16u); ///< How often to check for a new frame to populate a slice of the pages in, in milliseconds
 
 // The image/label area tries to make sure the positioning will be relative to previous sibling
 const float IMAGE_AREA(0.60f);
@@ -81,54 +77,30 @@ void PrintHelp(const char* const opt, const char* const optDescription)
 
 /**
  * @brief This example is a benchmark that mimics the paged applications list of the homescreen application.
+ *
+ * It runs each scenario in turn: the pages are created & shown, then scrolled as the scenario's phases
+ * describe. The frame times of every phase, the time taken to create the pages and the time to the first
+ * frame are written as JSON once all the scenarios have run, after which the application quits.
+ *
+ * With incremental population only the first page is created before it is shown; the others are created
+ * icon by icon in slices of at most the scenario's budget, no more than one slice per frame, so that the first
+ * frame is interactive sooner & the frames keep their time while the pages still being created are scrolled to.
  */
 class HomescreenBenchmark : public ConnectionTracker
 {
 public:
-  // Config structure passed to the constructor. It makes easier to increase number
-  // of setup parameters if needed.
-  struct Config
-  {
-    Config()
-    : mRows(DEFAULT_OPT_ROW_COUNT),
-      mCols(DEFAULT_OPT_COL_COUNT),
-      mPageCount(DEFAULT_OPT_PAGE_COUNT),
-      mTableViewEnabled(DEFAULT_OPT_USE_TABLEVIEW),
-      mIconLabelsEnabled(DEFAULT_OPT_ICON_LABELS),
-      mIconType(DEFAULT_OPT_ICON_TYPE),
-      mUseTextLabel(DEFAULT_OPT_USE_TEXT_LABEL)
-    {
-    }
-
-    int      mRows;
-    int      mCols;
-    int      mPageCount;
-    bool     mTableViewEnabled;
-    bool     mIconLabelsEnabled;
-    IconType mIconType;
-    bool     mUseTextLabel;
-  };
-
-  // animation script data
-  struct ScriptData
-  {
-    ScriptData(int pages, float duration, bool flick)
-    : mPages(pages),
-      mDuration(duration),
-      mFlick(flick)
-    {
-    }
-
-    int   mPages;    ///< Number of pages to scroll
-    float mDuration; ///< Duration
-    bool  mFlick;    ///< Use flick or 'one-by-one' scroll
-  };
-
-  HomescreenBenchmark(Application& application, const Config& config)
+  HomescreenBenchmark(Application& application, const std::vector<HomescreenScenario>& scenarios, const std::string& resultsPath)
   : mApplication(application),
-    mConfig(config),
-    mScriptFrame(0),
-    mCurrentPage(0)
+    mScenarios(scenarios),
+    mResultsPath(resultsPath),
+    mScenario(0),
+    mPhase(0),
+    mCurrentPage(0),
+    mIconIndex(0),
+    mNextPage(0),
+    mNextIcon(0),
+    mLastSliceFrame(0u),
+    mPopulateStartFrame(0u)
   {
     // Connect to the Application's Init signal.
     mApplication.InitSignal().Connect(this, &HomescreenBenchmark::Create);
@@ -141,17 +113,9 @@ public:
   // The Init signal is received once (only) during the Application lifetime.
   void Create(Application& application)
   {
-    // Create benchmark script
-    CreateScript();
-
     // Get a handle to the window
     Window window = application.GetWindow();
 
-    mScrollParent = Actor::New();
-    mScrollParent.SetResizePolicy(ResizePolicy::FILL_TO_PARENT, Dimension::ALL_DIMENSIONS);
-    mScrollParent.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::CENTER);
-    mScrollParent.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
-
     // create background
     Toolkit::ImageView background = Toolkit::ImageView::New(BACKGROUND_IMAGE);
     window.Add(background);
@@ -159,9 +123,13 @@ public:
     background.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::CENTER);
     background.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
 
-    PopulatePages();
+    DevelStage::AddFrameCallback(Stage::GetCurrent(), mFrameTimeRecorder, window.GetRootLayer());
+    DevelStage::AddFrameCallback(Stage::GetCurrent(), mFrameCounter, window.GetRootLayer());
 
-    window.Add(mScrollParent);
+    mPopulateTimer = Timer::New(POPULATE_INTERVAL);
+    mPopulateTimer.TickSignal().Connect(this, &HomescreenBenchmark::OnPopulateTimer);
+
+    StartScenario();
 
     // Respond to a click anywhere on the window.
     window.GetRootLayer().TouchedSignal().Connect(this, &HomescreenBenchmark::OnTouch);
@@ -232,7 +200,10 @@ public:
     return button;
   }
 
-  void AddIconsToPage(Actor page, bool useTextLabel)
+  /**
+   * @brief Adds the icon at a column & row of a page.
+   */
+  void AddIcon(Actor page, int x, int y, bool useTextLabel)
   {
     Window window = mApplication.GetWindow();
 
@@ -245,138 +216,243 @@ public:
 
     Vector2 dpi = window.GetDpi();
 
-    static int currentIconIndex = 0;
+    // Create parent icon view
+    Toolkit::Control iconView = Toolkit::Control::New();
+    iconView.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT);
+    iconView.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT);
+
+    if(!mConfig.mTableViewEnabled)
+    {
+      float rowX = x * COL_WIDTH + PADDING;
+      float rowY = y * ROW_HEIGHT + PADDING;
+      iconView.SetProperty(Actor::Property::SIZE, Vector3(COL_WIDTH, ROW_HEIGHT, 1.0f));
+      iconView.SetProperty(Actor::Property::POSITION, Vector3(rowX, rowY, 0.0f));
+    }
+    else
+    {
+      iconView.SetResizePolicy(ResizePolicy::SIZE_RELATIVE_TO_PARENT, Dimension::ALL_DIMENSIONS);
+      iconView.SetProperty(Actor::Property::SIZE_SCALE_POLICY, SizeScalePolicy::FIT_WITH_ASPECT_RATIO);
+    }
+
+    Actor icon;
+
+    switch(mConfig.mIconType)
+    {
+      case CHECKBOX:
+      {
+        icon = CreateButton(mIconIndex);
+        break;
+      }
+      case IMAGEVIEW:
+      {
+        icon = CreateImageView(mIconIndex);
+        break;
+      }
+    }
+
+    if(mConfig.mIconLabelsEnabled)
+    {
+      // create label
+      if(useTextLabel)
+      {
+        Toolkit::TextLabel textLabel = Toolkit::TextLabel::New(DEMO_APPS_NAMES[mIconIndex]);
+        textLabel.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_CENTER);
+        textLabel.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::BOTTOM_CENTER);
+        textLabel.SetResizePolicy(ResizePolicy::USE_NATURAL_SIZE, Dimension::ALL_DIMENSIONS);
+        textLabel.SetProperty(Toolkit::TextLabel::Property::TEXT_COLOR, Vector4(1.0f, 1.0f, 1.0f, 1.0f)); // White.
+        textLabel.SetProperty(Toolkit::TextLabel::Property::POINT_SIZE, ((static_cast<float>(ROW_HEIGHT * LABEL_AREA) * 72.0f) / dpi.y) * 0.25f);
+        textLabel.SetProperty(Toolkit::TextLabel::Property::HORIZONTAL_ALIGNMENT, "CENTER");
+        textLabel.SetProperty(Toolkit::TextLabel::Property::VERTICAL_ALIGNMENT, "TOP");
+        icon.Add(textLabel);
+      }
+      else
+      {
+        Property::Map map;
+        map.Add(Toolkit::Visual::Property::TYPE, Toolkit::Visual::TEXT).Add(Toolkit::TextVisual::Property::TEXT, DEMO_APPS_NAMES[mIconIndex]).Add(Toolkit::TextVisual::Property::TEXT_COLOR, Color::WHITE).Add(Toolkit::TextVisual::Property::POINT_SIZE, ((static_cast<float>(ROW_HEIGHT * LABEL_AREA) * 72.0f) / dpi.y) * 0.25f).Add(Toolkit::TextVisual::Property::HORIZONTAL_ALIGNMENT, "CENTER").Add(Toolkit::TextVisual::Property::VERTICAL_ALIGNMENT, "TOP");
+
+        Toolkit::Control control = Toolkit::Control::New();
+        control.SetProperty(Toolkit::Control::Property::BACKGROUND, map);
+        control.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_CENTER);
+        control.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::BOTTOM_CENTER);
+        icon.Add(control);
+      }
+    }
+
+    iconView.Add(icon);
+    page.Add(iconView);
+
+    // We only have images and names for a certain number of icons.
+    // Wrap around if we have used them all.
+    if(++mIconIndex == TOTAL_ICON_DEFINITIONS)
+    {
+      mIconIndex = 0;
+    }
+  }
 
+  void AddIconsToPage(Actor page, bool useTextLabel)
+  {
     for(int y = 0; y < mConfig.mRows; ++y)
     {
       for(int x = 0; x < mConfig.mCols; ++x)
       {
-        // Create parent icon view
-        Toolkit::Control iconView = Toolkit::Control::New();
-        iconView.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT);
-        iconView.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT);
-
-        if(!mConfig.mTableViewEnabled)
-        {
-          float rowX = x * COL_WIDTH + PADDING;
-          float rowY = y * ROW_HEIGHT + PADDING;
-          iconView.SetProperty(Actor::Property::SIZE, Vector3(COL_WIDTH, ROW_HEIGHT, 1.0f));
-          iconView.SetProperty(Actor::Property::POSITION, Vector3(rowX, rowY, 0.0f));
-        }
-        else
-        {
-          iconView.SetResizePolicy(ResizePolicy::SIZE_RELATIVE_TO_PARENT, Dimension::ALL_DIMENSIONS);
-          iconView.SetProperty(Actor::Property::SIZE_SCALE_POLICY, SizeScalePolicy::FIT_WITH_ASPECT_RATIO);
-        }
-
-        Actor icon;
-
-        switch(mConfig.mIconType)
-        {
-          case CHECKBOX:
-          {
-            icon = CreateButton(currentIconIndex);
-            break;
-          }
-          case IMAGEVIEW:
-          {
-            icon = CreateImageView(currentIconIndex);
-            break;
-          }
-        }
-
-        if(mConfig.mIconLabelsEnabled)
-        {
-          // create label
-          if(useTextLabel)
-          {
-            Toolkit::TextLabel textLabel = Toolkit::TextLabel::New(DEMO_APPS_NAMES[currentIconIndex]);
-            textLabel.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_CENTER);
-            textLabel.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::BOTTOM_CENTER);
-            textLabel.SetResizePolicy(ResizePolicy::USE_NATURAL_SIZE, Dimension::ALL_DIMENSIONS);
-            textLabel.SetProperty(Toolkit::TextLabel::Property::TEXT_COLOR, Vector4(1.0f, 1.0f, 1.0f, 1.0f)); // White.
-            textLabel.SetProperty(Toolkit::TextLabel::Property::POINT_SIZE, ((static_cast<float>(ROW_HEIGHT * LABEL_AREA) * 72.0f) / dpi.y) * 0.25f);
-            textLabel.SetProperty(Toolkit::TextLabel::Property::HORIZONTAL_ALIGNMENT, "CENTER");
-            textLabel.SetProperty(Toolkit::TextLabel::Property::VERTICAL_ALIGNMENT, "TOP");
-            icon.Add(textLabel);
-          }
-          else
-          {
-            Property::Map map;
-            map.Add(Toolkit::Visual::Property::TYPE, Toolkit::Visual::TEXT).Add(Toolkit::TextVisual::Property::TEXT, DEMO_APPS_NAMES[currentIconIndex]).Add(Toolkit::TextVisual::Property::TEXT_COLOR, Color::WHITE).Add(Toolkit::TextVisual::Property::POINT_SIZE, ((static_cast<float>(ROW_HEIGHT * LABEL_AREA) * 72.0f) / dpi.y) * 0.25f).Add(Toolkit::TextVisual::Property::HORIZONTAL_ALIGNMENT, "CENTER").Add(Toolkit::TextVisual::Property::VERTICAL_ALIGNMENT, "TOP");
-
-            Toolkit::Control control = Toolkit::Control::New();
-            control.SetProperty(Toolkit::Control::Property::BACKGROUND, map);
-            control.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_CENTER);
-            control.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::BOTTOM_CENTER);
-            icon.Add(control);
-          }
-        }
-
-        iconView.Add(icon);
-        page.Add(iconView);
-
-        // We only have images and names for a certain number of icons.
-        // Wrap around if we have used them all.
-        if(++currentIconIndex == TOTAL_ICON_DEFINITIONS)
-        {
-          currentIconIndex = 0;
-        }
+        AddIcon(page, x, y, useTextLabel);
       }
     }
   }
 
-  void CreateScript()
+  /**
+   * @brief Creates the pages of the current scenario & starts showing them.
+   */
+  void StartScenario()
   {
-    const int lastPage = mConfig.mPageCount - 1;
-    const int halfA    = lastPage / 2;
-    const int halfB    = lastPage / 2 + lastPage % 2;
-    mScriptFrameData.push_back(ScriptData(lastPage, 1.5f, true));
-    mScriptFrameData.push_back(ScriptData(-lastPage, 1.5f, true));
-    mScriptFrameData.push_back(ScriptData(halfA, 1.0f, true));
-    mScriptFrameData.push_back(ScriptData(halfB, 1.0f, true));
-    mScriptFrameData.push_back(ScriptData(-lastPage, 0.5f, false));
-    mScriptFrameData.push_back(ScriptData(halfA, 0.5f, false));
-    mScriptFrameData.push_back(ScriptData(halfB, 1.0f, true));
-    mScriptFrameData.push_back(ScriptData(-halfA, 1.0f, true));
-    mScriptFrameData.push_back(ScriptData(1, 0.1f, true));
-    mScriptFrameData.push_back(ScriptData(-1, 0.1f, true));
-    mScriptFrameData.push_back(ScriptData(1, 0.1f, true));
-    mScriptFrameData.push_back(ScriptData(-1, 0.1f, true));
-    mScriptFrameData.push_back(ScriptData(1, 0.1f, true));
-    mScriptFrameData.push_back(ScriptData(-1, 0.1f, true));
-    mScriptFrameData.push_back(ScriptData(halfA, 1.0f, true));
+    const HomescreenScenario& scenario = mScenarios[mScenario];
+    Window                    window   = mApplication.GetWindow();
+
+    mConfig      = scenario.mConfig;
+    mCurrentPage = 0;
+    mIconIndex   = 0;
+    mPhase       = 0;
+
+    if(mScrollParent)
+    {
+      UnparentAndReset(mScrollParent);
+    }
+
+    mScrollParent = Actor::New();
+    mScrollParent.SetResizePolicy(ResizePolicy::FILL_TO_PARENT, Dimension::ALL_DIMENSIONS);
+    mScrollParent.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::CENTER);
+    mScrollParent.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
+
+    ScenarioResult result;
+    result.mName   = scenario.mName;
+    result.mConfig = scenario.mConfig;
+
+    mResults.push_back(result);
+
+    mPopulateStart = FrameClock::now();
+    PopulatePages();
+    window.Add(mScrollParent);
+    mResults.back().mPopulateMs = std::chrono::duration<float, std::milli>(FrameClock::now() - mPopulateStart).count();
+    if(mNextPage == mConfig.mPageCount)
+    {
+      mResults.back().mAllPagesMs = mResults.back().mPopulateMs;
+    }
+
+    mFirstFrameRecorder.reset(new DemoHelper::FirstFrameRecorder());
+    DevelStage::AddFrameCallback(Stage::GetCurrent(), *mFirstFrameRecorder, window.GetRootLayer());
+
+    // Fade in.
+    mCurrentPhase = ScrollPhase{"show", 0, SHOW_DURATION, false};
+    mFrameTimeRecorder.Start();
+    ShowAnimation();
   }
 
-  void PopulatePages()
+  /**
+   * @brief Creates an empty page & adds it to the scroll parent at its position.
+   */
+  Actor CreatePage(int index)
   {
     Vector3 windowSize(mApplication.GetWindow().GetSize());
 
-    for(int i = 0; i < mConfig.mPageCount; ++i)
-    {
-      // Create page.
-      Actor page = AddPage();
+    // Create page.
+    Actor page = AddPage();
 
+    // Move page 'a little bit up'.
+    page.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
+    page.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::CENTER);
+    page.SetProperty(Actor::Property::POSITION, Vector3(windowSize.x * index, 0.0f, 0.0f));
+    mScrollParent.Add(page);
+    return page;
+  }
+
+  /**
+   * @brief Creates the pages; only the first one when populating incrementally, the others are left to OnPopulateTimer().
+   */
+  void PopulatePages()
+  {
+    const int pageCount = mConfig.mIncrementalPopulation ? 1 : mConfig.mPageCount;
+    for(int i = 0; i < pageCount; ++i)
+    {
       // Populate icons.
-      AddIconsToPage(page, mConfig.mUseTextLabel);
+      AddIconsToPage(CreatePage(i), mConfig.mUseTextLabel);
+    }
 
-      // Move page 'a little bit up'.
-      page.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
-      page.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::CENTER);
-      page.SetProperty(Actor::Property::POSITION, Vector3(windowSize.x * i, 0.0f, 0.0f));
-      mScrollParent.Add(page);
+    mNextPage = pageCount;
+    mNextIcon = 0;
+    if(mNextPage < mConfig.mPageCount)
+    {
+      // The first slice waits for the frame showing the first page.
+      mLastSliceFrame     = mFrameCounter.GetFrameCount();
+      mPopulateStartFrame = mLastSliceFrame;
+      if(!mPopulateTimer.IsRunning())
+      {
+        mPopulateTimer.Start();
+      }
     }
 
     mScrollParent.SetProperty(Actor::Property::OPACITY, 1.0f);
     mScrollParent.SetProperty(Actor::Property::SCALE, Vector3::ONE);
+  }
 
-    // Fade in.
-    ShowAnimation();
+  /**
+   * @brief Once per frame, adds icons to the pages not populated yet until the time budget of the current scenario is spent.
+   * @return Whether there are icons left to add.
+   */
+  bool OnPopulateTimer()
+  {
+    if(mNextPage == mConfig.mPageCount)
+    {
+      // Started by a previous scenario which did not get to finish.
+      return false;
+    }
+
+    // The timer may tick more than once per frame, e.g. when a frame takes longer than the interval.
+    const uint32_t frame = mFrameCounter.GetFrameCount();
+    if(frame == mLastSliceFrame)
+    {
+      return true;
+    }
+    mLastSliceFrame = frame;
+
+    const FrameClock::time_point start  = FrameClock::now();
+    const auto                   budget = std::chrono::duration<float, std::milli>(mConfig.mPopulateBudgetMs);
+    const int                    icons  = mConfig.mRows * mConfig.mCols;
+
+    // At least one icon is added each time, so the pages are completed whatever the budget.
+    do
+    {
+      if(mNextIcon == 0)
+      {
+        mPopulatingPage = CreatePage(mNextPage);
+      }
+
+      AddIcon(mPopulatingPage, mNextIcon % mConfig.mCols, mNextIcon / mConfig.mCols, mConfig.mUseTextLabel);
+      if(++mNextIcon == icons)
+      {
+        mNextIcon = 0;
+        ++mNextPage;
+      }
+    } while(mNextPage < mConfig.mPageCount && FrameClock::now() - start < budget);
+
+    const FrameClock::time_point end    = FrameClock::now();
+    ScenarioResult&              result = mResults.back();
+    result.mPopulateSlices++;
+    result.mLongestSliceMs = std::max(result.mLongestSliceMs, std::chrono::duration<float, std::milli>(end - start).count());
+
+    if(mNextPage < mConfig.mPageCount)
+    {
+      return true;
+    }
+
+    mPopulatingPage.Reset();
+    result.mAllPagesMs     = std::chrono::duration<float, std::milli>(end - mPopulateStart).count();
+    result.mPopulateFrames = frame - mPopulateStartFrame;
+    return false;
   }
 
   void ShowAnimation()
   {
-    mShowAnimation = Animation::New(1.0f);
+    mShowAnimation = Animation::New(SHOW_DURATION);
     mShowAnimation.AnimateTo(Property(mScrollParent, Actor::Property::COLOR_ALPHA), 1.0f, AlphaFunction::EASE_IN_OUT);
     mShowAnimation.AnimateTo(Property(mScrollParent, Actor::Property::SCALE), Vector3::ONE, AlphaFunction::EASE_IN_OUT);
     mShowAnimation.FinishedSignal().Connect(this, &HomescreenBenchmark::OnAnimationEnd);
@@ -385,7 +461,6 @@ public:
 
   void ScrollPages(int pages, float duration, bool flick)
   {
-    duration *= PAGE_DURATION_SCALE_FACTOR;
     Vector3 windowSize(mApplication.GetWindow().GetSize());
     mScrollAnimation = Animation::New(duration);
     if(flick)
@@ -407,18 +482,52 @@ public:
 
   void OnAnimationEnd(Animation& source)
   {
-    if(mScriptFrame < mScriptFrameData.size())
+    ScenarioResult& result = mResults.back();
+    result.mPhases.push_back(PhaseResult{mCurrentPhase, DemoHelper::CalculateFrameTimeStatistics(mFrameTimeRecorder.Stop())});
+
+    if(mFirstFrameRecorder)
+    {
+      // The pages have been shown for a whole animation, so their first frame is long past.
+      if(mFirstFrameRecorder->HasFrame())
+      {
+        result.mFirstFrameMs = std::chrono::duration<float, std::milli>(mFirstFrameRecorder->GetFrameTime() - mPopulateStart).count();
+      }
+      DevelStage::RemoveFrameCallback(Stage::GetCurrent(), *mFirstFrameRecorder);
+      mFirstFrameRecorder.reset();
+    }
+
+    const std::vector<ScrollPhase>& phases = mScenarios[mScenario].mPhases;
+    if(mPhase < phases.size())
+    {
+      mCurrentPhase = phases[mPhase++];
+      mFrameTimeRecorder.Start();
+      ScrollPages(mCurrentPhase.mPages, mCurrentPhase.mDuration, mCurrentPhase.mFlick);
+    }
+    else if(++mScenario < mScenarios.size())
     {
-      ScriptData& frame = mScriptFrameData[mScriptFrame];
-      ScrollPages(frame.mPages, frame.mDuration, frame.mFlick);
-      ++mScriptFrame;
+      StartScenario();
     }
     else
     {
+      WriteResults();
       mApplication.Quit();
     }
   }
 
+  void WriteResults()
+  {
+    std::ofstream file;
+    if(!mResultsPath.empty())
+    {
+      file.open(mResultsPath);
+      if(!file.is_open())
+      {
+        std::cerr << "Unable to write homescreen-benchmark results to " << mResultsPath << std::endl;
+      }
+    }
+    WriteResultsJson(file.is_open() ? file : std::cout, mResults);
+  }
+
   void OnKeyEvent(const KeyEvent& event)
   {
     if(event.GetState() == KeyEvent::DOWN)
@@ -431,20 +540,42 @@ public:
   }
 
 private:
-  Application&            mApplication;
-  Actor                   mScrollParent;
-  Animation               mShowAnimation;
-  Animation               mScrollAnimation;
-  Config                  mConfig;
-  std::vector<ScriptData> mScriptFrameData;
-  size_t                  mScriptFrame;
-  int                     mCurrentPage;
+  using FrameClock = DemoHelper::FirstFrameRecorder::Clock;
+
+  Application&                    mApplication;
+  Actor                           mScrollParent;
+  Animation                       mShowAnimation;
+  Animation                       mScrollAnimation;
+  HomescreenConfig                mConfig;
+  std::vector<HomescreenScenario> mScenarios;
+  std::string                     mResultsPath;  ///< Where the results are written, stdout if empty
+  std::vector<ScenarioResult>     mResults;      ///< The results of the scenarios run so far
+  size_t                          mScenario;     ///< The index of the current scenario
+  size_t                          mPhase;        ///< The index of the next phase of the current scenario
+  ScrollPhase                     mCurrentPhase; ///< The phase being animated
+  int                             mCurrentPage;
+  int                             mIconIndex; ///< The icon added next, wrapping around TOTAL_ICON_DEFINITIONS
+
+  Actor    mPopulatingPage;     ///< The page OnPopulateTimer() is adding icons to
+  int      mNextPage;           ///< The page populated next, the page count once all are populated
+  int      mNextIcon;           ///< The icon of the page populated next
+  Timer    mPopulateTimer;      ///< Runs OnPopulateTimer() while there are pages to populate
+  uint32_t mLastSliceFrame;     ///< The frame count when the last slice was populated
+  uint32_t mPopulateStartFrame; ///< The frame count when the pages of the current scenario started to be created
+
+  DemoHelper::FrameTimeRecorder                   mFrameTimeRecorder;  ///< Records the frame times of each phase
+  std::unique_ptr<DemoHelper::FirstFrameRecorder> mFirstFrameRecorder; ///< Records the first frame of the current scenario
+  FrameClock::time_point                          mPopulateStart;      ///< When the pages of the current scenario started to be created
+  DemoHelper::FrameCounter                        mFrameCounter;       ///< Counts the frames, so at most one slice is populated per frame
 };
 
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   // Default settings.
-  HomescreenBenchmark::Config config;
+  HomescreenConfig config;
+  std::string      scenarioPath;
+  std::string      resultsPath;
+  bool             comparePopulation = false;
 
   bool printHelpAndExit = false;
 
@@ -479,14 +610,71 @@ int DALI_EXPORT_API main(int argc, char** argv)
     {
       config.mUseTextLabel = true;
     }
+    else if(arg.compare("--incremental") == 0)
+    {
+      config.mIncrementalPopulation = true;
+    }
+    else if(arg.compare(0, 14, "--incremental=") == 0)
+    {
+      config.mIncrementalPopulation = true;
+      config.mPopulateBudgetMs      = atof(arg.substr(14).c_str());
+      if(!(config.mPopulateBudgetMs > 0.0f))
+      {
+        std::cerr << "The --incremental budget must be a positive number of milliseconds" << std::endl;
+        return 1;
+      }
+    }
+    else if(arg.compare("--compare-population") == 0)
+    {
+      comparePopulation = true;
+    }
+    else if(arg.compare(0, 11, "--scenario=") == 0)
+    {
+      scenarioPath = arg.substr(11);
+    }
+    else if(arg.compare(0, 10, "--results=") == 0)
+    {
+      resultsPath = arg.substr(10);
+    }
     else if(arg.compare("--help") == 0)
     {
       printHelpAndExit = true;
     }
   }
 
+  std::vector<HomescreenScenario> scenarios;
+  if(scenarioPath.empty())
+  {
+    scenarios.push_back(CreateDefaultScenario(config));
+  }
+  else if(!printHelpAndExit)
+  {
+    const std::string error = LoadScenarios(scenarioPath, config, scenarios);
+    if(!error.empty())
+    {
+      std::cerr << "Unable to load scenarios: " << error << std::endl;
+      return 1;
+    }
+  }
+
+  if(comparePopulation)
+  {
+    // Run each scenario populating the pages eagerly, then incrementally.
+    std::vector<HomescreenScenario> compared;
+    for(const HomescreenScenario& scenario : scenarios)
+    {
+      for(bool incremental : {false, true})
+      {
+        compared.push_back(scenario);
+        compared.back().mName += incremental ? " (incremental)" : " (eager)";
+        compared.back().mConfig.mIncrementalPopulation = incremental;
+      }
+    }
+    scenarios.swap(compared);
+  }
+
   Application         application = Application::New(&argc, &argv);
-  HomescreenBenchmark test(application, config);
+  HomescreenBenchmark test(application, scenarios, resultsPath);
 
   if(printHelpAndExit)
   {
@@ -497,9 +685,14 @@ int DALI_EXPORT_API main(int argc, char** argv)
     PrintHelp("-disable-icon-labels", " Disables labels for each icon");
     PrintHelp("-use-checkbox", " Uses checkboxes for icons");
     PrintHelp("-use-text-label", " Uses TextLabel instead of a TextVisual");
+    PrintHelp("-incremental[=<ms>]",  Populates the first page, then the others for at most <ms> ( default 4 ) per frame");
+    PrintHelp("-compare-population", " Runs each scenario populating the pages eagerly, then incrementally");
+    PrintHelp("-scenario=<file>", " Runs the scenarios of a JSON file instead of the default one");
+    PrintHelp("-results=<file>", " Writes the results as JSON to a file instead of stdout");
     return 0;
   }
 
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
 
   return 0;
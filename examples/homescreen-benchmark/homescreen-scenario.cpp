@@ -0,0 +1,435 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include "homescreen-scenario.h"
+
+// EXTERNAL INCLUDES
+#include <dali-toolkit/dali-toolkit.h>
+#include <dali/dali.h>
+#include <fstream>
+#include <sstream>
+
+// INTERNAL INCLUDES
+#include "shared/json-stream-parser.h"
+
+using namespace Dali;
+
+namespace
+{
+const float PAGE_DURATION_SCALE_FACTOR(10.0f); ///< Time-scale factor of the default scenario, larger = animation is slower
+
+/**
+ * A phase as written in the scenario, before the pages are known.
+ */
+struct PhaseDescription
+{
+  std::string name;
+  std::string pattern{"flick"};
+  std::string pages{"1"}; ///< A number or "last", "half" or "rest", negated by a leading '-'
+  float       duration{1.0f};
+  int         repeat{1};
+};
+
+/**
+ * The phases of the default scenario, which used to be the benchmark's only script.
+ */
+const PhaseDescription DEFAULT_PHASES[] = {
+  {"", "flick", "last", 1.5f, 1},
+  {"", "flick", "-last", 1.5f, 1},
+  {"", "flick", "half", 1.0f, 1},
+  {"", "flick", "rest", 1.0f, 1},
+  {"", "step", "-last", 0.5f, 1},
+  {"", "step", "half", 0.5f, 1},
+  {"", "flick", "rest", 1.0f, 1},
+  {"", "flick", "-half", 1.0f, 1},
+  {"", "ping-pong", "1", 0.1f, 3},
+  {"", "flick", "half", 1.0f, 1},
+};
+
+/**
+ * Converts the pages of a phase to a number, @return false if they are not valid
+ */
+bool ResolvePages(const std::string& pages, int pageCount, int& resolved)
+{
+  const bool        negative = !pages.empty() && pages[0] == '-';
+  const std::string value    = negative ? pages.substr(1) : pages;
+  const int         last     = pageCount - 1;
+
+  if(value == "last")
+  {
+    resolved = last;
+  }
+  else if(value == "half")
+  {
+    resolved = last / 2;
+  }
+  else if(value == "rest")
+  {
+    resolved = last / 2 + last % 2;
+  }
+  else if(!value.empty() && value.find_first_not_of("0123456789") == std::string::npos)
+  {
+    resolved = atoi(value.c_str());
+  }
+  else
+  {
+    return false;
+  }
+
+  if(negative)
+  {
+    resolved = -resolved;
+  }
+  return true;
+}
+
+/**
+ * Adds the scrolls of a phase to the scenario, @return An empty string on success, otherwise the error
+ */
+std::string AddPhase(const PhaseDescription& description, float durationScale, HomescreenScenario& scenario)
+{
+  int pages = 0;
+  if(!ResolvePages(description.pages, scenario.mConfig.mPageCount, pages))
+  {
+    return "invalid pages \"" + description.pages + "\"";
+  }
+
+  const bool pingPong = description.pattern == "ping-pong";
+  if(!pingPong && description.pattern != "flick" && description.pattern != "step")
+  {
+    return "invalid pattern \"" + description.pattern + "\"";
+  }
+
+  const std::string name     = description.name.empty() ? description.pattern + " " + description.pages : description.name;
+  const float       duration = description.duration * durationScale;
+  for(int i = 0; i < description.repeat; ++i)
+  {
+    const std::string repeatName = description.repeat > 1 ? name + " #" + std::to_string(i + 1) : name;
+    scenario.mPhases.push_back(ScrollPhase{repeatName, pages, duration, description.pattern != "step"});
+    if(pingPong)
+    {
+      scenario.mPhases.push_back(ScrollPhase{repeatName + " back", -pages, duration, true});
+    }
+  }
+  return std::string();
+}
+
+/**
+ * Fills the scenarios as the scenario file is parsed
+ */
+class ScenarioJsonHandler : public DemoHelper::JsonStreamHandler
+{
+public:
+  ScenarioJsonHandler(const HomescreenConfig& defaults, std::vector<HomescreenScenario>& scenarios)
+  : mDefaults(defaults),
+    mScenarios(scenarios)
+  {
+  }
+
+  const std::string& GetError() const
+  {
+    return mError;
+  }
+
+  bool OnObjectStart(const DemoHelper::JsonPath& path) override
+  {
+    if(path.Matches({"scenarios", nullptr}))
+    {
+      mScenarios.push_back(HomescreenScenario());
+      mScenarios.back().mName   = "scenario " + std::to_string(path.GetIndex(1) + 1u);
+      mScenarios.back().mConfig = mDefaults;
+      mPhases.clear();
+      mHasPhases = false;
+    }
+    else if(path.Matches({"scenarios", nullptr, "phases", nullptr}))
+    {
+      mPhases.push_back(PhaseDescription());
+    }
+    return true;
+  }
+
+  bool OnObjectEnd(const DemoHelper::JsonPath& path) override
+  {
+    if(path.Matches({"scenarios", nullptr}))
+    {
+      // The pages of the phases depend on the page count, which may be given after them
+      HomescreenScenario& scenario = mScenarios.back();
+      if(!mHasPhases)
+      {
+        for(const PhaseDescription& phase : DEFAULT_PHASES)
+        {
+          AddPhase(phase, PAGE_DURATION_SCALE_FACTOR, scenario);
+        }
+      }
+      for(const PhaseDescription& phase : mPhases)
+      {
+        mError = AddPhase(phase, 1.0f, scenario);
+        if(!mError.empty())
+        {
+          mError = scenario.mName + ": " + mError;
+          return false;
+        }
+      }
+      if(scenario.mConfig.mPageCount < 2 || scenario.mConfig.mRows < 1 || scenario.mConfig.mCols < 1)
+      {
+        mError = scenario.mName + ": needs at least 2 pages, 1 row & 1 column";
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool OnArrayStart(const DemoHelper::JsonPath& path) override
+  {
+    mHasPhases = mHasPhases || path.Matches({"scenarios", nullptr, "phases"});
+    return true;
+  }
+
+  bool OnBool(const DemoHelper::JsonPath& path, bool value) override
+  {
+    if(path.Matches({"scenarios", nullptr, "tableView"}))
+    {
+      mScenarios.back().mConfig.mTableViewEnabled = value;
+    }
+    return true;
+  }
+
+  bool OnNumber(const DemoHelper::JsonPath& path, double value) override
+  {
+    if(path.Matches({"scenarios", nullptr, "*"}))
+    {
+      HomescreenConfig&  config = mScenarios.back().mConfig;
+      const std::string& name   = path.GetName();
+      if(name == "rows")
+      {
+        config.mRows = static_cast<int>(value);
+      }
+      else if(name == "columns")
+      {
+        config.mCols = static_cast<int>(value);
+      }
+      else if(name == "pages")
+      {
+        config.mPageCount = static_cast<int>(value);
+      }
+      else if(name == "populateBudgetMs")
+      {
+        if(!(value > 0.0))
+        {
+          mError = mScenarios.back().mName + ": populateBudgetMs must be positive";
+          return false;
+        }
+        config.mPopulateBudgetMs = static_cast<float>(value);
+      }
+    }
+    else if(path.Matches({"scenarios", nullptr, "phases", nullptr, "*"}))
+    {
+      PhaseDescription&  phase = mPhases.back();
+      const std::string& name  = path.GetName();
+      if(name == "pages")
+      {
+        phase.pages = std::to_string(static_cast<int>(value));
+      }
+      else if(name == "duration")
+      {
+        phase.duration = static_cast<float>(value);
+      }
+      else if(name == "repeat")
+      {
+        phase.repeat = static_cast<int>(value);
+      }
+    }
+    return true;
+  }
+
+  bool OnString(const DemoHelper::JsonPath& path, const std::string& value) override
+  {
+    if(path.Matches({"scenarios", nullptr, "*"}))
+    {
+      HomescreenScenario& scenario = mScenarios.back();
+      const std::string&  name     = path.GetName();
+      if(name == "name")
+      {
+        scenario.mName = value;
+      }
+      else if(name == "iconType")
+      {
+        if(value != "image-view" && value != "checkbox")
+        {
+          mError = scenario.mName + ": invalid iconType \"" + value + "\"";
+          return false;
+        }
+        scenario.mConfig.mIconType = value == "checkbox" ? CHECKBOX : IMAGEVIEW;
+      }
+      else if(name == "iconLabels")
+      {
+        if(value != "text-visual" && value != "text-label" && value != "none")
+        {
+          mError = scenario.mName + ": invalid iconLabels \"" + value + "\"";
+          return false;
+        }
+        scenario.mConfig.mIconLabelsEnabled = value != "none";
+        scenario.mConfig.mUseTextLabel      = value == "text-label";
+      }
+      else if(name == "population")
+      {
+        if(value != "eager" && value != "incremental")
+        {
+          mError = scenario.mName + ": invalid population \"" + value + "\"";
+          return false;
+        }
+        scenario.mConfig.mIncrementalPopulation = value == "incremental";
+      }
+    }
+    else if(path.Matches({"scenarios", nullptr, "phases", nullptr, "*"}))
+    {
+      PhaseDescription&  phase = mPhases.back();
+      const std::string& name  = path.GetName();
+      if(name == "name")
+      {
+        phase.name = value;
+      }
+      else if(name == "pattern")
+      {
+        phase.pattern = value;
+      }
+      else if(name == "pages")
+      {
+        phase.pages = value;
+      }
+    }
+    return true;
+  }
+
+private:
+  const HomescreenConfig&          mDefaults;
+  std::vector<HomescreenScenario>& mScenarios;
+  std::vector<PhaseDescription>    mPhases;          ///< The phases of the current scenario
+  bool                             mHasPhases{false}; ///< Whether the current scenario has its own phases
+  std::string                      mError;
+};
+
+/**
+ * Writes a string as a JSON string, escaping what needs to be
+ */
+void WriteJsonString(std::ostream& stream, const std::string& value)
+{
+  stream << '"';
+  for(char c : value)
+  {
+    if(c == '"' || c == '\\')
+    {
+      stream << '\\' << c;
+    }
+    else if(static_cast<unsigned char>(c) < 0x20u)
+    {
+      stream << ' ';
+    }
+    else
+    {
+      stream << c;
+    }
+  }
+  stream << '"';
+}
+
+} // namespace
+
+HomescreenScenario CreateDefaultScenario(const HomescreenConfig& config)
+{
+  HomescreenScenario scenario;
+  scenario.mName   = "default";
+  scenario.mConfig = config;
+  for(const PhaseDescription& phase : DEFAULT_PHASES)
+  {
+    AddPhase(phase, PAGE_DURATION_SCALE_FACTOR, scenario);
+  }
+  return scenario;
+}
+
+std::string LoadScenarios(const std::string& path, const HomescreenConfig& defaults, std::vector<HomescreenScenario>& scenarios)
+{
+  std::ifstream file(path);
+  if(!file.is_open())
+  {
+    return "unable to open " + path;
+  }
+  std::stringstream json;
+  json << file.rdbuf();
+
+  ScenarioJsonHandler handler(defaults, scenarios);
+  std::string         error = DemoHelper::ParseJsonStream(json.str(), handler);
+  if(!handler.GetError().empty())
+  {
+    error = handler.GetError();
+  }
+  else if(error.empty() && scenarios.empty())
+  {
+    error = "no scenarios in " + path;
+  }
+  return error;
+}
+
+void WriteResultsJson(std::ostream& stream, const std::vector<ScenarioResult>& results)
+{
+  stream << "{\n"
+         << "  \"versions\": { \"core\": \"" << CORE_MAJOR_VERSION << "." << CORE_MINOR_VERSION << "." << CORE_MICRO_VERSION
+         << "\", \"adaptor\": \"" << ADAPTOR_MAJOR_VERSION << "." << ADAPTOR_MINOR_VERSION << "." << ADAPTOR_MICRO_VERSION
+         << "\", \"toolkit\": \"" << Toolkit::TOOLKIT_MAJOR_VERSION << "." << Toolkit::TOOLKIT_MINOR_VERSION << "." << Toolkit::TOOLKIT_MICRO_VERSION << "\" },\n"
+         << "  \"scenarios\": [";
+
+  for(size_t i = 0u; i < results.size(); ++i)
+  {
+    const ScenarioResult&   result = results[i];
+    const HomescreenConfig& config = result.mConfig;
+
+    stream << (i ? ",\n" : "\n") << "    {\n      \"name\": ";
+    WriteJsonString(stream, result.mName);
+    stream << ",\n      \"config\": { \"rows\": " << config.mRows
+           << ", \"columns\": " << config.mCols
+           << ", \"pages\": " << config.mPageCount
+           << ", \"iconType\": \"" << (config.mIconType == CHECKBOX ? "checkbox" : "image-view")
+           << "\", \"iconLabels\": \"" << (!config.mIconLabelsEnabled ? "none" : config.mUseTextLabel ? "text-label" : "text-visual")
+           << "\", \"tableView\": " << (config.mTableViewEnabled ? "true" : "false")
+           << ", \"population\": \"" << (config.mIncrementalPopulation ? "incremental" : "eager")
+           << "\", \"populateBudgetMs\": " << config.mPopulateBudgetMs << " },\n"
+           << "      \"populateMs\": " << result.mPopulateMs << ",\n"
+           << "      \"firstFrameMs\": " << result.mFirstFrameMs << ",\n"
+           << "      \"allPagesMs\": " << result.mAllPagesMs << ",\n"
+           << "      \"populateSlices\": " << result.mPopulateSlices << ",\n"
+           << "      \"populateFrames\": " << result.mPopulateFrames << ",\n"
+           << "      \"slicesPerFrame\": " << (result.mPopulateFrames ? float(result.mPopulateSlices) / result.mPopulateFrames : 0.0f) << ",\n"
+           << "      \"longestSliceMs\": " << result.mLongestSliceMs << ",\n"
+           << "      \"phases\": [";
+
+    for(size_t j = 0u; j < result.mPhases.size(); ++j)
+    {
+      const PhaseResult& phase = result.mPhases[j];
+      stream << (j ? ",\n" : "\n") << "        { \"name\": ";
+      WriteJsonString(stream, phase.mPhase.mName);
+      stream << ", \"pages\": " << phase.mPhase.mPages
+             << ", \"durationS\": " << phase.mPhase.mDuration
+             << ", \"flick\": " << (phase.mPhase.mFlick ? "true" : "false")
+             << ", \"frameTimes\": ";
+      DemoHelper::WriteJson(stream, phase.mStatistics);
+      stream << " }";
+    }
+    stream << "\n      ]\n    }";
+  }
+  stream << "\n  ]\n}" << std::endl;
+}
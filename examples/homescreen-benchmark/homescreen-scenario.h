@@ -0,0 +1,146 @@
+#ifndef DALI_DEMO_HOMESCREEN_SCENARIO_H
+#define DALI_DEMO_HOMESCREEN_SCENARIO_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <ostream>
+#include <string>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include "shared/frame-time-recorder.h"
+
+enum IconType
+{
+  IMAGEVIEW,
+  CHECKBOX
+};
+
+/**
+ * @brief The layout of the homescreen's pages.
+ */
+struct HomescreenConfig
+{
+  int      mRows{5};
+  int      mCols{4};
+  int      mPageCount{10};
+  bool     mTableViewEnabled{true};
+  bool     mIconLabelsEnabled{true};
+  IconType mIconType{IMAGEVIEW};
+  bool     mUseTextLabel{false};
+  bool     mIncrementalPopulation{false}; ///< Create the first page, then the others a slice per frame
+  float    mPopulateBudgetMs{4.0f};       ///< Time spent creating icons in each frame's slice, at least one icon is created
+};
+
+/**
+ * @brief A scroll of the pages, made by a single animation.
+ */
+struct ScrollPhase
+{
+  std::string mName;     ///< Identifies the phase in the results
+  int         mPages;    ///< Number of pages to scroll, negative to scroll back
+  float       mDuration; ///< Duration in seconds, of each page if not flicking
+  bool        mFlick;    ///< Use flick or 'one-by-one' scroll
+};
+
+/**
+ * @brief A homescreen layout & the scrolls made with it.
+ */
+struct HomescreenScenario
+{
+  std::string              mName;
+  HomescreenConfig         mConfig;
+  std::vector<ScrollPhase> mPhases;
+};
+
+/**
+ * @brief The measurements of a phase, including the animation showing the pages.
+ */
+struct PhaseResult
+{
+  ScrollPhase                     mPhase;
+  DemoHelper::FrameTimeStatistics mStatistics;
+};
+
+/**
+ * @brief The measurements of a scenario.
+ */
+struct ScenarioResult
+{
+  std::string              mName;
+  HomescreenConfig         mConfig;
+  float                    mPopulateMs{0.0f};     ///< Time taken to create the pages shown before the first frame
+  float                    mFirstFrameMs{0.0f};   ///< Time from starting to create the pages to the first (interactive) frame showing them
+  float                    mAllPagesMs{0.0f};     ///< Time from starting to create the pages to all of them being created
+  unsigned int             mPopulateSlices{0u};   ///< Number of slices the pages were created in, when incremental
+  unsigned int             mPopulateFrames{0u};   ///< Number of frames from the first page being created to the last slice
+  float                    mLongestSliceMs{0.0f}; ///< The longest of those slices
+  std::vector<PhaseResult> mPhases;
+};
+
+/**
+ * @brief Creates the scenario the benchmark runs without a scenario file: flicks & steps over all the
+ * pages, half of them and single pages.
+ * @param[in]  config  The layout of the pages.
+ */
+HomescreenScenario CreateDefaultScenario(const HomescreenConfig& config);
+
+/**
+ * @brief Loads scenarios from a JSON file.
+ *
+ * The file holds an array of scenarios, e.g.
+ * @code
+ * {
+ *   "scenarios": [
+ *     {
+ *       "name": "checkboxes",
+ *       "rows": 5, "columns": 4, "pages": 10,
+ *       "iconType": "checkbox",
+ *       "iconLabels": "text-label",
+ *       "tableView": false,
+ *       "population": "incremental", "populateBudgetMs": 4,
+ *       "phases": [
+ *         { "name": "to-end", "pattern": "flick", "pages": "last", "duration": 15 },
+ *         { "pattern": "step", "pages": "-half", "duration": 5 },
+ *         { "pattern": "ping-pong", "pages": 1, "duration": 1, "repeat": 3 }
+ *       ]
+ *     }
+ *   ]
+ * }
+ * @endcode
+ * The icon type is "image-view" or "checkbox", the icon labels "text-visual", "text-label" or "none" & the
+ * population "eager" or "incremental". The layout members default to the given configuration & the phases to those of CreateDefaultScenario().
+ * The pages of a phase are a number or "last" (the number of pages less one), "half" or "rest" (what
+ * "half" leaves of "last"), negated by a leading '-'. A "flick" scrolls all the pages in one animation
+ * of the given duration, a "step" scrolls one page at a time for the given duration each, and a
+ * "ping-pong" flicks there & back. Phases are run "repeat" times.
+ *
+ * @param[in]  path       The file.
+ * @param[in]  defaults   The layout used for the values a scenario does not set.
+ * @param[out] scenarios  The scenarios loaded are added to this.
+ * @return An empty string on success, otherwise the error.
+ */
+std::string LoadScenarios(const std::string& path, const HomescreenConfig& defaults, std::vector<HomescreenScenario>& scenarios);
+
+/**
+ * @brief Writes the results of the scenarios, with the versions of DALi used, as a JSON document.
+ */
+void WriteResultsJson(std::ostream& stream, const std::vector<ScenarioResult>& results);
+
+#endif // DALI_DEMO_HOMESCREEN_SCENARIO_H
@@ -0,0 +1,495 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include "image-policies-benchmark.h"
+
+// EXTERNAL INCLUDES
+#include <dali-toolkit/devel-api/controls/control-devel.h>
+#include <dali-toolkit/devel-api/visuals/image-visual-properties-devel.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <set>
+
+// INTERNAL INCLUDES
+#include "shared/memory-usage.h"
+
+using namespace Dali;
+using namespace Dali::Toolkit;
+
+namespace
+{
+const char* const IMAGE_PATH_FORMAT = DEMO_IMAGE_DIR "gallery-medium-%u.jpg";
+const unsigned int IMAGE_FILE_COUNT = 53u;
+
+const unsigned int PAGE_COLUMNS         = 4u;
+const unsigned int TICK_INTERVAL_MS     = 16u;
+const double       STEP_TIMEOUT_MS      = 10000.0;
+const double       SETTLE_MS            = 500.0; ///< How long the last step waits before measuring the steady state
+const unsigned int SHOW_HIDE_CYCLES     = 3u;
+const double       CACHE_HIT_MAXIMUM_MS = 0.5; ///< Longer than loading a texture kept by the texture manager takes
+
+double Milliseconds(std::chrono::steady_clock::duration duration)
+{
+  return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+const char* GetName(ImageVisual::LoadPolicy::Type policy)
+{
+  return policy == ImageVisual::LoadPolicy::IMMEDIATE ? "IMMEDIATE" : "ATTACHED";
+}
+
+const char* GetName(ImageVisual::ReleasePolicy::Type policy)
+{
+  return policy == ImageVisual::ReleasePolicy::DETACHED ? "DETACHED" : policy == ImageVisual::ReleasePolicy::DESTROYED ? "DESTROYED" : "NEVER";
+}
+
+double GetPercentile(std::vector<double> values, double percentile)
+{
+  if(values.empty())
+  {
+    return 0.0;
+  }
+  std::sort(values.begin(), values.end());
+  const size_t rank = static_cast<size_t>(std::ceil(percentile / 100.0 * values.size()));
+  return values[std::min(std::max(rank, size_t(1u)), values.size()) - 1u];
+}
+
+} // namespace
+
+ImagePoliciesBenchmark::ImagePoliciesBenchmark(Application& application, unsigned int imageCount, unsigned int pageSize, const std::string& csvPath)
+: mApplication(application),
+  mPageCount(0u),
+  mPageSize(std::max(pageSize, 1u)),
+  mCsvPath(csvPath),
+  mRun(0u),
+  mStep(0u),
+  mSettling(false),
+  mGraphicsBaseKb(0.0)
+{
+  mPageCount = std::max((imageCount + mPageSize - 1u) / mPageSize, 3u);
+
+  // Those keeping textures run last, so the others are not measured with them loaded
+  const ImageVisual::ReleasePolicy::Type releasePolicies[] = {ImageVisual::ReleasePolicy::DETACHED, ImageVisual::ReleasePolicy::DESTROYED, ImageVisual::ReleasePolicy::NEVER};
+  const ImageVisual::LoadPolicy::Type    loadPolicies[]    = {ImageVisual::LoadPolicy::ATTACHED, ImageVisual::LoadPolicy::IMMEDIATE};
+  for(auto releasePolicy : releasePolicies)
+  {
+    for(auto loadPolicy : loadPolicies)
+    {
+      mPolicies.push_back(Policy{loadPolicy, releasePolicy, false});
+      mPolicies.push_back(Policy{loadPolicy, releasePolicy, true});
+    }
+  }
+
+  // Scroll to the last page & back, keeping the page ahead created & the page behind off the window
+  const int pages = static_cast<int>(mPageCount);
+  for(int page = 0; page < pages; ++page)
+  {
+    mSteps.push_back(Step{page >= 2 ? page - 2 : NONE, page >= 1 ? page - 1 : NONE, page + 1 < pages ? page + 1 : NONE, page, false});
+  }
+  for(int page = pages - 2; page >= 0; --page)
+  {
+    mSteps.push_back(Step{page + 2 < pages ? page + 2 : NONE, page + 1, page >= 1 ? page - 1 : NONE, page, false});
+  }
+  for(unsigned int cycle = 0u; cycle < SHOW_HIDE_CYCLES; ++cycle)
+  {
+    mSteps.push_back(Step{NONE, 0, NONE, NONE, false});
+    mSteps.push_back(Step{NONE, NONE, NONE, 0, false});
+  }
+  mSteps.push_back(Step{NONE, NONE, NONE, NONE, true});
+
+  mApplication.InitSignal().Connect(this, &ImagePoliciesBenchmark::Create);
+}
+
+void ImagePoliciesBenchmark::Create(Application& application)
+{
+  Window window = application.GetWindow();
+  window.SetBackgroundColor(Color::BLACK);
+
+  mContainer = Actor::New();
+  mContainer.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT);
+  mContainer.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT);
+  window.Add(mContainer);
+
+  const Vector2      windowSize = window.GetSize();
+  const unsigned int rows       = (mPageSize + PAGE_COLUMNS - 1u) / PAGE_COLUMNS;
+  mCellSize                     = Vector2(std::floor(windowSize.width / PAGE_COLUMNS), std::floor(windowSize.height / rows));
+
+  printf("Benchmarking %u image policy combinations over %u pages of %u images\n", static_cast<unsigned int>(mPolicies.size()), mPageCount, mPageSize);
+
+  mTimer = Timer::New(TICK_INTERVAL_MS);
+  mTimer.TickSignal().Connect(this, &ImagePoliciesBenchmark::OnTick);
+
+  StartRun();
+  mTimer.Start();
+}
+
+void ImagePoliciesBenchmark::StartRun()
+{
+  mResults.push_back(Result());
+  mResults.back().policy = mPolicies[mRun];
+
+  mPages.assign(mPageCount, std::vector<Item>());
+  mItemsByActor.clear();
+  mLoadedKeys.clear();
+  mGraphicsBaseKb = DemoHelper::SampleMemoryUsage().graphics;
+
+  mStep = 0u;
+  StartStep();
+}
+
+void ImagePoliciesBenchmark::FinishRun()
+{
+  for(unsigned int page = 0u; page < mPageCount; ++page)
+  {
+    DestroyPage(page);
+  }
+
+  const Result& result = mResults.back();
+  printf("  %-9s %-9s %-5s done\n", GetName(result.policy.loadPolicy), GetName(result.policy.releasePolicy), result.policy.synchronous ? "sync" : "async");
+
+  if(++mRun < mPolicies.size())
+  {
+    StartRun();
+  }
+  else
+  {
+    mTimer.Stop();
+    PrintResults();
+    mApplication.Quit();
+  }
+}
+
+void ImagePoliciesBenchmark::StartStep()
+{
+  const Step&             step  = mSteps[mStep];
+  const Clock::time_point start = Clock::now();
+
+  if(step.destroy != NONE)
+  {
+    DestroyPage(step.destroy);
+  }
+  if(step.hide != NONE)
+  {
+    HidePage(step.hide);
+  }
+  if(step.create != NONE)
+  {
+    CreatePage(step.create);
+  }
+  if(step.show != NONE)
+  {
+    ShowPage(step.show);
+  }
+  if(step.settle)
+  {
+    for(unsigned int page = 0u; page < mPageCount; ++page)
+    {
+      if(!mPages[page].empty() && !mPages[page].front().view.GetProperty<bool>(Actor::Property::CONNECTED_TO_SCENE))
+      {
+        DestroyPage(page);
+      }
+    }
+  }
+
+  mStepStart                    = Clock::now();
+  mSettling                     = false;
+  mResults.back().longestStepMs = std::max(mResults.back().longestStepMs, Milliseconds(mStepStart - start));
+}
+
+bool ImagePoliciesBenchmark::OnTick()
+{
+  const Clock::time_point now     = Clock::now();
+  bool                    waiting = false;
+  for(auto& page : mPages)
+  {
+    for(Item& item : page)
+    {
+      if(item.awaited)
+      {
+        const Visual::ResourceStatus status = DevelControl::GetVisualResourceStatus(item.view, ImageView::Property::IMAGE);
+        if(status == Visual::ResourceStatus::READY || status == Visual::ResourceStatus::FAILED)
+        {
+          // Missed by the signal, e.g. if it was emitted before the image was shown
+          OnItemReady(item, now);
+        }
+        else
+        {
+          waiting = true;
+        }
+      }
+    }
+  }
+
+  Result& result = mResults.back();
+  if(waiting && Milliseconds(now - mStepStart) < STEP_TIMEOUT_MS)
+  {
+    return true;
+  }
+  if(waiting)
+  {
+    ++result.timeouts;
+    for(auto& page : mPages)
+    {
+      for(Item& item : page)
+      {
+        item.awaited = false;
+      }
+    }
+  }
+
+  if(mSteps[mStep].settle && !mSettling)
+  {
+    mSettling    = true;
+    mSettleStart = now;
+  }
+  if(mSettling && Milliseconds(now - mSettleStart) < SETTLE_MS)
+  {
+    return true;
+  }
+
+  const double textureKb  = EstimateTextureMemory();
+  const double graphicsKb = DemoHelper::SampleMemoryUsage().graphics - mGraphicsBaseKb;
+  result.peakKb           = std::max(result.peakKb, textureKb);
+  result.graphicsPeakKb   = std::max(result.graphicsPeakKb, graphicsKb);
+
+  if(++mStep < mSteps.size())
+  {
+    StartStep();
+  }
+  else
+  {
+    result.steadyKb         = textureKb;
+    result.graphicsSteadyKb = graphicsKb;
+    FinishRun();
+  }
+  return true;
+}
+
+void ImagePoliciesBenchmark::OnResourceReady(Control control)
+{
+  auto item = mItemsByActor.find(control.GetProperty<int>(Actor::Property::ID));
+  if(item != mItemsByActor.end() && item->second->awaited)
+  {
+    OnItemReady(*item->second, Clock::now());
+  }
+}
+
+void ImagePoliciesBenchmark::CreatePage(int page)
+{
+  std::vector<Item>& items = mPages[page];
+  if(!items.empty())
+  {
+    return;
+  }
+
+  const Policy&      policy     = mPolicies[mRun];
+  const unsigned int imageCount = mPageCount * mPageSize;
+  const unsigned int variants   = (imageCount + IMAGE_FILE_COUNT - 1u) / IMAGE_FILE_COUNT;
+
+  items.resize(mPageSize);
+  for(unsigned int i = 0u; i < mPageSize; ++i)
+  {
+    // Each image of each run is a different texture, with the same file at slightly different sizes
+    const unsigned int image  = page * mPageSize + i;
+    const unsigned int width  = static_cast<unsigned int>(mCellSize.width) + mRun * variants + image / IMAGE_FILE_COUNT;
+    const unsigned int height = static_cast<unsigned int>(mCellSize.height);
+
+    char url[256];
+    snprintf(url, sizeof(url), IMAGE_PATH_FORMAT, image % IMAGE_FILE_COUNT + 1u);
+
+    Item& item = items[i];
+    item.key   = std::string(url) + "@" + std::to_string(width) + "x" + std::to_string(height);
+
+    const Clock::time_point start = Clock::now();
+
+    item.view = ImageView::New();
+    item.view.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT);
+    item.view.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT);
+    item.view.SetProperty(Actor::Property::POSITION, Vector2((i % PAGE_COLUMNS) * mCellSize.width, (i / PAGE_COLUMNS) * mCellSize.height));
+    item.view.SetProperty(Actor::Property::SIZE, mCellSize);
+    item.view.ResourceReadySignal().Connect(this, &ImagePoliciesBenchmark::OnResourceReady);
+
+    Property::Map map;
+    map[Visual::Property::TYPE]                          = Visual::IMAGE;
+    map[ImageVisual::Property::URL]                      = url;
+    map[ImageVisual::Property::DESIRED_WIDTH]            = static_cast<int>(width);
+    map[ImageVisual::Property::DESIRED_HEIGHT]           = static_cast<int>(height);
+    map[ImageVisual::Property::LOAD_POLICY]              = policy.loadPolicy;
+    map[ImageVisual::Property::RELEASE_POLICY]           = policy.releasePolicy;
+    map[DevelImageVisual::Property::SYNCHRONOUS_LOADING] = policy.synchronous;
+    item.view.SetProperty(ImageView::Property::IMAGE, map);
+
+    if(policy.loadPolicy == ImageVisual::LoadPolicy::IMMEDIATE)
+    {
+      CheckReload(item, Milliseconds(Clock::now() - start));
+    }
+  }
+
+  for(Item& item : items)
+  {
+    mItemsByActor[item.view.GetProperty<int>(Actor::Property::ID)] = &item;
+  }
+}
+
+void ImagePoliciesBenchmark::ShowPage(int page)
+{
+  CreatePage(page);
+  for(Item& item : mPages[page])
+  {
+    item.shown = Clock::now();
+    mContainer.Add(item.view);
+    const Clock::time_point added = Clock::now();
+
+    CheckReload(item, Milliseconds(added - item.shown));
+    if(DevelControl::GetVisualResourceStatus(item.view, ImageView::Property::IMAGE) == Visual::ResourceStatus::PREPARING)
+    {
+      item.awaited = true;
+    }
+    else
+    {
+      // Ready on being shown, either kept or loaded synchronously while being added
+      OnItemReady(item, added);
+    }
+  }
+}
+
+void ImagePoliciesBenchmark::HidePage(int page)
+{
+  for(Item& item : mPages[page])
+  {
+    mContainer.Remove(item.view);
+    item.awaited       = false;
+    item.reloadCounted = false;
+  }
+}
+
+void ImagePoliciesBenchmark::DestroyPage(int page)
+{
+  for(Item& item : mPages[page])
+  {
+    mItemsByActor.erase(item.view.GetProperty<int>(Actor::Property::ID));
+    item.view.Unparent();
+  }
+  mPages[page].clear();
+}
+
+void ImagePoliciesBenchmark::OnItemReady(Item& item, Clock::time_point ready)
+{
+  item.awaited = false;
+  mResults.back().readyMs.push_back(Milliseconds(ready - item.shown));
+  RecordLoaded(item);
+}
+
+bool ImagePoliciesBenchmark::RecordLoaded(const Item& item)
+{
+  if(DevelControl::GetVisualResourceStatus(item.view, ImageView::Property::IMAGE) != Visual::ResourceStatus::READY)
+  {
+    return false;
+  }
+
+  const Vector3 size    = item.view.GetNaturalSize();
+  mLoadedKeys[item.key] = size.width * size.height * 4.0 / 1024.0;
+  return true;
+}
+
+void ImagePoliciesBenchmark::CheckReload(Item& item, double duration)
+{
+  const bool ready = DevelControl::GetVisualResourceStatus(item.view, ImageView::Property::IMAGE) == Visual::ResourceStatus::READY;
+  if(!item.reloadCounted && mLoadedKeys.count(item.key) && (!ready || (mPolicies[mRun].synchronous && duration > CACHE_HIT_MAXIMUM_MS)))
+  {
+    item.reloadCounted = true;
+    ++mResults.back().reloads;
+  }
+}
+
+double ImagePoliciesBenchmark::EstimateTextureMemory()
+{
+  std::set<std::string> readyKeys;
+  for(auto& page : mPages)
+  {
+    for(Item& item : page)
+    {
+      if(RecordLoaded(item))
+      {
+        readyKeys.insert(item.key);
+      }
+    }
+  }
+
+  double kilobytes = 0.0;
+  for(const auto& key : mLoadedKeys)
+  {
+    if(mPolicies[mRun].releasePolicy == ImageVisual::ReleasePolicy::NEVER || readyKeys.count(key.first))
+    {
+      kilobytes += key.second;
+    }
+  }
+  return kilobytes;
+}
+
+void ImagePoliciesBenchmark::PrintResults()
+{
+  printf("\n%-9s %-9s %-5s %10s %10s %10s %10s %10s %10s %10s %8s %8s %10s\n", "load", "release", "sync", "peak(KB)", "steady(KB)", "gfx peak", "gfx steady", "ready(ms)", "p95(ms)", "max(ms)", "reloads", "timeouts", "step(ms)");
+
+  std::ofstream csv;
+  if(!mCsvPath.empty())
+  {
+    csv.open(mCsvPath);
+    if(csv.is_open())
+    {
+      csv << "load,release,synchronous,peakKb,steadyKb,graphicsPeakKb,graphicsSteadyKb,readyMeanMs,readyP95Ms,readyMaxMs,reloads,timeouts,longestStepMs\n";
+    }
+    else
+    {
+      std::cerr << "Unable to write the image policies benchmark to " << mCsvPath << std::endl;
+    }
+  }
+
+  for(const Result& result : mResults)
+  {
+    const double mean = result.readyMs.empty() ? 0.0 : std::accumulate(result.readyMs.begin(), result.readyMs.end(), 0.0) / result.readyMs.size();
+    const double p95  = GetPercentile(result.readyMs, 95.0);
+    const double max  = GetPercentile(result.readyMs, 100.0);
+
+    printf("%-9s %-9s %-5s %10.0f %10.0f %10.0f %10.0f %10.2f %10.2f %10.2f %8u %8u %10.2f\n",
+           GetName(result.policy.loadPolicy),
+           GetName(result.policy.releasePolicy),
+           result.policy.synchronous ? "yes" : "no",
+           result.peakKb,
+           result.steadyKb,
+           result.graphicsPeakKb,
+           result.graphicsSteadyKb,
+           mean,
+           p95,
+           max,
+           result.reloads,
+           result.timeouts,
+           result.longestStepMs);
+
+    if(csv.is_open())
+    {
+      csv << GetName(result.policy.loadPolicy) << ',' << GetName(result.policy.releasePolicy) << ',' << (result.policy.synchronous ? 1 : 0) << ','
+          << result.peakKb << ',' << result.steadyKb << ',' << result.graphicsPeakKb << ',' << result.graphicsSteadyKb << ','
+          << mean << ',' << p95 << ',' << max << ',' << result.reloads << ',' << result.timeouts << ',' << result.longestStepMs << '\n';
+    }
+  }
+}
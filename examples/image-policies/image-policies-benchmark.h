@@ -0,0 +1,196 @@
+#ifndef DALI_DEMO_IMAGE_POLICIES_BENCHMARK_H
+#define DALI_DEMO_IMAGE_POLICIES_BENCHMARK_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali-toolkit/dali-toolkit.h>
+#include <dali/dali.h>
+#include <chrono>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Runs the same scenario with every combination of LoadPolicy, ReleasePolicy & synchronous loading
+ * and prints a table comparing their memory use & latency.
+ *
+ * The scenario shows pages of images the way a recycling list would while it is scrolled: the page ahead of
+ * the visible one is created (so IMMEDIATE starts loading it), the page behind is removed from the window
+ * and the one behind that is destroyed. It scrolls to the last page, back to the first, then hides & shows
+ * the first page a few times.
+ *
+ * For each combination it records:
+ * - The texture memory, estimated from the natural sizes of the distinct images ready at the end of each step
+ *   at 4 bytes per pixel; with ReleasePolicy::NEVER every image loaded is counted as it is never released.
+ *   The peak is the largest estimate, the steady state the one left with a single page shown.
+ * - The graphics memory mapped by the driver (see DemoHelper::SampleMemoryUsage()) relative to the start of
+ *   the run, which is zero for drivers which do not map textures into the process.
+ * - The time from showing an image to it being ready; for synchronous loading, the time the call showing it
+ *   blocked for.
+ * - How many times images were loaded again after having been loaded once. With synchronous loading a
+ *   re-load is told apart from a cache hit by the call blocking for longer than a cache hit would.
+ * - The longest step, i.e. the most time spent in one go on the event thread creating & showing a page.
+ *
+ * Each combination loads its images at slightly different sizes, so they do not share the textures of the
+ * combinations run before; the combinations with ReleasePolicy::NEVER run last as their textures are kept.
+ */
+class ImagePoliciesBenchmark : public Dali::ConnectionTracker
+{
+public:
+  /**
+   * @brief Creates the benchmark, which runs once the application is initialised & quits when done.
+   * @param[in]  application  The application.
+   * @param[in]  imageCount   The number of different images shown, rounded up to whole pages.
+   * @param[in]  pageSize     The number of images on each page.
+   * @param[in]  csvPath      A file to write the results to as CSV as well, if not empty.
+   */
+  ImagePoliciesBenchmark(Dali::Application& application, unsigned int imageCount, unsigned int pageSize, const std::string& csvPath);
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  /**
+   * @brief A combination of policies.
+   */
+  struct Policy
+  {
+    Dali::Toolkit::ImageVisual::LoadPolicy::Type    loadPolicy;
+    Dali::Toolkit::ImageVisual::ReleasePolicy::Type releasePolicy;
+    bool                                            synchronous;
+  };
+
+  /**
+   * @brief The measurements of one combination.
+   */
+  struct Result
+  {
+    Policy              policy;
+    double              peakKb{0.0};
+    double              steadyKb{0.0};
+    double              graphicsPeakKb{0.0};
+    double              graphicsSteadyKb{0.0};
+    std::vector<double> readyMs;      ///< The time each image shown took to be ready
+    unsigned int        reloads{0u};  ///< Images loaded again after having been loaded once
+    unsigned int        timeouts{0u}; ///< Steps whose images were not all ready in time
+    double              longestStepMs{0.0};
+  };
+
+  /**
+   * @brief One step of the scenario; the pages are NONE if not used.
+   */
+  struct Step
+  {
+    int  destroy; ///< The page whose images are destroyed
+    int  hide;    ///< The page removed from the window
+    int  create;  ///< The page created ahead of being shown
+    int  show;    ///< The page added to the window, created first if needed
+    bool settle;  ///< Whether all but the shown page are destroyed & the memory left measured
+  };
+
+  /**
+   * @brief An image of a page.
+   */
+  struct Item
+  {
+    Dali::Toolkit::ImageView view;
+    std::string              key;                  ///< Identifies the image's texture: its url & size
+    Clock::time_point        shown;                ///< When it was added to the window
+    bool                     awaited{false};       ///< Whether it was shown but is not ready yet
+    bool                     reloadCounted{false}; ///< Whether its current load was counted as a re-load
+  };
+
+  static const int NONE = -1;
+
+  /**
+   * @brief Builds the container of the pages & starts the first run.
+   */
+  void Create(Dali::Application& application);
+
+  void StartRun();
+  void FinishRun();
+
+  /**
+   * @brief Starts the next step of the scenario, or finishes the run.
+   */
+  void StartStep();
+
+  /**
+   * @brief Checks whether the images of the current step are ready, then measures & moves on.
+   */
+  bool OnTick();
+
+  void OnResourceReady(Dali::Toolkit::Control control);
+
+  void CreatePage(int page);
+  void ShowPage(int page);
+  void HidePage(int page);
+  void DestroyPage(int page);
+
+  /**
+   * @brief Records an image being ready.
+   * @param[in]  item   The image.
+   * @param[in]  ready  When it was ready.
+   */
+  void OnItemReady(Item& item, Clock::time_point ready);
+
+  /**
+   * @brief Notes the image of an item as loaded in this run, with its estimated size, if it is ready.
+   * @return Whether the image is ready.
+   */
+  bool RecordLoaded(const Item& item);
+
+  /**
+   * @brief Counts a re-load if the item's image was loaded before and is not ready after the call starting its load.
+   * @param[in]  item      The image.
+   * @param[in]  duration  How long the call starting its load blocked for, in milliseconds.
+   */
+  void CheckReload(Item& item, double duration);
+
+  /**
+   * @brief Estimates the texture memory used by the images ready, in kilobytes.
+   */
+  double EstimateTextureMemory();
+
+  void PrintResults();
+
+private:
+  Dali::Application& mApplication;
+  unsigned int       mPageCount;
+  unsigned int       mPageSize;
+  std::string        mCsvPath;
+
+  Dali::Actor         mContainer;      ///< Holds the shown page
+  Dali::Vector2       mCellSize;       ///< The size of an image on the page
+  Dali::Timer         mTimer;          ///< Drives the steps
+  std::vector<Policy> mPolicies;       ///< The combinations to run, in order
+  std::vector<Step>   mSteps;          ///< The scenario run with each combination
+  std::vector<Result> mResults;        ///< The results of the combinations run so far
+  unsigned int        mRun;            ///< The index of the current policy
+  unsigned int        mStep;           ///< The index of the current step
+  Clock::time_point   mStepStart;      ///< When the current step's images were shown
+  Clock::time_point   mSettleStart;    ///< When the last step's images were all ready
+  bool                mSettling;       ///< Whether the last step is waiting to measure the steady state
+  double              mGraphicsBaseKb; ///< The graphics memory at the start of the run
+
+  std::vector<std::vector<Item>>          mPages;        ///< The images of each page, empty if not created
+  std::unordered_map<int, Item*>          mItemsByActor; ///< The images alive, by actor ID
+  std::unordered_map<std::string, double> mLoadedKeys;   ///< The images loaded in this run & their estimated size in kilobytes
+};
+
+#endif // DALI_DEMO_IMAGE_POLICIES_BENCHMARK_H
@@ -22,6 +22,8 @@
 #include <dali-toolkit/devel-api/visuals/image-visual-properties-devel.h>
 #include <dali/dali.h>
 #include <string>
+#include "image-policies-benchmark.h"
+#include "shared/launch-latency.h"
 #include "shared/view.h"
 
 using namespace Dali;
@@ -64,6 +66,9 @@ enum TableRowPlacement
  * image release polcy, image loading policy and exif data are currently demonstrated.
  * Large images are used to cause loading time to be long enough to show differences.
  * If hardware causes loading time improve then remote images or larger images may be required in future.
+ *
+ * Run with --benchmark [--images=N] [--page=N] [--csv=FILE] to compare every combination of the policies
+ * over many images instead, see ImagePoliciesBenchmark.
  */
 class ImagePolicies : public ConnectionTracker
 {
@@ -543,8 +548,39 @@ private:
 
 int DALI_EXPORT_API main(int argc, char** argv)
 {
-  Application   application = Application::New(&argc, &argv, DEMO_THEME_PATH);
+  Application application = Application::New(&argc, &argv, DEMO_THEME_PATH);
+
+  if(argc > 1 && std::string(argv[1]) == "--benchmark")
+  {
+    // Compare the policies over many images rather than demonstrating them one at a time
+    unsigned int imageCount = 240u;
+    unsigned int pageSize   = 24u;
+    std::string  csvPath;
+    for(int i = 2; i < argc; ++i)
+    {
+      std::string arg(argv[i]);
+      if(arg.compare(0, 9, "--images=") == 0)
+      {
+        imageCount = atoi(arg.substr(9).c_str());
+      }
+      else if(arg.compare(0, 7, "--page=") == 0)
+      {
+        pageSize = atoi(arg.substr(7).c_str());
+      }
+      else if(arg.compare(0, 6, "--csv=") == 0)
+      {
+        csvPath = arg.substr(6);
+      }
+    }
+
+    ImagePoliciesBenchmark benchmark(application, imageCount, pageSize, csvPath);
+    DemoHelper::ReportLaunchLatency(application);
+    application.MainLoop();
+    return 0;
+  }
+
   ImagePolicies test(application);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
   return 0;
 }
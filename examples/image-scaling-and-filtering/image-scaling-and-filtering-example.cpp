@@ -21,6 +21,7 @@
 #include <dali/dali.h>
 #include <dali/devel-api/actors/actor-devel.h>
 #include <iostream>
+#include "shared/launch-latency.h"
 #include "shared/view.h"
 
 using namespace Dali;
@@ -692,6 +693,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application                        application = Application::New(&argc, &argv, DEMO_THEME_PATH);
   ImageScalingAndFilteringController test(application);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
   return 0;
 }
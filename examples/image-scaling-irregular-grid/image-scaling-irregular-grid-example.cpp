@@ -24,8 +24,10 @@
  * reduce the image to save memory, improve performance, and potentially display
  * a better small version of the image than if the default size were loaded.
  *
- * The functions CreateImage and CreateImageView below show how to build an
- * image using a scaling mode to have %Dali resize it during loading.
+ * The ThumbnailLoader used below shows how to load an image at a given size
+ * & scaling mode on worker threads, loading the visible images first and
+ * keeping the decoded images so that changing the scaling mode does not
+ * decode them again.
  *
  * This demo defaults to the SCALE_TO_FILL mode of ImageAttributes which makes
  * sure that every pixel in the loaded image is filled with a source colour
@@ -38,22 +40,27 @@
  * grid  using the button in the top-right of the toolbar.
  * A single image can be cycled by clicking the image directly.
  *
- * @see CreateImage CreateImageView
+ * @see ThumbnailLoader CreateImageView
  */
 
 // EXTERNAL INCLUDES
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali-toolkit/devel-api/controls/control-devel.h>
 #include <dali-toolkit/devel-api/controls/scroll-bar/scroll-bar.h>
+#include <dali-toolkit/devel-api/image-loader/texture-manager.h>
 #include <algorithm>
 #include <chrono> // std::chrono::system_clock
 #include <iostream>
 #include <map>
+#include <memory>
 #include <random> // std::default_random_engine
+#include <set>
 
 // INTERNAL INCLUDES
 #include "grid-flags.h"
+#include "shared/launch-latency.h"
 #include "shared/view.h"
+#include "thumbnail-loader.h"
 
 using namespace Dali;
 using namespace Dali::Toolkit;
@@ -166,28 +173,20 @@ const char* IMAGE_PATHS[] = {
   DEMO_IMAGE_DIR "book-portrait-p1.jpg",
   DEMO_IMAGE_DIR "book-portrait-p2.jpg",
   NULL};
-const unsigned     NUM_IMAGE_PATHS        = sizeof(IMAGE_PATHS) / sizeof(IMAGE_PATHS[0]) - 1u;
-const unsigned int INITIAL_IMAGES_TO_LOAD = 10;
+const unsigned NUM_IMAGE_PATHS = sizeof(IMAGE_PATHS) / sizeof(IMAGE_PATHS[0]) - 1u;
+
+/** How much further away the images behind the direction of scrolling are treated as, so those ahead are prefetched first. */
+const float PREFETCH_BEHIND_PENALTY = 2.0f;
 
 /**
- * Creates an ImageView
+ * Creates an ImageView, without an image until its thumbnail is loaded.
  *
  * @param[in] filename The path of the image.
- * @param[in] width The width of the image in pixels.
- * @param[in] height The height of the image in pixels.
- * @param[in] fittingMode The mode to use when scaling the image to fit the desired dimensions.
  */
-ImageView CreateImageView(const std::string& filename, int width, int height, Dali::FittingMode::Type fittingMode)
+ImageView CreateImageView(const std::string& filename)
 {
   ImageView imageView = ImageView::New();
 
-  Property::Map map;
-  map[Toolkit::ImageVisual::Property::URL]            = filename;
-  map[Toolkit::ImageVisual::Property::DESIRED_WIDTH]  = width;
-  map[Toolkit::ImageVisual::Property::DESIRED_HEIGHT] = height;
-  map[Toolkit::ImageVisual::Property::FITTING_MODE]   = fittingMode;
-  imageView.SetProperty(Toolkit::ImageView::Property::IMAGE, map);
-
   imageView.SetProperty(Dali::Actor::Property::NAME, filename);
   imageView.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
   imageView.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::CENTER);
@@ -250,6 +249,20 @@ struct PositionedImage
   Vector2            imageGridDims;
 };
 
+/**
+ * An image in the grid & the state of its thumbnail.
+ */
+struct GridImage
+{
+  ImageView               view;
+  std::string             url;
+  Vector2                 position;    ///< The centre of the image in the grid
+  Vector2                 size;        ///< The size of the image in the grid
+  Dali::FittingMode::Type fittingMode; ///< The current scaling mode of the image
+  std::string             textureUrl;  ///< The thumbnail shown, added to the TextureManager
+  bool                    loaded;      ///< Whether the thumbnail shown is in the current scaling mode
+};
+
 } // namespace
 
 /**
@@ -261,7 +274,7 @@ public:
   ImageScalingIrregularGridController(Application& application)
   : mApplication(application),
     mScrolling(false),
-    mImagesLoaded(0)
+    mScrollDirection(0.0f)
   {
     std::cout << "ImageScalingIrregularGridController::ImageScalingIrregularGridController" << std::endl;
 
@@ -274,20 +287,6 @@ public:
     // Nothing to do here.
   }
 
-  /**
-   * Called everytime an ImageView has loaded it's image
-   */
-  void ResourceReadySignal(Toolkit::Control control)
-  {
-    mImagesLoaded++;
-    // To allow fast startup, we only place a small number of ImageViews on window first
-    if(mImagesLoaded == INITIAL_IMAGES_TO_LOAD)
-    {
-      // Adding the ImageViews to the window will trigger loading of the Images
-      mGridActor.Add(mOffWindowImageViews);
-    }
-  }
-
   /**
    * One-time setup in response to Application InitSignal.
    */
@@ -318,10 +317,8 @@ public:
 
     SetTitle(APPLICATION_TITLE);
 
-    mOffWindowImageViews = Actor::New();
-    mOffWindowImageViews.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::CENTER);
-    mOffWindowImageViews.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
-    mOffWindowImageViews.SetResizePolicy(ResizePolicy::FILL_TO_PARENT, Dimension::ALL_DIMENSIONS);
+    mThumbnailLoader.reset(new ThumbnailLoader([this](unsigned int id, PixelData pixels) { OnThumbnailLoaded(id, pixels); },
+                                               [this](unsigned int id) { return GetThumbnailPriority(id); }));
 
     // Build the main content of the widow:
     PopulateContentLayer(DEFAULT_SCALING_MODE);
@@ -341,6 +338,7 @@ public:
     mScrollView = ScrollView::New();
 
     mScrollView.ScrollStartedSignal().Connect(this, &ImageScalingIrregularGridController::OnScrollStarted);
+    mScrollView.ScrollUpdatedSignal().Connect(this, &ImageScalingIrregularGridController::OnScrollUpdated);
     mScrollView.ScrollCompletedSignal().Connect(this, &ImageScalingIrregularGridController::OnScrollCompleted);
 
     mScrollView.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::CENTER);
@@ -384,6 +382,16 @@ public:
 
     // Scroll to top of grid so first images loaded are on-screen:
     mScrollView.ScrollTo(Vector2(0, -1000000));
+
+    // Load the thumbnails, starting with those at the top of the grid:
+    mWindowSize     = windowSize;
+    mScrollPosition = Vector2(0.0f, rulerY->GetDomain().min);
+    for(unsigned id = 0; id < mImages.size(); ++id)
+    {
+      RequestThumbnail(id);
+    }
+    mThumbnailLoader->Dispatch();
+    AwaitVisibleThumbnails("Startup");
   }
 
   void OnScrollViewRelayout(Actor actor)
@@ -461,33 +469,23 @@ public:
     outFieldHeight           = actualGridHeight * cellHeight;
     const Vector2 gridOrigin = Vector2(-fieldWidth * 0.5f, -outFieldHeight * 0.5);
 
-    unsigned int count = 0;
     // Build the image actors in their right locations in their parent's frame:
-    for(std::vector<PositionedImage>::const_iterator i = placedImages.begin(), end = placedImages.end(); i != end; ++i, ++count)
+    for(std::vector<PositionedImage>::const_iterator i = placedImages.begin(), end = placedImages.end(); i != end; ++i)
     {
       const PositionedImage& imageSource       = *i;
       const Vector2          imageSize         = imageSource.imageGridDims * cellSize - Vector2(GRID_CELL_PADDING * 2, GRID_CELL_PADDING * 2);
       const Vector2          imageRegionCorner = gridOrigin + cellSize * Vector2(imageSource.cellX, imageSource.cellY);
       const Vector2          imagePosition     = imageRegionCorner + Vector2(GRID_CELL_PADDING, GRID_CELL_PADDING) + imageSize * 0.5f;
 
-      ImageView image = CreateImageView(imageSource.configuration.path, imageSize.x, imageSize.y, fittingMode);
+      ImageView image = CreateImageView(imageSource.configuration.path);
       image.SetProperty(Actor::Property::POSITION, Vector3(imagePosition.x, imagePosition.y, 0));
       image.SetProperty(Actor::Property::SIZE, imageSize);
       image.TouchedSignal().Connect(this, &ImageScalingIrregularGridController::OnTouchImage);
-      image.ResourceReadySignal().Connect(this, &ImageScalingIrregularGridController::ResourceReadySignal);
-      mFittingModes[image.GetProperty<int>(Actor::Property::ID)] = fittingMode;
-      mResourceUrls[image.GetProperty<int>(Actor::Property::ID)] = imageSource.configuration.path;
-      mSizes[image.GetProperty<int>(Actor::Property::ID)]        = imageSize;
-      if(count < INITIAL_IMAGES_TO_LOAD)
-      {
-        gridActor.Add(image);
-      }
-      else
-      {
-        // Store the ImageView in an offwindow actor until the inital batch of ImageViews have finished loading their images
-        // Required
-        mOffWindowImageViews.Add(image);
-      }
+      gridActor.Add(image);
+
+      // The thumbnails are requested once the scroll position is known
+      mImageIndices[image.GetProperty<int>(Actor::Property::ID)] = mImages.size();
+      mImages.push_back(GridImage{image, imageSource.configuration.path, imagePosition, imageSize, fittingMode, std::string(), false});
     }
 
     return gridActor;
@@ -510,23 +508,14 @@ public:
         animation.Play();
 
         // Change the scaling mode:
-        const unsigned          id        = actor.GetProperty<int>(Actor::Property::ID);
-        Dali::FittingMode::Type newMode   = NextMode(mFittingModes[id]);
-        const Vector2           imageSize = mSizes[actor.GetProperty<int>(Actor::Property::ID)];
-
-        ImageView imageView = ImageView::DownCast(actor);
-        if(imageView)
+        auto index = mImageIndices.find(actor.GetProperty<int>(Actor::Property::ID));
+        if(index != mImageIndices.end())
         {
-          Property::Map map;
-          map[Visual::Property::TYPE]                = Visual::IMAGE;
-          map[ImageVisual::Property::URL]            = mResourceUrls[id];
-          map[ImageVisual::Property::DESIRED_WIDTH]  = imageSize.width + 0.5f;
-          map[ImageVisual::Property::DESIRED_HEIGHT] = imageSize.height + 0.5f;
-          map[ImageVisual::Property::FITTING_MODE]   = newMode;
-          imageView.SetProperty(ImageView::Property::IMAGE, map);
+          GridImage& image  = mImages[index->second];
+          image.fittingMode = NextMode(image.fittingMode);
+          RequestThumbnail(index->second);
+          mThumbnailLoader->Dispatch();
         }
-
-        mFittingModes[id] = newMode;
       }
     }
     return false;
@@ -554,33 +543,114 @@ public:
   */
   bool OnToggleScalingTouched(Button button)
   {
-    const unsigned numChildren = mGridActor.GetChildCount();
+    for(unsigned id = 0; id < mImages.size(); ++id)
+    {
+      // Cycle the scaling mode options:
+      GridImage&              image   = mImages[id];
+      Dali::FittingMode::Type newMode = NextMode(image.fittingMode);
+      image.fittingMode               = newMode;
+      RequestThumbnail(id);
+
+      SetTitle(std::string(newMode == FittingMode::SHRINK_TO_FIT ? "SHRINK_TO_FIT" : newMode == FittingMode::SCALE_TO_FILL ? "SCALE_TO_FILL" : newMode == FittingMode::FIT_WIDTH ? "FIT_WIDTH" : "FIT_HEIGHT"));
+    }
+    mThumbnailLoader->Dispatch();
+    AwaitVisibleThumbnails("Scaling mode change");
+    return true;
+  }
+
+  /**
+   * Requests the thumbnail of an image in its current scaling mode.
+   * @param[in] id The index of the image in mImages.
+   */
+  void RequestThumbnail(unsigned id)
+  {
+    GridImage& image = mImages[id];
+    image.loaded     = false;
+    mThumbnailLoader->Request(id, image.url, ImageDimensions(image.size.width + 0.5f, image.size.height + 0.5f), image.fittingMode);
+  }
 
-    for(unsigned i = 0; i < numChildren; ++i)
+  /**
+   * Shows a thumbnail once it has been loaded.
+   * @param[in] id The index of the image in mImages.
+   * @param[in] pixels The thumbnail, empty if the image could not be loaded.
+   */
+  void OnThumbnailLoaded(unsigned int id, PixelData pixels)
+  {
+    GridImage& image = mImages[id];
+    if(pixels)
     {
-      ImageView gridImageView = ImageView::DownCast(mGridActor.GetChildAt(i));
-      if(gridImageView)
+      Texture texture = Texture::New(TextureType::TEXTURE_2D, pixels.GetPixelFormat(), pixels.GetWidth(), pixels.GetHeight());
+      texture.Upload(pixels);
+
+      const std::string textureUrl = TextureManager::AddTexture(texture);
+
+      Property::Map map;
+      map[Visual::Property::TYPE]     = Visual::IMAGE;
+      map[ImageVisual::Property::URL] = textureUrl;
+      image.view.SetProperty(ImageView::Property::IMAGE, map);
+
+      if(!image.textureUrl.empty())
       {
-        // Cycle the scaling mode options:
-        unsigned int id = gridImageView.GetProperty<int>(Actor::Property::ID);
+        TextureManager::RemoveTexture(image.textureUrl);
+      }
+      image.textureUrl = textureUrl;
+    }
+    image.loaded = true;
 
-        const Vector2           imageSize = mSizes[id];
-        Dali::FittingMode::Type newMode   = NextMode(mFittingModes[id]);
+    if(mAwaitedImages.erase(id) && mAwaitedImages.empty())
+    {
+      const ThumbnailLoader::Statistics& statistics = mThumbnailLoader->GetStatistics();
+      const double                       duration   = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - mAwaitedStart).count();
+      std::cout << mAwaitedReason << ": visible images complete in " << duration << " ms ("
+                << statistics.decoded - mAwaitedStatistics.decoded << " decoded, "
+                << statistics.cached - mAwaitedStatistics.cached << " from the cache of "
+                << mThumbnailLoader->GetCacheSize() / 1024u << " KiB)" << std::endl;
+    }
+  }
 
-        Property::Map map;
-        map[Visual::Property::TYPE]                = Visual::IMAGE;
-        map[ImageVisual::Property::URL]            = mResourceUrls[id];
-        map[ImageVisual::Property::DESIRED_WIDTH]  = imageSize.width;
-        map[ImageVisual::Property::DESIRED_HEIGHT] = imageSize.height;
-        map[ImageVisual::Property::FITTING_MODE]   = newMode;
-        gridImageView.SetProperty(ImageView::Property::IMAGE, map);
+  /**
+   * Retrieves the priority of loading a thumbnail: the visible images first, then the nearest ones, those
+   * in the direction of scrolling before those behind.
+   * @param[in] id The index of the image in mImages.
+   * @return The distance of the image from the visible area, negative if it is visible.
+   */
+  float GetThumbnailPriority(unsigned int id) const
+  {
+    const GridImage& image         = mImages[id];
+    const float      top           = image.position.y - image.size.height * 0.5f;
+    const float      bottom        = image.position.y + image.size.height * 0.5f;
+    const float      visibleTop    = mScrollPosition.y - mWindowSize.height * 0.5f;
+    const float      visibleBottom = mScrollPosition.y + mWindowSize.height * 0.5f;
 
-        mFittingModes[id] = newMode;
+    if(bottom < visibleTop)
+    {
+      return (visibleTop - bottom) * (mScrollDirection < 0.0f ? 1.0f : PREFETCH_BEHIND_PENALTY);
+    }
+    else if(top > visibleBottom)
+    {
+      return (top - visibleBottom) * (mScrollDirection > 0.0f ? 1.0f : PREFETCH_BEHIND_PENALTY);
+    }
+    return -1.0f;
+  }
 
-        SetTitle(std::string(newMode == FittingMode::SHRINK_TO_FIT ? "SHRINK_TO_FIT" : newMode == FittingMode::SCALE_TO_FILL ? "SCALE_TO_FILL" : newMode == FittingMode::FIT_WIDTH ? "FIT_WIDTH" : "FIT_HEIGHT"));
+  /**
+   * Starts timing how long the visible images take to show their thumbnail in the current scaling mode.
+   * @param[in] reason What the thumbnails are loaded for, printed with the time.
+   */
+  void AwaitVisibleThumbnails(const std::string& reason)
+  {
+    mAwaitedImages.clear();
+    for(unsigned id = 0; id < mImages.size(); ++id)
+    {
+      if(!mImages[id].loaded && GetThumbnailPriority(id) < 0.0f)
+      {
+        mAwaitedImages.insert(id);
       }
     }
-    return true;
+
+    mAwaitedReason     = reason;
+    mAwaitedStart      = std::chrono::steady_clock::now();
+    mAwaitedStatistics = mThumbnailLoader->GetStatistics();
   }
 
   /**
@@ -609,6 +679,19 @@ public:
     mScrolling = true;
   }
 
+  /**
+   * When the scroll position changes, note the direction, so the images ahead are loaded first.
+   * @param[in] position Current Scroll Position
+   */
+  void OnScrollUpdated(const Vector2& position)
+  {
+    if(position.y != mScrollPosition.y)
+    {
+      mScrollDirection = position.y > mScrollPosition.y ? 1.0f : -1.0f;
+    }
+    mScrollPosition = position;
+  }
+
   /**
    * When scroll starts (i.e. user stops dragging scrollview, and scrollview has snapped to destination),
    * note this state (mScrolling = false).
@@ -616,7 +699,9 @@ public:
    */
   void OnScrollCompleted(const Vector2& position)
   {
-    mScrolling = false;
+    mScrolling      = false;
+    mScrollPosition = position;
+    AwaitVisibleThumbnails("Scroll");
   }
 
 private:
@@ -627,21 +712,28 @@ private:
   Toolkit::ToolBar                            mToolBar;             ///< The View's Toolbar.
   TextLabel                                   mTitleActor;          ///< The Toolbar's Title.
   Actor                                       mGridActor;           ///< The container for the grid of images
-  Actor                                       mOffWindowImageViews; ///< ImageViews held off window until the inital batch have loaded their images
   ScrollView                                  mScrollView;          ///< ScrollView UI Component
   ScrollBar                                   mScrollBarVertical;
   ScrollBar                                   mScrollBarHorizontal;
-  bool                                        mScrolling;    ///< ScrollView scrolling state (true = scrolling, false = stationary)
-  std::map<unsigned, Dali::FittingMode::Type> mFittingModes; ///< Stores the current scaling mode of each image, keyed by image actor id.
-  std::map<unsigned, std::string>             mResourceUrls; ///< Stores the url of each image, keyed by image actor id.
-  std::map<unsigned, Vector2>                 mSizes;        ///< Stores the current size of each image, keyed by image actor id.
-  unsigned int                                mImagesLoaded; ///< How many images have been loaded
+  bool                                        mScrolling;       ///< ScrollView scrolling state (true = scrolling, false = stationary)
+  Vector2                                     mScrollPosition;  ///< The last scroll position, the centre of the visible area of the grid
+  float                                       mScrollDirection; ///< The sign of the last vertical scroll movement
+  Vector2                                     mWindowSize;      ///< The size of the visible area of the grid
+  std::vector<GridImage>                      mImages;          ///< The images of the grid, indexed by the id of their thumbnail request
+  std::map<unsigned, unsigned>                mImageIndices;    ///< Stores the index in mImages of each image, keyed by image actor id.
+  std::unique_ptr<ThumbnailLoader>            mThumbnailLoader; ///< Loads the thumbnails of the images, the visible ones first
+
+  std::set<unsigned>                    mAwaitedImages;     ///< The visible images whose thumbnail is being timed
+  std::string                           mAwaitedReason;     ///< Why they are being loaded
+  std::chrono::steady_clock::time_point mAwaitedStart;      ///< When they started to load
+  ThumbnailLoader::Statistics           mAwaitedStatistics; ///< The loader's statistics when they started to load
 };
 
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application                         application = Application::New(&argc, &argv, DEMO_THEME_PATH);
   ImageScalingIrregularGridController test(application);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
   return 0;
 }
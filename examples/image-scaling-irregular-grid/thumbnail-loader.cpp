@@ -0,0 +1,378 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include "thumbnail-loader.h"
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/image-loading.h>
+#include <dali/devel-api/adaptor-framework/pixel-buffer.h>
+#include <dali/public-api/images/pixel.h>
+#include <dali/public-api/signals/callback.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <thread>
+
+namespace Dali
+{
+namespace Demo
+{
+namespace
+{
+const unsigned int MAXIMUM_THREADS = 4u; ///< Decoding is memory bound, more threads do not help
+
+/**
+ * The decoded images scaled by at most this much are still used rather than decoding again, so that the
+ * rounding of the decoder's output size does not prevent using them.
+ */
+const float MAXIMUM_UPSCALE = 1.02f;
+
+/**
+ * Whether a format has 8 bits for each of its channels, so it can be averaged byte by byte.
+ */
+bool IsByteFormat(Pixel::Format format)
+{
+  switch(format)
+  {
+    case Pixel::A8:
+    case Pixel::L8:
+    case Pixel::LA88:
+    case Pixel::RGB888:
+    case Pixel::RGB8888:
+    case Pixel::BGR8888:
+    case Pixel::RGBA8888:
+    case Pixel::BGRA8888:
+    {
+      return true;
+    }
+    default:
+    {
+      return false;
+    }
+  }
+}
+
+/**
+ * Resamples an image by averaging the source pixels which fall within each output pixel.
+ */
+void Resample(const uint8_t* source, uint32_t sourceWidth, uint32_t sourceHeight, uint32_t bytesPerPixel, uint8_t* output, uint32_t width, uint32_t height)
+{
+  std::vector<uint32_t> columns(width + 1u);
+  for(uint32_t x = 0u; x <= width; ++x)
+  {
+    columns[x] = static_cast<uint32_t>(uint64_t(x) * sourceWidth / width);
+  }
+
+  std::vector<uint32_t> sums(bytesPerPixel);
+  for(uint32_t y = 0u; y < height; ++y)
+  {
+    const uint32_t top    = static_cast<uint32_t>(uint64_t(y) * sourceHeight / height);
+    const uint32_t bottom = std::max(top + 1u, static_cast<uint32_t>(uint64_t(y + 1u) * sourceHeight / height));
+    for(uint32_t x = 0u; x < width; ++x)
+    {
+      const uint32_t left  = columns[x];
+      const uint32_t right = std::max(left + 1u, columns[x + 1u]);
+
+      std::fill(sums.begin(), sums.end(), 0u);
+      for(uint32_t row = top; row < bottom; ++row)
+      {
+        const uint8_t* pixel = source + (size_t(row) * sourceWidth + left) * bytesPerPixel;
+        for(uint32_t column = left; column < right; ++column)
+        {
+          for(uint32_t channel = 0u; channel < bytesPerPixel; ++channel)
+          {
+            sums[channel] += *pixel++;
+          }
+        }
+      }
+
+      const uint32_t count = (bottom - top) * (right - left);
+      for(uint32_t channel = 0u; channel < bytesPerPixel; ++channel)
+      {
+        *output++ = static_cast<uint8_t>((sums[channel] + count / 2u) / count);
+      }
+    }
+  }
+}
+
+/**
+ * Copies a pixel buffer into memory owned by the result, so it can be handed to a PixelData.
+ */
+void CopyPixels(Devel::PixelBuffer pixelBuffer, std::unique_ptr<uint8_t[]>& pixels, uint32_t& width, uint32_t& height, Pixel::Format& format)
+{
+  width  = pixelBuffer.GetWidth();
+  height = pixelBuffer.GetHeight();
+  format = pixelBuffer.GetPixelFormat();
+
+  const size_t size = size_t(width) * height * Pixel::GetBytesPerPixel(format);
+  pixels.reset(new uint8_t[size]);
+  memcpy(pixels.get(), pixelBuffer.GetBuffer(), size);
+}
+
+} // namespace
+
+ThumbnailLoader::ThumbnailLoader(LoadedFunction loaded, PriorityFunction priority, size_t cacheBytes)
+: mLoaded(loaded),
+  mPriority(priority),
+  mMaximumInFlight(0u),
+  mCacheSize(0u),
+  mCacheCapacity(cacheBytes),
+  mCompleted(new EventThreadCallback(MakeCallback(this, &ThumbnailLoader::OnCompleted))),
+  mPool(std::min(std::max(std::thread::hardware_concurrency(), 1u), MAXIMUM_THREADS))
+{
+  // Only keep the threads busy, so the remaining requests are dispatched by their latest priorities
+  mMaximumInFlight = mPool.GetThreadCount() * 2u;
+}
+
+ThumbnailLoader::~ThumbnailLoader() = default;
+
+void ThumbnailLoader::Request(unsigned int id, const std::string& url, ImageDimensions size, FittingMode::Type fittingMode)
+{
+  mRequests[id] = PendingRequest{url, size, fittingMode};
+  ++mGenerations[id];
+}
+
+void ThumbnailLoader::Dispatch()
+{
+  while(mInFlight.size() < mMaximumInFlight)
+  {
+    auto  next         = mRequests.end();
+    float nextPriority = 0.0f;
+    for(auto request = mRequests.begin(); request != mRequests.end(); ++request)
+    {
+      // A superseded request still being loaded has to finish first, as its decoded image may be reused
+      if(mInFlight.count(request->first) == 0u)
+      {
+        const float priority = mPriority(request->first);
+        if(next == mRequests.end() || priority < nextPriority)
+        {
+          next         = request;
+          nextPriority = priority;
+        }
+      }
+    }
+
+    if(next == mRequests.end())
+    {
+      break;
+    }
+
+    Task task;
+    task.id          = next->first;
+    task.generation  = mGenerations[task.id];
+    task.url         = next->second.url;
+    task.size        = next->second.size;
+    task.fittingMode = next->second.fittingMode;
+    task.key         = task.url + "@" + std::to_string(task.size.GetWidth()) + "x" + std::to_string(task.size.GetHeight());
+    task.cover       = FindCachedImage(task.key);
+
+    mRequests.erase(next);
+    mInFlight.insert(task.id);
+
+    mPool.Submit([this, task]() {
+      Result result = Load(task);
+      {
+        std::lock_guard<std::mutex> lock(mResultsMutex);
+        mResults.push_back(std::move(result));
+      }
+      mCompleted->Trigger();
+    });
+  }
+}
+
+ThumbnailLoader::Result ThumbnailLoader::Load(const Task& task)
+{
+  Result result;
+  result.id         = task.id;
+  result.generation = task.generation;
+  result.key        = task.key;
+
+  const uint32_t width  = task.size.GetWidth();
+  const uint32_t height = task.size.GetHeight();
+
+  std::shared_ptr<const Image> cover = task.cover;
+  if(!cover)
+  {
+    // Decode the image just large enough to cover the thumbnail, so any fitting mode can be made from it
+    const ImageDimensions original = GetOriginalImageSize(task.url);
+    const float           scale    = original.GetWidth() && original.GetHeight() ? std::max(float(width) / original.GetWidth(), float(height) / original.GetHeight()) : 0.0f;
+    if(scale > 0.0f && scale < 1.0f)
+    {
+      const ImageDimensions coverSize(static_cast<uint16_t>(std::ceil(original.GetWidth() * scale)), static_cast<uint16_t>(std::ceil(original.GetHeight() * scale)));
+      Devel::PixelBuffer    pixelBuffer = LoadImageFromFile(task.url, coverSize, FittingMode::SHRINK_TO_FIT, SamplingMode::BOX_THEN_LINEAR);
+      if(pixelBuffer && IsByteFormat(pixelBuffer.GetPixelFormat()))
+      {
+        auto image    = std::make_shared<Image>();
+        image->width  = pixelBuffer.GetWidth();
+        image->height = pixelBuffer.GetHeight();
+        image->format = pixelBuffer.GetPixelFormat();
+        image->pixels.assign(pixelBuffer.GetBuffer(), pixelBuffer.GetBuffer() + size_t(image->width) * image->height * Pixel::GetBytesPerPixel(image->format));
+
+        cover          = image;
+        result.cover   = image;
+        result.decoded = true;
+      }
+    }
+  }
+
+  const float coverScale = cover ? std::max(float(width) / cover->width, float(height) / cover->height) : 0.0f;
+  if(!cover || coverScale > MAXIMUM_UPSCALE)
+  {
+    // The image is smaller than the thumbnail (which the image loader would not enlarge) or in a format
+    // which cannot be averaged, so let the image loader fit it.
+    Devel::PixelBuffer pixelBuffer = LoadImageFromFile(task.url, task.size, task.fittingMode, SamplingMode::BOX_THEN_LINEAR);
+    if(pixelBuffer)
+    {
+      CopyPixels(pixelBuffer, result.pixels, result.width, result.height, result.format);
+    }
+    result.cover.reset();
+    result.decoded = true;
+    return result;
+  }
+
+  // Scale the image as the fitting mode requires, then crop or pad it (centred) to the thumbnail's size
+  const float widthScale  = float(width) / cover->width;
+  const float heightScale = float(height) / cover->height;
+  float       scale       = coverScale;
+  switch(task.fittingMode)
+  {
+    case FittingMode::SHRINK_TO_FIT:
+    {
+      scale = std::min(widthScale, heightScale);
+      break;
+    }
+    case FittingMode::FIT_WIDTH:
+    {
+      scale = widthScale;
+      break;
+    }
+    case FittingMode::FIT_HEIGHT:
+    {
+      scale = heightScale;
+      break;
+    }
+    case FittingMode::SCALE_TO_FILL:
+    default:
+    {
+      break;
+    }
+  }
+
+  const uint32_t bytesPerPixel = Pixel::GetBytesPerPixel(cover->format);
+  const uint32_t scaledWidth   = std::max(1u, static_cast<uint32_t>(cover->width * scale + 0.5f));
+  const uint32_t scaledHeight  = std::max(1u, static_cast<uint32_t>(cover->height * scale + 0.5f));
+
+  std::vector<uint8_t> scaled;
+  const uint8_t*       scaledPixels = cover->pixels.data();
+  if(scaledWidth != cover->width || scaledHeight != cover->height)
+  {
+    scaled.resize(size_t(scaledWidth) * scaledHeight * bytesPerPixel);
+    Resample(cover->pixels.data(), cover->width, cover->height, bytesPerPixel, scaled.data(), scaledWidth, scaledHeight);
+    scaledPixels = scaled.data();
+  }
+
+  const size_t rowSize = size_t(width) * bytesPerPixel;
+  result.width         = width;
+  result.height        = height;
+  result.format        = cover->format;
+  result.pixels.reset(new uint8_t[rowSize * height]());
+
+  const uint32_t sourceX   = scaledWidth > width ? (scaledWidth - width) / 2u : 0u;
+  const uint32_t sourceY   = scaledHeight > height ? (scaledHeight - height) / 2u : 0u;
+  const uint32_t outputX   = width > scaledWidth ? (width - scaledWidth) / 2u : 0u;
+  const uint32_t outputY   = height > scaledHeight ? (height - scaledHeight) / 2u : 0u;
+  const uint32_t copyWidth = std::min(width, scaledWidth);
+  const uint32_t copyRows  = std::min(height, scaledHeight);
+  for(uint32_t row = 0u; row < copyRows; ++row)
+  {
+    memcpy(result.pixels.get() + (outputY + row) * rowSize + outputX * bytesPerPixel,
+           scaledPixels + ((size_t(sourceY) + row) * scaledWidth + sourceX) * bytesPerPixel,
+           size_t(copyWidth) * bytesPerPixel);
+  }
+
+  return result;
+}
+
+void ThumbnailLoader::OnCompleted()
+{
+  std::vector<Result> results;
+  {
+    std::lock_guard<std::mutex> lock(mResultsMutex);
+    results.swap(mResults);
+  }
+
+  for(Result& result : results)
+  {
+    mInFlight.erase(result.id);
+    if(result.cover)
+    {
+      CacheImage(result.key, result.cover);
+    }
+    ++(result.decoded ? mStatistics.decoded : mStatistics.cached);
+
+    if(result.generation == mGenerations[result.id])
+    {
+      PixelData pixels;
+      if(result.pixels)
+      {
+        const uint32_t size = result.width * result.height * Pixel::GetBytesPerPixel(result.format);
+        pixels              = PixelData::New(result.pixels.release(), size, result.width, result.height, result.format, PixelData::DELETE_ARRAY);
+      }
+      mLoaded(result.id, pixels);
+    }
+  }
+
+  Dispatch();
+}
+
+std::shared_ptr<const ThumbnailLoader::Image> ThumbnailLoader::FindCachedImage(const std::string& key)
+{
+  auto entry = mCache.find(key);
+  if(entry == mCache.end())
+  {
+    return nullptr;
+  }
+
+  mRecentlyUsed.splice(mRecentlyUsed.begin(), mRecentlyUsed, entry->second.position);
+  return entry->second.image;
+}
+
+void ThumbnailLoader::CacheImage(const std::string& key, std::shared_ptr<const Image> image)
+{
+  if(mCache.count(key))
+  {
+    return; // Decoded twice by requests dispatched together
+  }
+
+  mRecentlyUsed.push_front(key);
+  mCache[key] = CacheEntry{image, mRecentlyUsed.begin()};
+  mCacheSize += image->pixels.size();
+
+  while(mCacheSize > mCacheCapacity && mRecentlyUsed.size() > 1u)
+  {
+    auto evicted = mCache.find(mRecentlyUsed.back());
+    mCacheSize -= evicted->second.image->pixels.size();
+    mCache.erase(evicted);
+    mRecentlyUsed.pop_back();
+    ++mStatistics.evicted;
+  }
+}
+
+} // namespace Demo
+
+} // namespace Dali
@@ -0,0 +1,207 @@
+#ifndef DALI_DEMO_THUMBNAIL_LOADER_H
+#define DALI_DEMO_THUMBNAIL_LOADER_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/event-thread-callback.h>
+#include <dali/public-api/images/image-operations.h>
+#include <dali/public-api/images/pixel-data.h>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include "shared/thread-pool.h"
+
+namespace Dali
+{
+namespace Demo
+{
+/**
+ * @brief Loads thumbnails of images at a given size & fitting mode on worker threads, the most urgent first.
+ *
+ * Each image is decoded once for each size, just large enough to cover it, and kept in a least recently
+ * used cache. The fitting modes are cropped, scaled & padded from that, the way the image loader would, so
+ * changing the fitting mode of a thumbnail does not decode its image again.
+ */
+class ThumbnailLoader
+{
+public:
+  /**
+   * @brief Called on the event thread with the pixels of a requested thumbnail, empty if it could not be loaded.
+   */
+  using LoadedFunction = std::function<void(unsigned int id, PixelData pixels)>;
+
+  /**
+   * @brief Called on the event thread to retrieve the priority of a pending request; the lowest is loaded first.
+   */
+  using PriorityFunction = std::function<float(unsigned int id)>;
+
+  /**
+   * @brief The work done since the loader was created.
+   */
+  struct Statistics
+  {
+    unsigned int decoded{0u}; ///< Thumbnails for which the image had to be decoded
+    unsigned int cached{0u};  ///< Thumbnails made from a decoded image in the cache
+    unsigned int evicted{0u}; ///< Decoded images dropped from the cache to keep it within its budget
+  };
+
+  /**
+   * @brief Creates the loader & starts its threads; must be called on the event thread.
+   * @param[in]  loaded      Called with each thumbnail loaded.
+   * @param[in]  priority    Called to choose the next request to load.
+   * @param[in]  cacheBytes  The most memory used by the decoded images kept.
+   */
+  ThumbnailLoader(LoadedFunction loaded, PriorityFunction priority, size_t cacheBytes = 64u * 1024u * 1024u);
+
+  ~ThumbnailLoader();
+
+  /**
+   * @brief Requests a thumbnail, replacing any earlier request with the same id which has not been loaded yet.
+   *
+   * It is loaded once dispatched, so a batch of requests can be made before choosing the most urgent.
+   * @param[in]  id           Identifies the thumbnail in the callbacks.
+   * @param[in]  url          The image file.
+   * @param[in]  size         The size of the thumbnail in pixels.
+   * @param[in]  fittingMode  How the image is fitted to that size.
+   */
+  void Request(unsigned int id, const std::string& url, ImageDimensions size, FittingMode::Type fittingMode);
+
+  /**
+   * @brief Starts loading the most urgent requests, e.g. after making requests or changing their priorities.
+   */
+  void Dispatch();
+
+  const Statistics& GetStatistics() const
+  {
+    return mStatistics;
+  }
+
+  /**
+   * @brief Retrieves the memory used by the decoded images kept, in bytes.
+   */
+  size_t GetCacheSize() const
+  {
+    return mCacheSize;
+  }
+
+  ThumbnailLoader(const ThumbnailLoader&) = delete;
+  ThumbnailLoader& operator=(const ThumbnailLoader&) = delete;
+
+private:
+  /**
+   * @brief Decoded pixels; only formats with 8 bits per channel are kept.
+   */
+  struct Image
+  {
+    std::vector<uint8_t> pixels;
+    uint32_t             width{0u};
+    uint32_t             height{0u};
+    Pixel::Format        format{Pixel::RGBA8888};
+  };
+
+  /**
+   * @brief A request being loaded by a worker thread.
+   */
+  struct Task
+  {
+    unsigned int                 id{0u};
+    unsigned int                 generation{0u};
+    std::string                  url;
+    ImageDimensions              size;
+    FittingMode::Type            fittingMode{FittingMode::DEFAULT};
+    std::string                  key;   ///< The cache key of the decoded image
+    std::shared_ptr<const Image> cover; ///< The decoded image, if it was cached
+  };
+
+  /**
+   * @brief A thumbnail loaded by a worker thread.
+   */
+  struct Result
+  {
+    unsigned int                 id{0u};
+    unsigned int                 generation{0u};
+    std::string                  key;
+    std::shared_ptr<const Image> cover; ///< The image decoded for the task, to cache
+    std::unique_ptr<uint8_t[]>   pixels;
+    uint32_t                     width{0u};
+    uint32_t                     height{0u};
+    Pixel::Format                format{Pixel::RGBA8888};
+    bool                         decoded{false}; ///< Whether the image was decoded rather than taken from the cache
+  };
+
+  struct PendingRequest
+  {
+    std::string       url;
+    ImageDimensions   size;
+    FittingMode::Type fittingMode;
+  };
+
+  struct CacheEntry
+  {
+    std::shared_ptr<const Image>     image;
+    std::list<std::string>::iterator position; ///< In mRecentlyUsed
+  };
+
+  /**
+   * @brief Loads a thumbnail; runs on a worker thread.
+   */
+  static Result Load(const Task& task);
+
+  /**
+   * @brief Hands the results of the worker threads to the loaded function.
+   */
+  void OnCompleted();
+
+  std::shared_ptr<const Image> FindCachedImage(const std::string& key);
+  void                         CacheImage(const std::string& key, std::shared_ptr<const Image> image);
+
+private:
+  LoadedFunction   mLoaded;
+  PriorityFunction mPriority;
+
+  std::unordered_map<unsigned int, PendingRequest> mRequests;        ///< The requests not dispatched yet, by id
+  std::unordered_map<unsigned int, unsigned int>   mGenerations;     ///< The latest request of each id, so superseded results are dropped
+  std::unordered_set<unsigned int>                 mInFlight;        ///< The ids being loaded
+  unsigned int                                     mMaximumInFlight; ///< The most requests loaded at once, so the rest can be reprioritised
+
+  std::unordered_map<std::string, CacheEntry> mCache;         ///< The decoded images, by url & size
+  std::list<std::string>                      mRecentlyUsed;  ///< The keys of mCache, most recently used first
+  size_t                                      mCacheSize;     ///< The bytes used by mCache
+  size_t                                      mCacheCapacity; ///< The most bytes used by mCache
+  Statistics                                  mStatistics;
+
+  std::mutex                           mResultsMutex; ///< Guards mResults
+  std::vector<Result>                  mResults;      ///< Loaded by the worker threads, not handed on yet
+  std::unique_ptr<EventThreadCallback> mCompleted;    ///< Triggered by the worker threads when they add a result
+  DemoHelper::ThreadPool               mPool;         ///< Last, so its threads finish before the members they use are destroyed
+};
+
+} // namespace Demo
+
+} // namespace Dali
+
+#endif // DALI_DEMO_THUMBNAIL_LOADER_H
@@ -19,6 +19,8 @@
 #include <dali-toolkit/devel-api/image-loader/texture-manager.h>
 #include <dali-toolkit/devel-api/visuals/visual-properties-devel.h>
 
+#include "shared/launch-latency.h"
+
 using namespace Dali;
 
 namespace
@@ -142,6 +144,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application            application = Application::New(&argc, &argv);
   ImageViewAlphaBlendApp test(application);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
   return 0;
 }
@@ -17,6 +17,7 @@
 
 #include <dali-toolkit/dali-toolkit.h>
 
+#include "shared/launch-latency.h"
 #include "shared/view.h"
 
 using namespace Dali;
@@ -235,6 +236,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application           application = Application::New(&argc, &argv);
   ImageViewPixelAreaApp test(application);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
   return 0;
 }
@@ -19,6 +19,8 @@
 #include <dali/devel-api/actors/actor-devel.h>
 #include <string.h>
 
+#include "shared/launch-latency.h"
+
 using namespace Dali;
 
 namespace
@@ -258,6 +260,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application        application = Application::New(&argc, &argv);
   ImageSvgController test(application);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
   return 0;
 }
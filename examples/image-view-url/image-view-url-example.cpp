@@ -18,6 +18,7 @@
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali-toolkit/devel-api/image-loader/texture-manager.h>
 
+#include "shared/launch-latency.h"
 #include "shared/view.h"
 
 using namespace Dali;
@@ -216,6 +217,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
   }
 
   ImageViewUrlApp test(application, url);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
   return 0;
 }
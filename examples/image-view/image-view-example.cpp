@@ -22,6 +22,7 @@
 #include <dali-toolkit/devel-api/visuals/visual-properties-devel.h>
 #include <dali/dali.h>
 #include <string>
+#include "shared/launch-latency.h"
 #include "shared/view.h"
 
 using namespace Dali;
@@ -282,6 +283,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application         application = Application::New(&argc, &argv, DEMO_THEME_PATH);
   ImageViewController test(application);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
   return 0;
 }
@@ -15,7 +15,10 @@
  *
  */
 
+#include <iostream>
 #include <sstream>
+#include "shared/launch-latency.h"
+#include "shared/pooled-item-factory.h"
 #include "shared/view.h"
 
 #include <dali-toolkit/dali-toolkit.h>
@@ -159,7 +162,7 @@ static Vector3 DepthLayoutItemSizeFunctionLandscape(float layoutWidth)
  * There is one button in the upper-left corner for quitting the application and
  * another button in the upper-right corner for switching between different layouts.
  */
-class ItemViewExample : public ConnectionTracker, public ItemFactory
+class ItemViewExample : public ConnectionTracker, public DemoHelper::PooledItemFactory
 {
 public:
   enum Mode
@@ -189,6 +192,13 @@ public:
     mApplication.InitSignal().Connect(this, &ItemViewExample::OnInit);
   }
 
+  ~ItemViewExample()
+  {
+    const Statistics& statistics = GetStatistics();
+    std::cout << "Item actors: " << statistics.hits << " reused, " << statistics.misses << " created, "
+              << statistics.released << " released to the pool, " << statistics.discarded << " discarded" << std::endl;
+  }
+
   /**
    * This method gets called once the main loop of application is up and running
    */
@@ -855,22 +865,17 @@ public: // From ItemFactory
     return NUM_IMAGES * 10;
   }
 
+protected: // From PooledItemFactory
   /**
-   * Create an Actor to represent a visible item.
-   * @param itemId
+   * Create an Actor to represent a visible item, the same for all items.
+   * @param type The type of item, always 0
    * @return the created actor.
    */
-  virtual Actor NewItem(unsigned int itemId)
+  Actor CreateItem(unsigned int type) override
   {
-    // Create an image view for this item
-    Property::Map propertyMap;
-    propertyMap.Insert(Toolkit::Visual::Property::TYPE, Visual::IMAGE);
-    propertyMap.Insert(ImageVisual::Property::URL, IMAGE_PATHS[itemId % NUM_IMAGES]);
-    propertyMap.Insert(DevelVisual::Property::VISUAL_FITTING_MODE, DevelVisual::FILL);
+    // Create an image view for the items
     ImageView actor = ImageView::New();
-    actor.SetProperty(Toolkit::ImageView::Property::IMAGE, propertyMap);
     actor.SetProperty(Actor::Property::POSITION_Z, 0.0f);
-    actor.SetProperty(Actor::Property::POSITION, INITIAL_OFFSCREEN_POSITION);
 
     // Add a border image child actor
     ImageView borderActor = ImageView::New();
@@ -909,13 +914,6 @@ public: // From ItemFactory
     solidColorProperty.Insert(Toolkit::Visual::Property::TYPE, Visual::COLOR);
     solidColorProperty.Insert(ColorVisual::Property::MIX_COLOR, Vector4(0.f, 0.f, 0.f, 0.6f));
     checkbox.SetProperty(ImageView::Property::IMAGE, solidColorProperty);
-
-    if(MODE_REMOVE_MANY != mMode &&
-       MODE_INSERT_MANY != mMode &&
-       MODE_REPLACE_MANY != mMode)
-    {
-      checkbox.SetProperty(Actor::Property::VISIBLE, false);
-    }
     borderActor.Add(checkbox);
 
     ImageView tick = ImageView::New(SELECTED_IMAGE);
@@ -925,16 +923,35 @@ public: // From ItemFactory
     tick.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_RIGHT);
     tick.SetProperty(Actor::Property::SIZE, Vector2(spiralItemSize.width * 0.2f, spiralItemSize.width * 0.2f));
     tick.SetProperty(Actor::Property::POSITION_Z, 0.2f);
-    tick.SetProperty(Actor::Property::VISIBLE, false);
     checkbox.Add(tick);
 
+    return actor;
+  }
+
+  /**
+   * Set the image & state of a new or reused actor for an item.
+   * @param itemId
+   * @param actor The actor created by CreateItem()
+   */
+  void BindItem(unsigned int itemId, Actor actor) override
+  {
+    Property::Map propertyMap;
+    propertyMap.Insert(Toolkit::Visual::Property::TYPE, Visual::IMAGE);
+    propertyMap.Insert(ImageVisual::Property::URL, IMAGE_PATHS[itemId % NUM_IMAGES]);
+    propertyMap.Insert(DevelVisual::Property::VISUAL_FITTING_MODE, DevelVisual::FILL);
+    actor.SetProperty(Toolkit::ImageView::Property::IMAGE, propertyMap);
+    actor.SetProperty(Actor::Property::POSITION, INITIAL_OFFSCREEN_POSITION);
+
+    // A reused item may have been selected or shown in another mode
+    Actor checkbox = actor.FindChildByName("CheckBox");
+    checkbox.SetProperty(Actor::Property::VISIBLE, MODE_REMOVE_MANY == mMode || MODE_INSERT_MANY == mMode || MODE_REPLACE_MANY == mMode);
+    checkbox.FindChildByName("Tick").SetProperty(Actor::Property::VISIBLE, false);
+
     // Connect new items for various editing modes
     if(mTapDetector)
     {
       mTapDetector.Attach(actor);
     }
-
-    return actor;
   }
 
 private:
@@ -999,6 +1016,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application     app = Application::New(&argc, &argv, DEMO_THEME_PATH);
   ItemViewExample test(app);
+  DemoHelper::ReportLaunchLatency(app);
   app.MainLoop();
   return 0;
 }
@@ -21,6 +21,7 @@
 #include <dali/devel-api/actors/actor-devel.h>
 
 // INTERNAL INCLUDES
+#include "shared/launch-latency.h"
 #include "shared/view.h"
 
 #include <sstream>
@@ -385,6 +386,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application       application = Application::New(&argc, &argv);
   ExampleController test(application);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
   return 0;
 }
@@ -18,6 +18,7 @@
 // EXTERNAL INCLUDES
 
 // INTERNAL INCLUDES
+#include "shared/launch-latency.h"
 #include "shared/view.h"
 
 #include <dali-toolkit/dali-toolkit.h>
@@ -400,6 +401,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application       application = Application::New(&argc, &argv, DEMO_THEME_PATH);
   ExampleController test(application);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
   return 0;
 }
@@ -27,6 +27,7 @@
 #include <dali/public-api/rendering/texture.h>
 
 // INTERNAL INCLUDES
+#include "shared/launch-latency.h"
 #include "shared/utility.h" // DemoHelper::LoadTexture
 
 using namespace Dali;
@@ -688,6 +689,7 @@ int32_t DALI_EXPORT_API main(int argc, char** argv)
 
   MetaballExplosionController test(application);
 
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
 
   return 0;
@@ -26,6 +26,7 @@
 #include <dali/public-api/rendering/texture.h>
 
 // INTERNAL INCLUDES
+#include "shared/launch-latency.h"
 #include "shared/utility.h" // DemoHelper::LoadTexture
 
 using namespace Dali;
@@ -781,6 +782,7 @@ int32_t DALI_EXPORT_API main(int argc, char** argv)
   Application application = Application::New(&argc, &argv);
 
   MetaballRefracController test(application);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
 
   return 0;
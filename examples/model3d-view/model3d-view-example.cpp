@@ -17,6 +17,8 @@
 
 #include <dali-toolkit/dali-toolkit.h>
 
+#include "shared/launch-latency.h"
+
 using namespace Dali;
 using Dali::Toolkit::Model3dView;
 
@@ -295,6 +297,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application           application = Application::New(&argc, &argv);
   Model3dViewController test(application);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
   return 0;
 }
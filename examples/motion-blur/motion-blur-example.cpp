@@ -22,6 +22,7 @@
 #include <dali-toolkit/devel-api/shader-effects/motion-blur-effect.h>
 #include <dali/dali.h>
 #include <dali/devel-api/actors/actor-devel.h>
+#include "shared/launch-latency.h"
 #include "shared/view.h"
 
 using namespace Dali;
@@ -452,6 +453,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application          app = Application::New(&argc, &argv, DEMO_THEME_PATH);
   MotionBlurExampleApp test(app);
+  DemoHelper::ReportLaunchLatency(app);
   app.MainLoop();
   return 0;
 }
@@ -21,6 +21,7 @@
 #include <cstring>
 
 // INTERNAL INCLUDES
+#include "shared/launch-latency.h"
 #include "shared/utility.h"
 
 using namespace Dali;
@@ -423,6 +424,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application                 application = Application::New(&argc, &argv);
   NativeImageSourceController test(application);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
   return 0;
 }
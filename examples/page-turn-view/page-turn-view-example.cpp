@@ -22,6 +22,8 @@
 #include <dali-toolkit/devel-api/controls/page-turn-view/page-turn-view.h>
 #include <dali/dali.h>
 
+#include "shared/launch-latency.h"
+
 using namespace Dali;
 using namespace Dali::Toolkit;
 
@@ -275,6 +277,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
   Application     app = Application::New(&argc, &argv);
   PageTurnExample test(app);
 
+  DemoHelper::ReportLaunchLatency(app);
   app.MainLoop();
 
   return 0;
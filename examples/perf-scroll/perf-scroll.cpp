@@ -17,6 +17,12 @@
 
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali-toolkit/devel-api/visuals/visual-properties-devel.h>
+#include <dali/devel-api/common/stage-devel.h>
+#include <fstream>
+#include <iostream>
+#include "shared/frame-time-histogram.h"
+#include "shared/frame-time-recorder.h"
+#include "shared/launch-latency.h"
 #include "shared/utility.h"
 
 using namespace Dali;
@@ -182,6 +188,8 @@ unsigned int gRowsPerPage(15);
 unsigned int gColumnsPerPage(15);
 unsigned int gPageCount(10);
 float        gDuration(10.0f);
+float        gVsyncBudget(1000.0f / 60.0f);
+std::string  gReportPath;
 
 Renderer CreateRenderer(unsigned int index, Geometry geometry, Shader shader)
 {
@@ -199,6 +207,11 @@ Renderer CreateRenderer(unsigned int index, Geometry geometry, Shader shader)
 // Test application to compare performance between ImageActor and ImageView
 // By default, the application consist of 10 pages of 25x25 ImageActors, this can be modified using the following command line arguments:
 // -t duration (sec )
+// -r NumberOfRows  (Modifies the number of rows per page)
+// -c NumberOfColumns (Modifies the number of columns per page)
+// -p NumberOfPages (Modifies the number of pages )
+// --vsync=BudgetMs ( The frame budget jank is detected against, 16.67ms by default )
+// --report=FILE ( Write the JSON frame-time histogram and jank report of the scroll to FILE instead of stdout )
 // --use-imageview ( Use ImageView instead of ImageActor )
 // --use-mesh ( Use new renderer API (as ImageView) but shares renderers between actors when possible )
 
@@ -252,6 +265,8 @@ public:
       CreateImageViews();
     }
 
+    DevelStage::AddFrameCallback(Stage::GetCurrent(), mFrameTimeRecorder, window.GetRootLayer());
+
     ShowAnimation();
   }
 
@@ -322,6 +337,7 @@ public:
     }
     else if(source == mScroll)
     {
+      WriteReport(mFrameTimeRecorder.Stop());
       HideAnimation();
     }
     else
@@ -393,6 +409,8 @@ public:
     mScroll.AnimateBy(Property(mParent, Actor::Property::POSITION), Vector3(-(gPageCount - 1.) * windowSize.x, 0.0f, 0.0f));
     mScroll.Play();
     mScroll.FinishedSignal().Connect(this, &PerfScroll::OnAnimationEnd);
+
+    mFrameTimeRecorder.Start();
   }
 
   void HideAnimation()
@@ -436,6 +454,44 @@ public:
     mHide.FinishedSignal().Connect(this, &PerfScroll::OnAnimationEnd);
   }
 
+  /**
+   * @brief Writes the frame-time histogram and the frames which missed the vsync budget during the scroll as JSON.
+   */
+  void WriteReport(const std::vector<float>& frameTimes)
+  {
+    std::ofstream file;
+    if(!gReportPath.empty())
+    {
+      file.open(gReportPath);
+      if(!file.is_open())
+      {
+        std::cerr << "Unable to write perf-scroll report to " << gReportPath << std::endl;
+      }
+    }
+    std::ostream& stream = file.is_open() ? file : std::cout;
+
+    DemoHelper::FrameTimeHistogram histogram;
+    histogram.Record(frameTimes);
+
+    stream << "{\n"
+           << "  \"mode\": \"" << (gUseMesh ? "mesh" : "image-view") << "\",\n"
+           << "  \"rowsPerPage\": " << mRowsPerPage << ",\n"
+           << "  \"columnsPerPage\": " << mColumnsPerPage << ",\n"
+           << "  \"pageCount\": " << mPageCount << ",\n"
+           << "  \"scrollDuration\": " << gDuration << ",\n"
+           << "  \"statistics\": ";
+    DemoHelper::WriteJson(stream, DemoHelper::CalculateFrameTimeStatistics(frameTimes));
+    stream << ",\n  \"histogramPercentiles\": { \"p50Ms\": " << histogram.GetValueAtPercentile(50.0f)
+           << ", \"p90Ms\": " << histogram.GetValueAtPercentile(90.0f)
+           << ", \"p99Ms\": " << histogram.GetValueAtPercentile(99.0f)
+           << ", \"p99.9Ms\": " << histogram.GetValueAtPercentile(99.9f) << " },\n"
+           << "  \"histogram\": ";
+    histogram.WriteJson(stream);
+    stream << ",\n  \"jank\": ";
+    DemoHelper::WriteJson(stream, DemoHelper::DetectJank(frameTimes, gVsyncBudget));
+    stream << "\n}" << std::endl;
+  }
+
   void OnKeyEvent(const KeyEvent& event)
   {
     if(event.GetState() == KeyEvent::DOWN)
@@ -462,6 +518,8 @@ private:
   Animation mShow;
   Animation mScroll;
   Animation mHide;
+
+  DemoHelper::FrameTimeRecorder mFrameTimeRecorder; ///< Records the frame times while scrolling.
 };
 
 int DALI_EXPORT_API main(int argc, char** argv)
@@ -483,9 +541,35 @@ int DALI_EXPORT_API main(int argc, char** argv)
     {
       gDuration = atof(arg.substr(2, arg.size()).c_str());
     }
+    else if(arg.compare(0, 2, "-r") == 0)
+    {
+      gRowsPerPage = atoi(arg.substr(2, arg.size()).c_str());
+    }
+    else if(arg.compare(0, 2, "-c") == 0)
+    {
+      gColumnsPerPage = atoi(arg.substr(2, arg.size()).c_str());
+    }
+    else if(arg.compare(0, 2, "-p") == 0)
+    {
+      gPageCount = atoi(arg.substr(2, arg.size()).c_str());
+    }
+    else if(arg.compare(0, 8, "--vsync=") == 0)
+    {
+      gVsyncBudget = atof(arg.substr(8).c_str());
+      if(!(gVsyncBudget > 0.0f))
+      {
+        std::cerr << "The --vsync budget must be a positive number of milliseconds" << std::endl;
+        return 1;
+      }
+    }
+    else if(arg.compare(0, 9, "--report=") == 0)
+    {
+      gReportPath = arg.substr(9);
+    }
   }
 
   PerfScroll test(application);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
 
   return 0;
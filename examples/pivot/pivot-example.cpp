@@ -21,6 +21,8 @@
 
 #include <iostream>
 
+#include "shared/launch-latency.h"
+
 using namespace Dali;
 using namespace Dali::Toolkit;
 
@@ -152,6 +154,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application     application = Application::New(&argc, &argv);
   PivotController test(application);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
   return 0;
 }
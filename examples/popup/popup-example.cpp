@@ -19,6 +19,7 @@
 #include <dali-toolkit/devel-api/controls/popup/popup.h>
 #include <dali-toolkit/devel-api/controls/table-view/table-view.h>
 #include <dali/dali.h>
+#include "shared/launch-latency.h"
 #include "shared/view.h"
 
 using namespace Dali;
@@ -728,6 +729,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application  application = Application::New(&argc, &argv, DEMO_THEME_PATH);
   PopupExample test(application);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
   return 0;
 }
@@ -19,6 +19,8 @@
 #include <dali/devel-api/adaptor-framework/application-devel.h>
 #include <dali/integration-api/adaptor-framework/adaptor.h>
 
+#include "shared/launch-latency.h"
+
 using namespace Dali::Toolkit;
 
 namespace Dali
@@ -251,6 +253,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 {
   Dali::Application                 application = Dali::Application::New(&argc, &argv);
   Dali::PreRenderCallbackController controller(application);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
   return 0;
 }
@@ -20,6 +20,7 @@
 #include <dali/devel-api/adaptor-framework/file-stream.h>
 #include <dali/integration-api/debug.h>
 #include <stdio.h>
+#include "shared/launch-latency.h"
 #include "shared/utility.h"
 #include "shared/view.h"
 
@@ -226,6 +227,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application        application = Application::New(&argc, &argv);
   RayMarchingExample test(application);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
   return 0;
 }
@@ -19,10 +19,23 @@
 #include "gltf-scene.h"
 
 // EXTERNAL INCLUDES
-#include <dali/devel-api/adaptor-framework/file-stream.h>
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+// INTERNAL INCLUDES
+#include "shared/json-stream-parser.h"
 
 namespace
 {
+// GL component types used by accessors
+const uint32_t GLTF_BYTE           = 0x1400;
+const uint32_t GLTF_UNSIGNED_BYTE  = 0x1401;
+const uint32_t GLTF_SHORT          = 0x1402;
+const uint32_t GLTF_UNSIGNED_SHORT = 0x1403;
+const uint32_t GLTF_UNSIGNED_INT   = 0x1405;
+const uint32_t GLTF_FLOAT          = 0x1406;
+
 // string contains enum type index encoded matching glTFAttributeType
 const std::vector<std::string> GLTF_STR_ATTRIBUTE_TYPE = {
   "POSITION",
@@ -63,82 +76,84 @@ uint32_t glTFComponentTypeStrToNum(const std::string& name)
   return iter->second;
 }
 
-template<class T>
-struct JsonResult
-{
-  bool success;
-  T    result;
-  operator T() const
-  {
-    return static_cast<T>(result);
-  }
-};
-
-template<>
-struct JsonResult<bool>
+uint32_t glTFComponentTypeToByteSize(uint32_t componentType)
 {
-  bool success;
-  bool result;
-
-  operator bool() const
+  switch(componentType)
   {
-    return result;
+    case GLTF_BYTE:
+    case GLTF_UNSIGNED_BYTE:
+      return 1;
+    case GLTF_SHORT:
+    case GLTF_UNSIGNED_SHORT:
+      return 2;
+    case GLTF_UNSIGNED_INT:
+    case GLTF_FLOAT:
+      return 4;
+    default:
+      return 0;
   }
-};
+}
 
-template<class Expected, class Converted = Expected>
-JsonResult<picojson::value> JsonFindValue(const picojson::object& object, const std::string& name)
+/**
+ * Copies the indices into indices, converting them to T.
+ * Returns false if the view does not hold indices or one of them does not fit in T.
+ */
+template<class T>
+bool CopyIndices(const glTF_AccessorView& view, std::vector<T>& indices)
 {
-  auto iter = find_if(object.begin(), object.end(), [name](decltype(*object.begin())& item) {
-    return item.first == name;
-  });
-
-  if(iter == object.end())
+  if(!view)
   {
-    return {false};
+    return false;
   }
 
-  return {true, iter->second};
-};
-
-template<class Expected, class Converted = Expected>
-JsonResult<Converted> JsonGetValue(const picojson::value& val, const std::string& name, const Converted& onFail)
-{
-  if(val.contains(name))
-  {
-    return {true, static_cast<Converted>(val.get(name).get<Expected>())};
-  }
-  return {false, onFail};
-}
+  indices.resize(view.count);
 
-template<class Expected, class Converted = Expected>
-bool JsonGetValueOut(const picojson::value& val, const std::string& name, Converted& writeOut)
-{
-  if(val.contains(name))
+  // Fast path, the whole range can be copied as it is
+  if(view.elementSize == sizeof(T) && view.IsTightlyPacked())
   {
-    writeOut = static_cast<Converted>(val.get(name).get<Expected>());
+    memcpy(indices.data(), view.data, size_t(view.count) * sizeof(T));
     return true;
   }
-  return false;
-}
 
-/**
- * Safe json value accessor
- */
-template<class Expected, class Converted = Expected>
-JsonResult<std::vector<Converted>> JsonGetArray(const picojson::value& val, const std::string& name, std::vector<Converted> valueOnFail = {})
-{
-  if(val.contains(name))
+  for(auto i = 0u; i < view.count; ++i)
   {
-    const auto&            array = val.get(name).get<picojson::array>();
-    std::vector<Converted> result{};
-    for(const auto& item : array)
+    uint32_t index;
+    switch(view.componentType)
     {
-      result.emplace_back(static_cast<Converted>(item.get<Expected>()));
+      case GLTF_UNSIGNED_BYTE:
+      {
+        index = *view[i];
+        break;
+      }
+      case GLTF_UNSIGNED_SHORT:
+      {
+        uint16_t value;
+        memcpy(&value, view[i], sizeof(value)); // elements may not be aligned
+        index = value;
+        break;
+      }
+      case GLTF_UNSIGNED_INT:
+      {
+        memcpy(&index, view[i], sizeof(index));
+        break;
+      }
+      default:
+      {
+        GLTF_LOG("GLTF: Unsupported index component type: %d", int(view.componentType));
+        indices.clear();
+        return false;
+      }
     }
-    return {true, result};
+
+    if(index > std::numeric_limits<T>::max())
+    {
+      GLTF_LOG("GLTF: Index %u does not fit in %d bytes", index, int(sizeof(T)));
+      indices.clear();
+      return false;
+    }
+    indices[i] = static_cast<T>(index);
   }
-  return {false, valueOnFail};
+  return true;
 }
 
 } // namespace
@@ -156,277 +171,286 @@ void glTF::LoadFromFile(const std::string& filename)
   std::string binFile(filename);
   binFile += ".bin";
 
-  // load binary
+  // map binary, the buffer views & accessors point straight into it
 
   GLTF_LOG("LoadFromFile: %s", binFile.c_str());
-  mBuffer    = LoadFile(binFile);
-  jsonBuffer = LoadFile(jsonFile);
+  LoadFile(binFile, mBuffer);
+  LoadFile(jsonFile, jsonBuffer);
 
   // Log errors
-  if(mBuffer.empty())
+  if(!mBuffer)
   {
     GLTF_LOG("Error, buffer empty!");
   }
   else
   {
-    GLTF_LOG("GLTF[BIN]: %s loaded, size = %d", binFile.c_str(), int(mBuffer.size()));
+    GLTF_LOG("GLTF[BIN]: %s loaded, size = %d", binFile.c_str(), int(mBuffer.GetSize()));
   }
-  if(jsonBuffer.empty())
+  if(!jsonBuffer)
   {
     GLTF_LOG("Error, buffer GLTF empty!");
   }
   else
   {
-    GLTF_LOG("GLTF: %s loaded, size = %d", binFile.c_str(), int(jsonBuffer.size()));
-  }
-
-  // Abort if errors
-  if(jsonBuffer.empty() || mBuffer.empty())
-  {
-    return;
-  }
-
-  // parse json
-  auto err = picojson::parse(jsonNode, std::string(reinterpret_cast<char*>(jsonBuffer.data())));
-  if(!err.empty())
-  {
-    GLTF_LOG("GLTF: Error parsing %s, error: %s", jsonFile.c_str(), err.c_str());
-    return;
-  }
-  else
-  {
-    GLTF_LOG("GLTF: %s loaded, size = %d", jsonFile.c_str(), int(jsonBuffer.size()));
+    GLTF_LOG("GLTF: %s loaded, size = %d", binFile.c_str(), int(jsonBuffer.GetSize()));
   }
 }
 
-bool glTF::ParseJSON()
+/**
+ * Fills the glTF structures straight from the JSON as it is parsed
+ */
+struct glTF::JsonHandler : public DemoHelper::JsonStreamHandler
 {
-  if(!jsonNode.is<picojson::object>())
+  using Path = DemoHelper::JsonPath;
+
+  explicit JsonHandler(glTF& gltf)
+  : gltf(gltf)
   {
-    return false;
   }
 
-  // Add dummy first node to nodes (scene node)
-  mNodes.emplace_back();
-
-  // Sources for textures to be resolved later
-  std::vector<uint32_t>     textureSources{};
-  std::vector<glTF_Texture> images{};
-
-  for(auto& val : jsonNode.get<picojson::object>())
+  bool OnObjectStart(const Path& path) override
   {
-    GLTF_LOG("node: %s", val.first.c_str());
+    if(path.GetDepth() != 2u || path.GetName().size())
+    {
+      return true;
+    }
 
-    // Parse bufferviews
-    if(val.first == "bufferViews")
+    // New element of one of the top level arrays
+    if(path.IsKey(0, "bufferViews"))
     {
-      auto bufferViews = val.second;
-      for(auto& view : bufferViews.get<picojson::array>())
-      {
-        auto bufferIndex = uint32_t(view.get("buffer").get<double>());
-        auto byteLength  = uint32_t(view.get("byteLength").get<double>());
-        auto byteOffset  = uint32_t(view.get("byteOffset").get<double>());
+      gltf.mBufferViews.emplace_back();
+    }
+    else if(path.IsKey(0, "accessors"))
+    {
+      gltf.mAccessors.emplace_back();
+    }
+    else if(path.IsKey(0, "meshes"))
+    {
+      gltf.mMeshes.emplace_back();
+    }
+    else if(path.IsKey(0, "cameras"))
+    {
+      gltf.mCameras.emplace_back();
+    }
+    else if(path.IsKey(0, "nodes"))
+    {
+      gltf.mNodes.emplace_back();
+      gltf.mNodes.back().index = uint32_t(gltf.mNodes.size() - 1u); // after the scene node
+    }
+    else if(path.IsKey(0, "materials"))
+    {
+      gltf.mMaterials.emplace_back();
+    }
+    else if(path.IsKey(0, "textures"))
+    {
+      textureSources.emplace_back(0xffffffff);
+    }
+    else if(path.IsKey(0, "images"))
+    {
+      images.emplace_back();
+    }
+    return true;
+  }
 
-        glTF_BufferView bufferView{};
-        bufferView.bufferIndex = bufferIndex;
-        bufferView.byteLength  = byteLength;
-        bufferView.byteOffset  = byteOffset;
+  bool OnNumber(const Path& path, double value) override
+  {
+    const auto  number = uint32_t(value);
+    const auto& name   = path.GetName();
 
-        mBufferViews.emplace_back(bufferView);
-      }
+    if(path.Matches({"bufferViews", nullptr, "*"}) && !gltf.mBufferViews.empty())
+    {
+      auto& bufferView = gltf.mBufferViews.back();
+      SetIfName(name, "buffer", bufferView.bufferIndex, number);
+      SetIfName(name, "byteLength", bufferView.byteLength, number);
+      SetIfName(name, "byteOffset", bufferView.byteOffset, number);
+      SetIfName(name, "byteStride", bufferView.byteStride, number);
     }
-
-    // parse accessors
-    else if(val.first == "accessors")
+    else if(path.Matches({"accessors", nullptr, "*"}) && !gltf.mAccessors.empty())
     {
-      for(const auto& accessor : val.second.get<picojson::array>())
-      {
-        auto gltfAccessor          = glTF_Accessor{};
-        gltfAccessor.bufferView    = uint32_t(accessor.get("bufferView").get<double>());
-        gltfAccessor.componentType = uint32_t(accessor.get("componentType").get<double>());
-        gltfAccessor.count         = uint32_t(accessor.get("count").get<double>());
-        gltfAccessor.type          = accessor.get("type").get<std::string>();
-        gltfAccessor.componentSize = glTFComponentTypeStrToNum(gltfAccessor.type);
-        mAccessors.emplace_back(gltfAccessor);
-      }
+      auto& accessor = gltf.mAccessors.back();
+      SetIfName(name, "bufferView", accessor.bufferView, number);
+      SetIfName(name, "byteOffset", accessor.byteOffset, number);
+      SetIfName(name, "componentType", accessor.componentType, number);
+      SetIfName(name, "count", accessor.count, number);
     }
-
-    // parse meshes
-    else if(val.first == "meshes")
+    else if(path.IsKey(0, "meshes") && path.IsKey(2, "primitives") && path.GetDepth() > 4u && path.GetIndex(3) == 0u && !gltf.mMeshes.empty())
     {
-      for(const auto& mesh : val.second.get<picojson::array>())
+      // in this implementation assuming single mesh consists of one and only one primitive
+      auto& mesh = gltf.mMeshes.back();
+      if(path.GetDepth() == 6u && path.IsKey(4, "attributes"))
       {
-        glTF_Mesh gltfMesh{};
-        gltfMesh.name = mesh.get("name").get<std::string>();
-
-        // get primitives (in this implementation assuming single mesh consists of
-        // one and only one primitive)
-        const auto& primitive = mesh.get("primitives").get<picojson::array>()[0];
-        const auto& attrs     = primitive.get("attributes").get<picojson::object>();
-        for(const auto& attr : attrs)
-        {
-          auto type    = glTFAttributeTypeStrToEnum(attr.first);
-          auto bvIndex = uint32_t(attr.second.get<double>());
-          gltfMesh.attributes.emplace_back(std::make_pair(type, bvIndex));
-          GLTF_LOG("GLTF: ATTR: type: %d, index: %d", int(type), int(bvIndex));
-        }
-
-        gltfMesh.indices  = uint32_t(primitive.get("indices").get<double>());
-        gltfMesh.material = uint32_t(primitive.get("material").get<double>());
-        mMeshes.emplace_back(gltfMesh);
+        auto type = glTFAttributeTypeStrToEnum(name);
+        mesh.attributes.emplace_back(std::make_pair(type, number));
+        GLTF_LOG("GLTF: ATTR: type: %d, index: %d", int(type), int(number));
       }
-    }
-    // parse cameras
-    else if(val.first == "cameras")
-    {
-      glTF_Camera tgifCamera{};
-      for(const auto& camera : val.second.get<picojson::array>())
+      else if(path.GetDepth() == 5u)
       {
-        tgifCamera.name          = camera.get("name").to_str();
-        tgifCamera.isPerspective = (camera.get("type").to_str() == "perspective");
-        if(tgifCamera.isPerspective)
-        {
-          const auto& perspective = camera.get("perspective");
-          tgifCamera.yfov         = static_cast<float>(perspective.get("yfov").get<double>());
-          tgifCamera.zfar         = static_cast<float>(perspective.get("zfar").get<double>());
-          tgifCamera.znear        = static_cast<float>(perspective.get("znear").get<double>());
-        }
-
-        mCameras.emplace_back(tgifCamera);
+        SetIfName(name, "indices", mesh.indices, number);
+        SetIfName(name, "material", mesh.material, number);
       }
     }
-    // parse nodes
-    else if(val.first == "nodes")
+    else if(path.Matches({"cameras", nullptr, "perspective", "*"}) && !gltf.mCameras.empty())
+    {
+      auto& camera = gltf.mCameras.back();
+      SetIfName(name, "yfov", camera.yfov, float(value));
+      SetIfName(name, "zfar", camera.zfar, float(value));
+      SetIfName(name, "znear", camera.znear, float(value));
+    }
+    else if(path.IsKey(0, "nodes") && path.GetDepth() > 2u && gltf.mNodes.size() > 1u)
     {
-      auto nodeIndex = 1u;
-      for(const auto& node : val.second.get<picojson::array>())
+      auto& node = gltf.mNodes.back();
+      if(path.GetDepth() == 3u)
       {
-        glTF_Node gltfNode{};
-        gltfNode.name    = node.get("name").to_str();
-        auto rotation    = JsonGetArray<double, float>(node, "rotation", {0.0f, 0.0f, 0.0f, 1.0f});
-        auto translation = JsonGetArray<double, float>(node, "translation", {0.0f, 0.0f, 0.0f});
-        auto scale       = JsonGetArray<double, float>(node, "scale", {1.0f, 1.0f, 1.0f});
-        std::copy(rotation.result.begin(), rotation.result.end(), gltfNode.rotationQuaternion);
-        std::copy(translation.result.begin(), translation.result.end(), gltfNode.translation);
-        std::copy(scale.result.begin(), scale.result.end(), gltfNode.scale);
-
-        auto children = JsonGetArray<double, uint32_t>(node, "children");
-        if(children.success)
+        SetIfName(name, "camera", node.cameraId, number);
+        SetIfName(name, "mesh", node.meshId, number);
+      }
+      else if(path.GetDepth() == 4u)
+      {
+        const auto index = path.GetIndex(3);
+        if(path.IsKey(2, "children"))
         {
-          gltfNode.children = std::move(children.result);
+          node.children.emplace_back(number);
         }
-        gltfNode.index    = nodeIndex;
-        gltfNode.cameraId = 0xffffffff;
-        gltfNode.meshId   = 0xffffffff;
-
-        auto cameraId = JsonGetValue<double, uint32_t>(node, "camera", 0xffffffff);
-        if(cameraId.success)
+        else if(path.IsKey(2, "rotation") && index < 4u)
         {
-          gltfNode.cameraId = cameraId.result;
+          node.rotationQuaternion[index] = float(value);
         }
-        auto meshId = JsonGetValue<double, uint32_t>(node, "mesh", 0xffffffff);
-        if(meshId.success)
+        else if(path.IsKey(2, "translation") && index < 3u)
         {
-          gltfNode.meshId = meshId.result;
+          node.translation[index] = float(value);
         }
-        mNodes.emplace_back(gltfNode);
-        ++nodeIndex;
-      }
-    }
-    // parse scenes, note: only first scene is being parsed
-    else if(val.first == "scenes")
-    {
-      auto&       sceneNode = mNodes[0];
-      const auto& scene     = val.second.get<picojson::array>()[0];
-      sceneNode.name        = JsonGetValue<std::string>(scene, "name", std::string());
-      auto result           = JsonGetArray<double, uint32_t>(scene, "nodes");
-      sceneNode.children    = result.result;
-      sceneNode.index       = 0;
-    }
-    else if(val.first == "materials")
-    {
-      for(const auto& node : val.second.get<picojson::array>())
-      {
-        // Get pbr material, base color texture
-        glTF_Material material{};
-        material.doubleSided = JsonGetValue<bool>(node, "doubleSided", false).result;
-        material.name        = JsonGetValue<std::string>(node, "name", std::string()).result;
-        if(node.contains("pbrMetallicRoughness"))
+        else if(path.IsKey(2, "scale") && index < 3u)
         {
-          const auto& node0 = node.get("pbrMetallicRoughness");
-          if(node0.contains("baseColorTexture"))
-          {
-            const auto& node1                                       = node0.get("baseColorTexture");
-            auto        index                                       = uint32_t(node1.get("index").get<double>());
-            auto        texCoord                                    = uint32_t(node1.get("texCoord").get<double>());
-            material.pbrMetallicRoughness.enabled                   = true;
-            material.pbrMetallicRoughness.baseTextureColor.index    = index;
-            material.pbrMetallicRoughness.baseTextureColor.texCoord = texCoord;
-          }
+          node.scale[index] = float(value);
         }
-        mMaterials.emplace_back(material);
       }
     }
-    else if(val.first == "textures")
+    // note: only first scene is being parsed
+    else if(path.Matches({"scenes", nullptr, "nodes", nullptr}) && path.GetIndex(1) == 0u)
     {
-      for(const auto& item : val.second.get<picojson::array>())
-      {
-        auto source = JsonGetValue<double, uint32_t>(item, "source", 0xffffffff);
-        textureSources.emplace_back(source.result);
-      }
+      gltf.mNodes[0].children.emplace_back(number);
     }
-    else if(val.first == "images")
+    else if(path.Matches({"materials", nullptr, "pbrMetallicRoughness", "baseColorTexture", "*"}) && !gltf.mMaterials.empty())
     {
-      for(const auto& item : val.second.get<picojson::array>())
-      {
-        glTF_Texture tex{};
-        JsonGetValueOut<std::string>(item, "name", tex.name);
-        JsonGetValueOut<std::string>(item, "uri", tex.uri);
-        images.emplace_back(tex);
-      }
+      auto& pbr = gltf.mMaterials.back().pbrMetallicRoughness;
+      pbr.enabled = true;
+      SetIfName(name, "index", pbr.baseTextureColor.index, number);
+      SetIfName(name, "texCoord", pbr.baseTextureColor.texCoord, number);
+    }
+    else if(path.Matches({"textures", nullptr, "source"}) && !textureSources.empty())
+    {
+      textureSources.back() = number;
     }
+    return true;
   }
 
-  // Resolve cross-referencing
-  for(const auto& source : textureSources)
+  bool OnBool(const Path& path, bool value) override
   {
-    mTextures.emplace_back(images[source]);
+    if(path.Matches({"materials", nullptr, "doubleSided"}) && !gltf.mMaterials.empty())
+    {
+      gltf.mMaterials.back().doubleSided = value;
+    }
+    return true;
   }
 
-  return true;
-}
-
-glTF_Buffer glTF::LoadFile(const std::string& filename)
-{
-  Dali::FileStream           fileStream(filename.c_str(), Dali::FileStream::READ | Dali::FileStream::BINARY);
-  FILE*                      fin = fileStream.GetFile();
-  std::vector<unsigned char> buffer;
-  if(fin)
+  bool OnString(const Path& path, const std::string& value) override
   {
-    if(fseek(fin, 0, SEEK_END))
+    const auto& name = path.GetName();
+    if(path.GetDepth() != 3u || path.GetKey(1).size())
     {
-      return {};
+      return true;
     }
-    auto size = ftell(fin);
-    if(fseek(fin, 0, SEEK_SET))
+
+    if(path.IsKey(0, "accessors") && name == "type" && !gltf.mAccessors.empty())
     {
-      return {};
+      gltf.mAccessors.back().type          = value;
+      gltf.mAccessors.back().componentSize = glTFComponentTypeStrToNum(value);
     }
-    buffer.resize(unsigned(size));
-    auto result = fread(buffer.data(), 1, size_t(size), fin);
-    if(result != size_t(size))
+    else if(path.IsKey(0, "meshes") && name == "name" && !gltf.mMeshes.empty())
     {
-      GLTF_LOG("LoadFile: Result: %d", int(result));
-      // return empty buffer
-      return {};
+      gltf.mMeshes.back().name = value;
+    }
+    else if(path.IsKey(0, "cameras") && !gltf.mCameras.empty())
+    {
+      SetIfName(name, "name", gltf.mCameras.back().name, value);
+      SetIfName(name, "type", gltf.mCameras.back().isPerspective, value == "perspective");
+    }
+    else if(path.IsKey(0, "nodes") && name == "name" && gltf.mNodes.size() > 1u)
+    {
+      gltf.mNodes.back().name = value;
+    }
+    else if(path.IsKey(0, "scenes") && name == "name" && path.GetIndex(1) == 0u)
+    {
+      gltf.mNodes[0].name = value;
+    }
+    else if(path.IsKey(0, "materials") && name == "name" && !gltf.mMaterials.empty())
+    {
+      gltf.mMaterials.back().name = value;
+    }
+    else if(path.IsKey(0, "images") && !images.empty())
+    {
+      SetIfName(name, "name", images.back().name, value);
+      SetIfName(name, "uri", images.back().uri, value);
+    }
+    return true;
+  }
+
+  template<class T, class U>
+  static void SetIfName(const std::string& name, const char* expected, T& field, const U& value)
+  {
+    if(name == expected)
+    {
+      field = value;
     }
   }
-  else
+
+  glTF& gltf;
+
+  // Sources for textures to be resolved later
+  std::vector<uint32_t>     textureSources{};
+  std::vector<glTF_Texture> images{};
+};
+
+bool glTF::ParseJSON()
+{
+  // Abort if errors
+  if(!jsonBuffer || !mBuffer)
+  {
+    return false;
+  }
+
+  // Add dummy first node to nodes (scene node)
+  mNodes.emplace_back();
+
+  JsonHandler handler(*this);
+  auto        err = DemoHelper::ParseJsonStream(jsonBuffer.GetData(), jsonBuffer.GetData() + jsonBuffer.GetSize(), handler);
+  jsonBuffer.Close(); // no longer needed
+  if(!err.empty())
   {
-    GLTF_LOG("LoadFile: Can't open file: errno = %d", errno);
+    GLTF_LOG("GLTF: Error parsing json, error: %s", err.c_str());
+    return false;
   }
 
-  return buffer;
+  // Resolve cross-referencing
+  for(const auto& source : handler.textureSources)
+  {
+    if(source < handler.images.size())
+    {
+      mTextures.emplace_back(handler.images[source]);
+    }
+  }
+
+  return true;
+}
+
+bool glTF::LoadFile(const std::string& filename, DemoHelper::MemoryMappedFile& file)
+{
+  if(!file.Open(filename))
+  {
+    GLTF_LOG("LoadFile: Can't open file: %s", filename.c_str());
+    return false;
+  }
+  return true;
 }
 
 std::vector<const glTF_Mesh*> glTF::GetMeshes() const
@@ -449,79 +473,115 @@ std::vector<const glTF_Camera*> glTF::GetCameras()
   return cameras;
 }
 
-std::vector<unsigned char> glTF::GetMeshAttributeBuffer(const glTF_Mesh& mesh, const std::vector<glTFAttributeType>& attrTypes)
+glTF_AccessorView glTF::GetAccessorView(uint32_t accessorIndex) const
+{
+  if(accessorIndex >= mAccessors.size() || mAccessors[accessorIndex].bufferView >= mBufferViews.size())
+  {
+    return {};
+  }
+
+  const auto& accessor   = mAccessors[accessorIndex];
+  const auto& bufferView = mBufferViews[accessor.bufferView];
+
+  glTF_AccessorView view{};
+  view.count         = accessor.count;
+  view.componentType = accessor.componentType;
+  view.elementSize   = accessor.componentSize * glTFComponentTypeToByteSize(accessor.componentType);
+  view.byteStride    = bufferView.byteStride ? bufferView.byteStride : view.elementSize;
+
+  // The last element has to lie within both the buffer view and the mapped buffer
+  const uint64_t viewEnd = uint64_t(bufferView.byteOffset) + bufferView.byteLength;
+  const uint64_t start   = uint64_t(bufferView.byteOffset) + accessor.byteOffset;
+  const uint64_t end     = view.count ? start + uint64_t(view.count - 1u) * view.byteStride + view.elementSize : start;
+  if(view.elementSize == 0u || end > viewEnd || viewEnd > mBuffer.GetSize())
+  {
+    GLTF_LOG("GLTF: Accessor %d is out of bounds", int(accessorIndex));
+    return {};
+  }
+
+  view.data = reinterpret_cast<const unsigned char*>(mBuffer.GetData()) + start;
+  return view;
+}
+
+glTF_VertexData glTF::GetMeshVertexData(const glTF_Mesh& mesh, const std::vector<glTFAttributeType>& attrTypes) const
 {
-  // find buffer views
-  struct Data
-  {
-    uint32_t accessorIndex{0u};
-    uint32_t byteStride{0u};
-    char*    srcPtr{nullptr};
-  };
-  std::vector<Data> data{};
+  // find accessors, in the requested order
+  std::vector<glTF_AccessorView> views{};
   for(const auto& attrType : attrTypes)
   {
-    std::find_if(mesh.attributes.begin(), mesh.attributes.end(), [&data, &attrType](const std::pair<glTFAttributeType, uint32_t>& item) {
+    for(const auto& item : mesh.attributes)
+    {
       if(item.first == attrType)
       {
-        data.emplace_back();
-        data.back().accessorIndex = item.second;
+        views.emplace_back(GetAccessorView(item.second));
+        if(!views.back())
+        {
+          return {};
+        }
       }
-      return false;
-    });
+    }
   }
 
-  if(data.empty())
+  if(views.empty())
   {
     return {};
   }
 
   // number of attributes is same for the whole mesh so using very first
   // accessor
-
-  glTF_Buffer retval{};
-
-  // data is interleaved
-  if(data.size() > 1)
+  glTF_VertexData vertexData{};
+  vertexData.count      = views[0].count;
+  vertexData.byteStride = 0u;
+
+  // the data is already interleaved if every attribute follows the previous
+  // one within the same vertex and the vertices are back to back
+  bool interleaved = true;
+  for(const auto& view : views)
   {
-    auto     attributeCount  = mAccessors[data[0].accessorIndex].count; // / mAccessors[data[0].accessorIndex].componentSize;
-    uint32_t attributeStride = 0;
-    // now find buffer view stride for particular accessor
-    for(auto& item : data)
+    if(view.count != vertexData.count)
     {
-      auto& accessor = mAccessors[item.accessorIndex];
-
-      // Update byte stride for this buffer view
-      auto& bufferView = mBufferViews[accessor.bufferView];
-      item.byteStride  = bufferView.byteLength / attributeCount;
-      attributeStride += item.byteStride;
-      item.srcPtr = reinterpret_cast<char*>(mBuffer.data()) + bufferView.byteOffset;
+      GLTF_LOG("GLTF: Mesh %s has attributes of different lengths", mesh.name.c_str());
+      return {};
     }
+    interleaved &= (view.data == views[0].data + vertexData.byteStride);
+    vertexData.byteStride += view.elementSize;
+  }
+  for(const auto& view : views)
+  {
+    interleaved &= (view.byteStride == vertexData.byteStride);
+  }
+
+  if(interleaved)
+  {
+    vertexData.data = views[0].data;
+    return vertexData;
+  }
 
-    // now allocate final buffer and interleave data
-    retval.resize(attributeStride * attributeCount);
-    auto* dstPtr = retval.data();
-    for(auto i = 0u; i < attributeCount; ++i)
+  // now allocate final buffer and interleave data
+  vertexData.storage.resize(size_t(vertexData.byteStride) * vertexData.count);
+  auto* dstPtr = vertexData.storage.data();
+  for(const auto& view : views)
+  {
+    for(auto i = 0u; i < view.count; ++i)
     {
-      for(auto& item : data)
-      {
-        std::copy(item.srcPtr,
-                  item.srcPtr + item.byteStride,
-                  reinterpret_cast<char*>(dstPtr));
-        dstPtr += item.byteStride;
-        item.srcPtr += item.byteStride;
-      }
+      memcpy(dstPtr + size_t(i) * vertexData.byteStride, view[i], view.elementSize);
     }
+    dstPtr += view.elementSize;
   }
-  else // copy data directly as single buffer
+  vertexData.data = vertexData.storage.data();
+  return vertexData;
+}
+
+std::vector<unsigned char> glTF::GetMeshAttributeBuffer(const glTF_Mesh& mesh, const std::vector<glTFAttributeType>& attrTypes) const
+{
+  auto vertexData = GetMeshVertexData(mesh, attrTypes);
+  if(!vertexData.storage.empty())
   {
-    auto& bufferView = mBufferViews[mAccessors[data[0].accessorIndex].bufferView];
-    retval.resize(bufferView.byteLength);
-    std::copy(mBuffer.begin() + bufferView.byteOffset,
-              mBuffer.begin() + bufferView.byteOffset + bufferView.byteLength,
-              retval.begin());
+    return std::move(vertexData.storage);
   }
-  return retval;
+
+  // copy the whole range at once
+  return std::vector<unsigned char>(vertexData.data, vertexData.data + size_t(vertexData.byteStride) * vertexData.count);
 }
 
 const glTF_Mesh* glTF::FindMeshByName(const std::string& name) const
@@ -540,20 +600,23 @@ uint32_t glTF::GetMeshAttributeCount(const glTF_Mesh* mesh) const
   return accessor.count; // / accessor.componentSize;
 }
 
+glTF_AccessorView glTF::GetMeshIndexView(const glTF_Mesh* mesh) const
+{
+  return GetAccessorView(mesh->indices);
+}
+
 std::vector<uint16_t> glTF::GetMeshIndexBuffer(const glTF_Mesh* mesh) const
 {
-  // check GL component type
-  const auto& accessor = mAccessors[mesh->indices];
-  if(accessor.componentType == 0x1403) // GL_UNSIGNED_SHORT
-  {
-    std::vector<uint16_t> retval{};
-    retval.resize(accessor.count);
-    const auto& bufferView = mBufferViews[accessor.bufferView];
-    const auto* srcPtr     = reinterpret_cast<const uint16_t*>(reinterpret_cast<const char*>(mBuffer.data()) + bufferView.byteOffset);
-    std::copy(srcPtr, srcPtr + accessor.count, retval.data());
-    return retval;
-  }
-  return {};
+  std::vector<uint16_t> retval{};
+  CopyIndices(GetMeshIndexView(mesh), retval);
+  return retval;
+}
+
+std::vector<uint32_t> glTF::GetMeshIndexBuffer32(const glTF_Mesh* mesh) const
+{
+  std::vector<uint32_t> retval{};
+  CopyIndices(GetMeshIndexView(mesh), retval);
+  return retval;
 }
 
 const glTF_Node* glTF::FindNodeByName(const std::string& name) const
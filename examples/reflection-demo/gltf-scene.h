@@ -20,11 +20,13 @@
 
 
 // EXTERNAL INCLUDES
+#include <cstdint>
 #include <string>
+#include <vector>
 #include <dali/integration-api/debug.h>
 
 // INTERNAL INCLUDES
-#include "third-party/pico-json.h"
+#include "shared/memory-mapped-file.h"
 
 #define GLTF_LOG(...)                                                                   \
   {                                                                                     \
@@ -56,12 +58,14 @@ struct glTF_BufferView
   uint32_t bufferIndex;
   uint32_t byteLength;
   uint32_t byteOffset;
+  uint32_t byteStride; // 0 if the elements are tightly packed
   void*    data;
 };
 
 struct glTF_Accessor
 {
   uint32_t    bufferView;
+  uint32_t    byteOffset; // relative to the buffer view
   uint32_t    componentType;
   uint32_t    count;
   uint32_t    componentSize;
@@ -72,7 +76,7 @@ struct glTF_Mesh
 {
   std::string                                         name;
   std::vector<std::pair<glTFAttributeType, uint32_t>> attributes;
-  uint32_t                                            indices;
+  uint32_t                                            indices{~0u}; // no index accessor unless the primitive names one
   uint32_t                                            material;
 };
 
@@ -114,6 +118,53 @@ struct glTF_Node
 
 using glTF_Buffer = std::vector<unsigned char>;
 
+/**
+ * Strided view of the elements of an accessor, pointing straight into the
+ * (memory-mapped) binary buffer. Valid as long as the glTF it came from.
+ */
+struct glTF_AccessorView
+{
+  const unsigned char* data{nullptr}; // first element, nullptr if the accessor is invalid
+  uint32_t             count{0u};
+  uint32_t             elementSize{0u}; // in bytes
+  uint32_t             byteStride{0u};  // distance between consecutive elements in bytes
+  uint32_t             componentType{0u};
+
+  const unsigned char* operator[](uint32_t index) const
+  {
+    return data + size_t(index) * byteStride;
+  }
+
+  bool IsTightlyPacked() const
+  {
+    return byteStride == elementSize;
+  }
+
+  explicit operator bool() const
+  {
+    return data != nullptr;
+  }
+};
+
+/**
+ * Interleaved vertex data of a mesh. When the file already stores the requested
+ * attributes interleaved in that order the data points straight into the binary
+ * buffer, otherwise it points to an interleaved copy held in storage.
+ */
+struct glTF_VertexData
+{
+  const unsigned char*       data{nullptr};
+  uint32_t                   count{0u};
+  uint32_t                   byteStride{0u};
+  std::vector<unsigned char> storage{};
+
+  glTF_VertexData() = default;
+  glTF_VertexData(glTF_VertexData&&) = default;
+  glTF_VertexData(const glTF_VertexData&) = delete; // data may point into storage
+  glTF_VertexData& operator=(glTF_VertexData&&) = default;
+  glTF_VertexData& operator=(const glTF_VertexData&) = delete;
+};
+
 /**
  * Simple glTF parser
  *
@@ -140,26 +191,53 @@ struct glTF
   /**
    * MESH interface
    */
+  /**
+   * Returns a strided view of the accessor's elements, which is empty if the
+   * accessor is invalid or does not fit within its buffer view
+   */
+  glTF_AccessorView GetAccessorView(uint32_t accessorIndex) const;
+
+  /**
+   * Returns the requested attributes interleaved in the given order, without
+   * copying them if the file already stores them that way
+   * @return
+   */
+  glTF_VertexData GetMeshVertexData(const glTF_Mesh& mesh, const std::vector<glTFAttributeType>& attrTypes) const;
+
   /**
    * Returns a copy of attribute buffer
    * @return
    */
-  std::vector<unsigned char> GetMeshAttributeBuffer(const glTF_Mesh& mesh, const std::vector<glTFAttributeType>& attrTypes);
+  std::vector<unsigned char> GetMeshAttributeBuffer(const glTF_Mesh& mesh, const std::vector<glTFAttributeType>& attrTypes) const;
   uint32_t                   GetMeshAttributeCount(const glTF_Mesh* mesh) const;
   const glTF_Mesh*           FindMeshByName(const std::string& name) const;
 
   /**
-   * Returns a copy of index buffer
+   * Returns a strided view of the index buffer, which may hold 8, 16 or 32 bit
+   * indices (see glTF_AccessorView::componentType)
+   */
+  glTF_AccessorView GetMeshIndexView(const glTF_Mesh* mesh) const;
+
+  /**
+   * Returns a copy of index buffer, empty if an index does not fit in 16 bits
    * @return
    */
   std::vector<uint16_t> GetMeshIndexBuffer(const glTF_Mesh* mesh) const;
 
+  /**
+   * Returns a copy of index buffer widened to 32 bits
+   * @return
+   */
+  std::vector<uint32_t> GetMeshIndexBuffer32(const glTF_Mesh* mesh) const;
+
   const glTF_Node* FindNodeByName(const std::string& name) const;
 
 private:
+  struct JsonHandler;
+
   void LoadFromFile(const std::string& filename);
 
-  glTF_Buffer LoadFile(const std::string& filename);
+  bool LoadFile(const std::string& filename, DemoHelper::MemoryMappedFile& file);
 
   bool ParseJSON();
 
@@ -170,11 +248,8 @@ private:
   std::vector<glTF_Node>       mNodes;
   std::vector<glTF_Material>   mMaterials;
   std::vector<glTF_Texture>    mTextures;
-  glTF_Buffer                  mBuffer;
-  glTF_Buffer                  jsonBuffer;
-
-  // json nodes
-  picojson::value jsonNode;
+  DemoHelper::MemoryMappedFile mBuffer;
+  DemoHelper::MemoryMappedFile jsonBuffer;
 };
 
 #endif //DALI_CMAKE_GLTF_SCENE_H
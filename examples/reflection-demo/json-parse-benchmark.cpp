@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// HEADER
+#include "json-parse-benchmark.h"
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#if __GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33)
+#define REFLECTION_DEMO_SAMPLE_HEAP 1
+#endif
+#endif
+
+// INTERNAL INCLUDES
+#include "gltf-scene.h"
+#include "shared/json-stream-parser.h"
+#include "shared/memory-mapped-file.h"
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+/**
+ * Measures the heap retained relative to when it was created, from the
+ * allocator's own statistics, so nothing outside a measurement pays for it.
+ * Only what is still allocated when Sample() is called is seen, so this is
+ * not the peak: transient allocations freed during a parse are missed
+ */
+class HeapSampler
+{
+public:
+  explicit HeapSampler(bool enabled)
+  : mBaseBytes(enabled ? GetHeapInUse() : -1)
+  {
+  }
+
+  /**
+   * Samples the heap in use; called by a parse while its result is still alive
+   */
+  void Sample()
+  {
+    if(mBaseBytes >= 0)
+    {
+      mBytes = std::max(mBytes, GetHeapInUse() - mBaseBytes);
+    }
+  }
+
+  /**
+   * @return The largest retained heap sampled, or -1 if it was not measured
+   */
+  int64_t GetBytes() const
+  {
+    return mBaseBytes < 0 ? -1 : mBytes;
+  }
+
+private:
+  static int64_t GetHeapInUse()
+  {
+#ifdef REFLECTION_DEMO_SAMPLE_HEAP
+    const struct mallinfo2 info = mallinfo2();
+    return int64_t(info.uordblks + info.hblkhd);
+#else
+    return -1;
+#endif
+  }
+
+  int64_t mBaseBytes;
+  int64_t mBytes{0};
+};
+
+struct Measurement
+{
+  double  milliseconds{0.0};
+  int64_t retainedBytes{-1}; // -1 if unknown
+  bool    success{true};
+};
+
+/**
+ * Runs parse iterations times, returning the median time and the heap retained
+ * by the result of the first run; parse samples it before destroying its result
+ */
+template<class Parse>
+Measurement Measure(unsigned int iterations, Parse parse)
+{
+  Measurement         measurement{};
+  std::vector<double> times{};
+  for(auto i = 0u; i < iterations; ++i)
+  {
+    HeapSampler sampler(i == 0u);
+
+    auto start = Clock::now();
+    measurement.success &= parse(sampler);
+    times.push_back(std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+
+    if(i == 0u)
+    {
+      measurement.retainedBytes = sampler.GetBytes();
+    }
+  }
+
+  std::sort(times.begin(), times.end());
+  measurement.milliseconds = times[times.size() / 2];
+  return measurement;
+}
+
+/**
+ * Counts the values, so the parse cannot be optimised away
+ */
+struct CountingHandler : public DemoHelper::JsonStreamHandler
+{
+  bool OnNumber(const DemoHelper::JsonPath&, double) override
+  {
+    ++count;
+    return true;
+  }
+
+  bool OnString(const DemoHelper::JsonPath&, const std::string&) override
+  {
+    ++count;
+    return true;
+  }
+
+  size_t count{0u};
+};
+
+/**
+ * Creates a glTF-like document with the given number of nodes
+ */
+std::string CreateSyntheticDocument(unsigned int nodeCount)
+{
+  std::string json = "{ \"asset\": { \"version\": \"2.0\" }, \"nodes\": [";
+  json.reserve(size_t(nodeCount) * 192u);
+
+  char node[256];
+  for(auto i = 0u; i < nodeCount; ++i)
+  {
+    snprintf(node, sizeof(node), "%s\n  { \"name\": \"node_%u\", \"mesh\": %u, \"translation\": [ %f, %f, %f ], \"rotation\": [ 0.0, 0.0, 0.0, 1.0 ], \"scale\": [ 1.0, 1.0, 1.0 ], \"children\": [ %u ] }", i ? "," : "", i, i % 16u, i * 0.5f, i * 0.25f, -float(i), i + 1u);
+    json += node;
+  }
+  json += "\n] }";
+  return json;
+}
+
+void PrintRow(const std::string& name, size_t bytes, const Measurement& dom, const Measurement& stream)
+{
+  printf("%-40s %10zu %10.3f %10.3f %7.1fx", name.c_str(), bytes, dom.milliseconds, stream.milliseconds, stream.milliseconds > 0.0 ? dom.milliseconds / stream.milliseconds : 0.0);
+  if(dom.retainedBytes >= 0)
+  {
+    printf(" %16.1f %19.1f\n", dom.retainedBytes / 1024.0, stream.retainedBytes / 1024.0);
+  }
+  else
+  {
+    printf(" %16s %19s\n", "n/a", "n/a");
+  }
+}
+
+} // namespace
+
+bool RunJsonParseBenchmark(const std::vector<std::string>& files, unsigned int iterations, unsigned int syntheticNodes)
+{
+  bool success = true;
+  iterations   = std::max(iterations, 1u);
+
+  printf("%-40s %10s %10s %10s %8s %16s %19s\n", "document", "bytes", "dom(ms)", "stream(ms)", "speedup", "dom retained(KB)", "stream retained(KB)");
+
+  auto benchmark = [&](const std::string& name, const char* begin, const char* end) {
+    auto dom = Measure(iterations, [begin, end](HeapSampler& sampler) {
+      picojson::value root;
+      std::string     error;
+      picojson::parse(root, begin, end, &error);
+      sampler.Sample();
+      return error.empty();
+    });
+
+    auto stream = Measure(iterations, [begin, end](HeapSampler& sampler) {
+      CountingHandler handler;
+      const bool      success = DemoHelper::ParseJsonStream(begin, end, handler).empty();
+      sampler.Sample();
+      return success;
+    });
+
+    PrintRow(name, size_t(end - begin), dom, stream);
+    if(!dom.success || !stream.success)
+    {
+      printf("  FAILED to parse %s\n", name.c_str());
+      success = false;
+    }
+  };
+
+  for(const auto& file : files)
+  {
+    DemoHelper::MemoryMappedFile mappedFile(file);
+    if(!mappedFile)
+    {
+      printf("%-40s could not be read\n", file.c_str());
+      success = false;
+      continue;
+    }
+    benchmark(file, mappedFile.GetData(), mappedFile.GetData() + mappedFile.GetSize());
+
+    // Complete glTF load: maps the .bin and streams the json into the glTF structures
+    const std::string extension = ".gltf";
+    if(file.size() > extension.size() && file.compare(file.size() - extension.size(), extension.size(), extension) == 0)
+    {
+      const std::string basePath = file.substr(0, file.size() - extension.size());
+      auto              load     = Measure(iterations, [&basePath](HeapSampler& sampler) {
+        glTF gltf(basePath);
+        sampler.Sample();
+        return !gltf.GetNodes().empty();
+      });
+      printf("  glTF load (stream into structures): %.3f ms, retained heap %.1f KB\n", load.milliseconds, load.retainedBytes / 1024.0);
+    }
+  }
+
+  if(syntheticNodes)
+  {
+    const std::string document = CreateSyntheticDocument(syntheticNodes);
+    benchmark("synthetic (" + std::to_string(syntheticNodes) + " nodes)", document.data(), document.data() + document.size());
+  }
+
+  return success;
+}
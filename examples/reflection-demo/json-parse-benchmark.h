@@ -0,0 +1,42 @@
+#ifndef JSON_PARSE_BENCHMARK_H
+#define JSON_PARSE_BENCHMARK_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <string>
+#include <vector>
+
+/**
+ * Compares parsing JSON into a picojson DOM, as the loaders used to, with
+ * streaming it through DemoHelper::ParseJsonStream().
+ *
+ * Each file, plus a synthetic glTF-like document with syntheticNodes nodes, is
+ * parsed iterations times each way and the median parse time and the heap retained
+ * by the parsed result (from glibc's mallinfo2(), n/a elsewhere) are printed to stdout. This is not the peak heap
+ * use: memory allocated & freed again during the parse is not counted. Files ending in .gltf are also loaded in
+ * full with glTF, which streams straight into its structures.
+ *
+ * @param[in] files The JSON files to parse
+ * @param[in] iterations The number of times each document is parsed each way
+ * @param[in] syntheticNodes The number of nodes in the synthetic document, 0 to skip it
+ * @return false if a document failed to parse
+ */
+bool RunJsonParseBenchmark(const std::vector<std::string>& files, unsigned int iterations, unsigned int syntheticNodes);
+
+#endif // JSON_PARSE_BENCHMARK_H
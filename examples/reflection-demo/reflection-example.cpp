@@ -19,9 +19,14 @@
 #include <dali/devel-api/actors/camera-actor-devel.h>
 #include <dali/devel-api/adaptor-framework/file-stream.h>
 
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
 #include <map>
 
 #include "gltf-scene.h"
+#include "json-parse-benchmark.h"
+#include "shared/launch-latency.h"
 
 using namespace Dali;
 
@@ -245,14 +250,14 @@ ModelPtr CreateModel(
   const std::string& fragmentShaderSource)
 {
   /*
-   * Obtain interleaved buffer for first mesh with position and normal attributes
+   * Obtain interleaved data for first mesh with position and normal attributes,
+   * which points straight into the mapped file if it is already interleaved
    */
-  auto positionBuffer = gltf.GetMeshAttributeBuffer(*mesh,
-                                                    {glTFAttributeType::POSITION,
-                                                     glTFAttributeType::NORMAL,
-                                                     glTFAttributeType::TEXCOORD_0});
+  auto vertexData = gltf.GetMeshVertexData(*mesh,
+                                           {glTFAttributeType::POSITION,
+                                            glTFAttributeType::NORMAL,
+                                            glTFAttributeType::TEXCOORD_0});
 
-  auto attributeCount = gltf.GetMeshAttributeCount(mesh);
   /**
    * Create matching property buffer
    */
@@ -261,13 +266,42 @@ ModelPtr CreateModel(
                                           .Add("aNormal", Property::VECTOR3)
                                           .Add("aTexCoord", Property::VECTOR2));
 
-  // set vertex data
-  vertexBuffer.SetData(positionBuffer.data(), attributeCount);
+  auto geometry  = Geometry::New();
+  auto indexView = gltf.GetMeshIndexView(mesh);
+  if(indexView.componentType == 0x1403 && indexView.IsTightlyPacked() && (reinterpret_cast<uintptr_t>(indexView.data) % alignof(uint16_t)) == 0) // GL_UNSIGNED_SHORT
+  {
+    // 16 bit indices can be used as they are
+    vertexBuffer.SetData(vertexData.data, vertexData.count);
+    geometry.SetIndexBuffer(reinterpret_cast<const uint16_t*>(indexView.data), indexView.count);
+  }
+  else if(!indexView)
+  {
+    // Meshes without indices draw their vertices in order
+    vertexBuffer.SetData(vertexData.data, vertexData.count);
+  }
+  else if(auto indexBuffer = gltf.GetMeshIndexBuffer(mesh); !indexBuffer.empty())
+  {
+    vertexBuffer.SetData(vertexData.data, vertexData.count);
+    geometry.SetIndexBuffer(indexBuffer.data(), indexBuffer.size());
+  }
+  else
+  {
+    // Index buffers are 16 bit, so draw meshes with larger indices without one
+    auto indexBuffer32 = gltf.GetMeshIndexBuffer32(mesh);
 
-  auto geometry = Geometry::New();
+    std::vector<unsigned char> vertices(indexBuffer32.size() * vertexData.byteStride);
+    auto*                      dstPtr = vertices.data();
+    for(auto index : indexBuffer32)
+    {
+      if(index < vertexData.count)
+      {
+        memcpy(dstPtr, vertexData.data + size_t(index) * vertexData.byteStride, vertexData.byteStride);
+      }
+      dstPtr += vertexData.byteStride;
+    }
+    vertexBuffer.SetData(vertices.data(), indexBuffer32.size());
+  }
   geometry.AddVertexBuffer(vertexBuffer);
-  auto indexBuffer = gltf.GetMeshIndexBuffer(mesh);
-  geometry.SetIndexBuffer(indexBuffer.data(), indexBuffer.size());
   geometry.SetType(Geometry::Type::TRIANGLES);
   ModelPtr retval(new Model());
   retval->shader   = CreateShader(vertexShaderSource, fragmentShaderSource);
@@ -666,8 +700,32 @@ private:
 
 int DALI_EXPORT_API main(int argc, char** argv)
 {
+  if(argc > 1 && std::string(argv[1]) == "--benchmark-json")
+  {
+    unsigned int             iterations = 10u;
+    std::vector<std::string> files;
+    for(int i = 2; i < argc; ++i)
+    {
+      std::string arg(argv[i]);
+      if(!arg.empty() && isdigit(arg[0]))
+      {
+        iterations = atoi(arg.c_str());
+      }
+      else
+      {
+        files.push_back(arg);
+      }
+    }
+    if(files.empty())
+    {
+      files = {DEMO_GAME_DIR "/reflection.gltf", DEMO_GAME_DIR "/scene.json"};
+    }
+    return RunJsonParseBenchmark(files, iterations, 100000u) ? 0 : 1;
+  }
+
   Application       application = Application::New(&argc, &argv);
   ReflectionExample test(application);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
   return 0;
 }
@@ -26,6 +26,7 @@
 #include <sstream>
 
 // INTERNAL INCLUDES
+#include "shared/launch-latency.h"
 #include "shared/utility.h"
 #include "shared/view.h"
 
@@ -603,6 +604,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application             app = Application::New(&argc, &argv, DEMO_THEME_PATH);
   RefractionEffectExample theApp(app);
+  DemoHelper::ReportLaunchLatency(app);
   app.MainLoop();
   return 0;
 }
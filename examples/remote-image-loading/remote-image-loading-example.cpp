@@ -22,6 +22,8 @@
 #include <stdlib.h>
 #include <iostream>
 
+#include "shared/launch-latency.h"
+
 using namespace Dali;
 using namespace Dali::Toolkit;
 
@@ -209,6 +211,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application application = Application::New(&argc, &argv, "");
   MyTester    test(application);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
   return 0;
 }
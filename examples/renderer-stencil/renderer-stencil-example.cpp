@@ -20,6 +20,7 @@
 
 // INTERNAL INCLUDES
 #include "renderer-stencil-shaders.h"
+#include "shared/launch-latency.h"
 #include "shared/utility.h"
 #include "shared/view.h"
 
@@ -745,6 +746,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application            application = Application::New(&argc, &argv);
   RendererStencilExample example(application);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
   return 0;
 }
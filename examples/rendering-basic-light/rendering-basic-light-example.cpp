@@ -18,6 +18,8 @@
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali/dali.h>
 
+#include "shared/launch-latency.h"
+
 using namespace Dali;
 using namespace Toolkit;
 
@@ -400,6 +402,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application          application = Application::New(&argc, &argv, BASIC_LIGHT_THEME);
   BasicLightController test(application);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
   return 0;
 }
@@ -19,14 +19,25 @@
 #include "ktx-loader.h"
 
 // EXTERNAL INCLUDES
-#include <dali/devel-api/adaptor-framework/file-stream.h>
 #include <dali/integration-api/debug.h>
-#include <memory.h>
-#include <stdint.h>
-#include <stdio.h>
+#include <dali/public-api/images/pixel-data.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+// INTERNAL INCLUDES
+#include "shared/memory-mapped-file.h"
 
 namespace PbrDemo
 {
+namespace
+{
+const uint8_t  KTX1_IDENTIFIER[12] = {0xAB, 'K', 'T', 'X', ' ', '1', '1', 0xBB, '\r', '\n', 0x1A, '\n'};
+const uint8_t  KTX2_IDENTIFIER[12] = {0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n'};
+const uint32_t KTX1_ENDIANNESS(0x04030201);
+const uint32_t CUBE_FACE_COUNT(6u);
+
 struct KtxFileHeader
 {
   char     identifier[12];
@@ -45,11 +56,54 @@ struct KtxFileHeader
   uint32_t bytesOfKeyValueData;
 };
 
+struct Ktx2FileHeader
+{
+  char     identifier[12];
+  uint32_t vkFormat;
+  uint32_t typeSize;
+  uint32_t pixelWidth;
+  uint32_t pixelHeight;
+  uint32_t pixelDepth;
+  uint32_t layerCount;
+  uint32_t faceCount; //Cube map faces are stored in the same order as KTX 1.
+  uint32_t levelCount;
+  uint32_t supercompressionScheme;
+  uint32_t dfdByteOffset;
+  uint32_t dfdByteLength;
+  uint32_t kvdByteOffset;
+  uint32_t kvdByteLength;
+  uint64_t sgdByteOffset;
+  uint64_t sgdByteLength;
+};
+
+struct Ktx2LevelIndex
+{
+  uint64_t byteOffset;
+  uint64_t byteLength;
+  uint64_t uncompressedByteLength;
+};
+
+/**
+ * How the pixels in the file are converted before they are uploaded.
+ */
+enum class Conversion
+{
+  NONE,           ///< Uploaded as they are.
+  PACKED_TO_HALF, ///< Packed R11F_G11F_B10F, unpacked to RGB16F.
+  FLOAT_TO_HALF   ///< RGB 32 bit floats, rounded to RGB16F.
+};
+
+inline size_t AlignTo4(size_t offset)
+{
+  return (offset + 3u) & ~size_t(3u);
+}
+
 /**
  * Convert KTX format to Dali::Pixel::Format
  */
-bool ConvertPixelFormat(const uint32_t ktxPixelFormat, Dali::Pixel::Format& format)
+bool ConvertPixelFormat(const uint32_t ktxPixelFormat, const uint32_t glType, Dali::Pixel::Format& format, Conversion& conversion)
 {
+  conversion = Conversion::NONE;
   switch(ktxPixelFormat)
   {
     case 0x93B0: // GL_COMPRESSED_RGBA_ASTC_4x4_KHR
@@ -69,7 +123,28 @@ bool ConvertPixelFormat(const uint32_t ktxPixelFormat, Dali::Pixel::Format& form
     }
     case 0x8C3A: // GL_R11F_G11F_B10F
     {
-      format = Dali::Pixel::RGB32F;
+      format = Dali::Pixel::RGB16F;
+      switch(glType)
+      {
+        case 0x8C3B: // GL_UNSIGNED_INT_10F_11F_11F_REV
+        {
+          conversion = Conversion::PACKED_TO_HALF;
+          break;
+        }
+        case 0x1406: // GL_FLOAT
+        {
+          conversion = Conversion::FLOAT_TO_HALF;
+          break;
+        }
+        case 0x140B: // GL_HALF_FLOAT
+        {
+          break;
+        }
+        default:
+        {
+          return false;
+        }
+      }
       break;
     }
     case 0x8D7C: // GL_RGBA8UI
@@ -91,94 +166,356 @@ bool ConvertPixelFormat(const uint32_t ktxPixelFormat, Dali::Pixel::Format& form
   return true;
 }
 
-bool LoadCubeMapFromKtxFile(const std::string& path, CubeData& cubedata)
+/**
+ * Convert KTX 2 (Vulkan) format to Dali::Pixel::Format
+ */
+bool ConvertVkFormat(const uint32_t vkFormat, Dali::Pixel::Format& format, Conversion& conversion)
+{
+  conversion = Conversion::NONE;
+  switch(vkFormat)
+  {
+    case 23: // VK_FORMAT_R8G8B8_UNORM
+    {
+      format = Dali::Pixel::RGB888;
+      break;
+    }
+    case 37: // VK_FORMAT_R8G8B8A8_UNORM
+    {
+      format = Dali::Pixel::RGBA8888;
+      break;
+    }
+    case 90: // VK_FORMAT_R16G16B16_SFLOAT
+    {
+      format = Dali::Pixel::RGB16F;
+      break;
+    }
+    case 106: // VK_FORMAT_R32G32B32_SFLOAT
+    {
+      format = Dali::Pixel::RGB32F;
+      break;
+    }
+    case 122: // VK_FORMAT_B10G11R11_UFLOAT_PACK32
+    {
+      format     = Dali::Pixel::RGB16F;
+      conversion = Conversion::PACKED_TO_HALF;
+      break;
+    }
+    case 157: // VK_FORMAT_ASTC_4x4_UNORM_BLOCK
+    {
+      format = Dali::Pixel::COMPRESSED_RGBA_ASTC_4x4_KHR;
+      break;
+    }
+    default:
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/**
+ * Converts an unsigned 11 or 10 bit float to a half float. They all have a 5 bit exponent with the same bias,
+ * so only the mantissa has to be widened and the conversion is exact, including denormals, infinity & NaN.
+ */
+inline uint16_t SmallFloatToHalf(uint32_t value, uint32_t mantissaBits)
+{
+  const uint32_t exponent = value >> mantissaBits;
+  const uint32_t mantissa = value & ((1u << mantissaBits) - 1u);
+  return static_cast<uint16_t>((exponent << 10u) | (mantissa << (10u - mantissaBits)));
+}
+
+/**
+ * Rounds a float to the nearest half float.
+ */
+inline uint16_t FloatToHalf(float value)
+{
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+
+  const uint32_t sign     = (bits >> 16u) & 0x8000u;
+  const uint32_t exponent = (bits >> 23u) & 0xFFu;
+  const uint32_t mantissa = bits & 0x7FFFFFu;
+  if(exponent == 0xFFu) // Infinity & NaN
+  {
+    return static_cast<uint16_t>(sign | 0x7C00u | (mantissa ? 0x200u : 0u));
+  }
+
+  const int halfExponent = static_cast<int>(exponent) - 127 + 15;
+  if(halfExponent >= 31) // Too large: infinity
+  {
+    return static_cast<uint16_t>(sign | 0x7C00u);
+  }
+  if(halfExponent <= 0) // Denormal, or too small: zero
+  {
+    if(halfExponent < -10)
+    {
+      return static_cast<uint16_t>(sign);
+    }
+    const uint32_t shift = static_cast<uint32_t>(14 - halfExponent);
+    return static_cast<uint16_t>(sign | (((mantissa | 0x800000u) + (1u << (shift - 1u))) >> shift));
+  }
+
+  // A carry out of the mantissa when rounding correctly increments the exponent, up to infinity.
+  const uint32_t half = ((static_cast<uint32_t>(halfExponent) << 10u) | (mantissa >> 13u)) + ((mantissa >> 12u) & 1u);
+  return static_cast<uint16_t>(sign | half);
+}
+
+/**
+ * Uploads a face of a mipmap from the mapped file, converting it if necessary.
+ *
+ * PixelData has to own its buffer, so the face is copied (or converted) into one which is released
+ * as soon as the upload has been queued.
+ */
+bool UploadFace(Texture& texture, const char* data, size_t size, uint32_t face, uint32_t mipmap, uint32_t width, uint32_t height, Pixel::Format format, Conversion conversion, KtxLoadStatistics& statistics)
 {
-  std::unique_ptr<FILE, void (*)(FILE*)> fp(fopen(path.c_str(), "rb"), [](FILE* fp) {
-    if(fp)
+  const size_t pixelCount = size_t(width) * height;
+  size_t       bufferSize = size;
+  switch(conversion)
+  {
+    case Conversion::NONE:
+    {
+      break;
+    }
+    case Conversion::PACKED_TO_HALF:
+    {
+      if(size < pixelCount * sizeof(uint32_t))
+      {
+        return false;
+      }
+      bufferSize = pixelCount * 3u * sizeof(uint16_t);
+      break;
+    }
+    case Conversion::FLOAT_TO_HALF:
+    {
+      if(size < pixelCount * 3u * sizeof(float))
+      {
+        return false;
+      }
+      bufferSize = pixelCount * 3u * sizeof(uint16_t);
+      break;
+    }
+  }
+
+  uint8_t* buffer = static_cast<uint8_t*>(malloc(bufferSize)); // freed when the PixelData is destroyed.
+  if(!buffer)
+  {
+    return false;
+  }
+
+  uint16_t* half = reinterpret_cast<uint16_t*>(buffer);
+  switch(conversion)
+  {
+    case Conversion::NONE:
     {
-      fclose(fp);
+      memcpy(buffer, data, size);
+      break;
+    }
+    case Conversion::PACKED_TO_HALF:
+    {
+      for(size_t i = 0u; i < pixelCount; ++i, half += 3)
+      {
+        uint32_t packed;
+        memcpy(&packed, data + i * sizeof(packed), sizeof(packed));
+        half[0] = SmallFloatToHalf(packed & 0x7FFu, 6u);
+        half[1] = SmallFloatToHalf((packed >> 11u) & 0x7FFu, 6u);
+        half[2] = SmallFloatToHalf(packed >> 22u, 5u);
+      }
+      break;
     }
-  });
-  if(!fp)
+    case Conversion::FLOAT_TO_HALF:
+    {
+      for(size_t i = 0u; i < pixelCount * 3u; ++i)
+      {
+        float value;
+        memcpy(&value, data + i * sizeof(value), sizeof(value));
+        half[i] = FloatToHalf(value);
+      }
+      break;
+    }
+  }
+
+  PixelData pixelData = PixelData::New(buffer, bufferSize, width, height, format, PixelData::FREE);
+  if(!texture.Upload(pixelData, CubeMapLayer::POSITIVE_X + face, mipmap, 0u, 0u, width, height))
   {
     return false;
   }
 
+  statistics.bytesRead += size;
+  statistics.bytesUploaded += bufferSize;
+  return true;
+}
+
+bool LoadKtx1(const DemoHelper::MemoryMappedFile& file, const std::string& path, Texture& texture, KtxLoadStatistics& statistics)
+{
   KtxFileHeader header;
-  int           result = fread(&header, sizeof(KtxFileHeader), 1u, fp.get());
-  if(0 == result)
+  memcpy(&header, file.GetData(), sizeof(header));
+  if(header.endianness != KTX1_ENDIANNESS)
   {
+    DALI_LOG_ERROR("%s: byte swapped KTX files are not supported\n", path.c_str());
     return false;
   }
 
-  // Skip the key-values:
-  if(fseek(fp.get(), header.bytesOfKeyValueData, SEEK_CUR))
+  if(header.numberOfFaces != CUBE_FACE_COUNT || header.numberOfArrayElements > 1u || header.pixelDepth > 1u)
   {
+    DALI_LOG_ERROR("%s: not a cube map\n", path.c_str());
     return false;
   }
 
-  cubedata.img.resize(header.numberOfFaces);
+  Pixel::Format format;
+  Conversion    conversion;
+  if(!ConvertPixelFormat(header.glInternalFormat, header.glType, format, conversion))
+  {
+    DALI_LOG_ERROR("%s: unsupported format 0x%x (type 0x%x)\n", path.c_str(), header.glInternalFormat, header.glType);
+    return false;
+  }
+
+  uint32_t       width   = header.pixelWidth;
+  uint32_t       height  = std::max(header.pixelHeight, 1u);
+  const uint32_t mipmaps = std::max(header.numberOfMipmapLevels, 1u);
+
+  texture = Texture::New(TextureType::TEXTURE_CUBE, format, width, height);
 
-  for(unsigned int face = 0; face < header.numberOfFaces; ++face) //array_element must be 0 or 1
+  // Skip the key-values:
+  size_t offset = sizeof(header) + header.bytesOfKeyValueData;
+  statistics.bytesRead += sizeof(header);
+  for(uint32_t mipmapLevel = 0u; mipmapLevel < mipmaps; ++mipmapLevel)
   {
-    cubedata.img[face].resize(header.numberOfMipmapLevels);
+    uint32_t imageSize; // The size of each face of a (non-array) cube map.
+    if(offset + sizeof(imageSize) > file.GetSize())
+    {
+      return false;
+    }
+    memcpy(&imageSize, file.GetData() + offset, sizeof(imageSize));
+    offset += sizeof(imageSize);
+    statistics.bytesRead += sizeof(imageSize);
+
+    for(uint32_t face = 0u; face < CUBE_FACE_COUNT; ++face)
+    {
+      if(offset + imageSize > file.GetSize() ||
+         !UploadFace(texture, file.GetData() + offset, imageSize, face, mipmapLevel, width, height, format, conversion, statistics))
+      {
+        return false;
+      }
+      offset = AlignTo4(offset + imageSize); // Each face is padded to 4 bytes.
+    }
+
+    width  = std::max(width / 2u, 1u);
+    height = std::max(height / 2u, 1u);
+    ++statistics.mipmaps;
   }
 
-  if(0 == header.numberOfMipmapLevels)
+  statistics.converted = conversion != Conversion::NONE;
+  return true;
+}
+
+bool LoadKtx2(const DemoHelper::MemoryMappedFile& file, const std::string& path, Texture& texture, KtxLoadStatistics& statistics)
+{
+  Ktx2FileHeader header;
+  if(file.GetSize() < sizeof(header))
   {
-    header.numberOfMipmapLevels = 1u;
+    return false;
   }
+  memcpy(&header, file.GetData(), sizeof(header));
 
-  if(0 == header.numberOfArrayElements)
+  if(header.faceCount != CUBE_FACE_COUNT || header.layerCount > 1u || header.pixelDepth > 1u)
   {
-    header.numberOfArrayElements = 1u;
+    DALI_LOG_ERROR("%s: not a cube map\n", path.c_str());
+    return false;
   }
 
-  if(0 == header.pixelDepth)
+  if(header.supercompressionScheme != 0u)
   {
-    header.pixelDepth = 1u;
+    DALI_LOG_ERROR("%s: supercompression is not supported\n", path.c_str());
+    return false;
   }
 
-  if(0 == header.pixelHeight)
+  Pixel::Format format;
+  Conversion    conversion;
+  if(!ConvertVkFormat(header.vkFormat, format, conversion))
   {
-    header.pixelHeight = 1u;
+    DALI_LOG_ERROR("%s: unsupported format %u\n", path.c_str(), header.vkFormat);
+    return false;
   }
 
-  Dali::Pixel::Format daliformat = Pixel::RGB888;
+  uint32_t       width   = header.pixelWidth;
+  uint32_t       height  = std::max(header.pixelHeight, 1u);
+  const uint32_t mipmaps = std::max(header.levelCount, 1u);
+  const size_t   indexSize(sizeof(Ktx2LevelIndex) * mipmaps);
+  if(sizeof(header) + indexSize > file.GetSize())
+  {
+    return false;
+  }
+  statistics.bytesRead += sizeof(header) + indexSize;
 
-  ConvertPixelFormat(header.glInternalFormat, daliformat);
+  texture = Texture::New(TextureType::TEXTURE_CUBE, format, width, height);
 
-  for(unsigned int mipmapLevel = 0; mipmapLevel < header.numberOfMipmapLevels; ++mipmapLevel)
+  // The level index starts with the largest mipmap, although the data is stored smallest first.
+  for(uint32_t mipmapLevel = 0u; mipmapLevel < mipmaps; ++mipmapLevel)
   {
-    uint32_t byteSize = 0;
-    if(fread(&byteSize, sizeof(byteSize), 1u, fp.get()) != 1)
+    Ktx2LevelIndex level;
+    memcpy(&level, file.GetData() + sizeof(header) + mipmapLevel * sizeof(level), sizeof(level));
+    if(level.byteOffset + level.byteLength > file.GetSize())
     {
       return false;
     }
 
-    if(0 != byteSize % 4u)
-    {
-      byteSize += 4u - byteSize % 4u;
-    }
-
-    for(unsigned int arrayElement = 0; arrayElement < header.numberOfArrayElements; ++arrayElement) // arrayElement must be 0 or 1
+    // The faces of a level are stored one after the other, without padding.
+    const size_t faceSize = level.byteLength / CUBE_FACE_COUNT;
+    for(uint32_t face = 0u; face < CUBE_FACE_COUNT; ++face)
     {
-      for(unsigned int face = 0; face < header.numberOfFaces; ++face)
+      if(!UploadFace(texture, file.GetData() + level.byteOffset + face * faceSize, faceSize, face, mipmapLevel, width, height, format, conversion, statistics))
       {
-        std::unique_ptr<uint8_t, void (*)(void*)> img(static_cast<unsigned char*>(malloc(byteSize)), free); // resources will be freed when the PixelData is destroyed.
-        if(fread(img.get(), byteSize, 1u, fp.get()) != 1)
-        {
-          return false;
-        }
-        cubedata.img[face][mipmapLevel] = PixelData::New(img.release(), byteSize, header.pixelWidth, header.pixelHeight, daliformat, PixelData::FREE);
+        return false;
       }
     }
 
-    header.pixelHeight /= 2u;
-    header.pixelWidth /= 2u;
+    width  = std::max(width / 2u, 1u);
+    height = std::max(height / 2u, 1u);
+    ++statistics.mipmaps;
   }
 
+  statistics.converted = conversion != Conversion::NONE;
   return true;
 }
 
+} // namespace
+
+bool LoadCubeMapFromKtxFile(const std::string& path, Texture& texture, KtxLoadStatistics* statistics)
+{
+  KtxLoadStatistics  ownStatistics;
+  KtxLoadStatistics& stats = statistics ? *statistics : ownStatistics;
+  stats                    = KtxLoadStatistics();
+
+  DemoHelper::MemoryMappedFile file(path);
+  if(!file || file.GetSize() < sizeof(KtxFileHeader))
+  {
+    return false;
+  }
+
+  stats.fileSize = file.GetSize();
+  stats.mapped   = file.IsMapped();
+  stats.faces    = CUBE_FACE_COUNT;
+
+  bool loaded = false;
+  if(memcmp(file.GetData(), KTX1_IDENTIFIER, sizeof(KTX1_IDENTIFIER)) == 0)
+  {
+    loaded = LoadKtx1(file, path, texture, stats);
+  }
+  else if(memcmp(file.GetData(), KTX2_IDENTIFIER, sizeof(KTX2_IDENTIFIER)) == 0)
+  {
+    loaded = LoadKtx2(file, path, texture, stats);
+  }
+  else
+  {
+    DALI_LOG_ERROR("%s: not a KTX file\n", path.c_str());
+  }
+
+  if(!loaded)
+  {
+    texture.Reset();
+  }
+  return loaded;
+}
+
 } // namespace PbrDemo
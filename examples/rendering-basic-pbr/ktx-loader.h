@@ -19,28 +19,44 @@
  */
 
 // EXTERNAL INCLUDES
-#include <dali/public-api/common/vector-wrapper.h>
-#include <dali/public-api/images/pixel-data.h>
+#include <dali/public-api/rendering/texture.h>
+#include <cstddef>
+#include <string>
 
 using namespace Dali;
 
 namespace PbrDemo
 {
 /**
- * @brief Stores the pixel data objects for each face of the cube texture and their mipmaps.
+ * @brief What loading a cube map cost, to find out where the memory at startup goes.
  */
-struct CubeData
+struct KtxLoadStatistics
 {
-  std::vector<std::vector<Dali::PixelData> > img;
+  size_t       fileSize{0u};      ///< The size of the file.
+  size_t       bytesRead{0u};     ///< The bytes of the file which were read: the headers and the faces of every mipmap.
+  size_t       bytesUploaded{0u}; ///< The bytes passed to Texture::Upload(), after any conversion.
+  unsigned int faces{0u};         ///< The number of faces.
+  unsigned int mipmaps{0u};       ///< The number of mipmap levels uploaded.
+  bool         mapped{false};     ///< Whether the file was memory-mapped rather than read into memory.
+  bool         converted{false};  ///< Whether the pixels were converted to a format DALi can upload.
 };
 
 /**
- * @brief Loads a cube map texture from a ktx file.
+ * @brief Loads a cube map texture from a KTX (version 1 or 2) file.
+ *
+ * The file is memory-mapped and each face of each mipmap is uploaded as soon as it is read, so at most
+ * one face is held in memory besides the mapping.
+ *
+ * Packed R11F_G11F_B10F (B10G11R11_UFLOAT_PACK32 in KTX2) pixels, and R11F_G11F_B10F files which store
+ * them as 32 bit floats, are uploaded as RGB16F: the smallest floating point format DALi supports, which
+ * holds every packed value exactly.
  *
  * @param[in] path The file path.
- * @param[out] cubedata The data structure with all pixel data objects.
+ * @param[out] texture The cube texture, created by the loader.
+ * @param[out] statistics If not null, what loading the file cost.
+ * @return Whether the file could be loaded.
  */
-bool LoadCubeMapFromKtxFile(const std::string& path, CubeData& cubedata);
+bool LoadCubeMapFromKtxFile(const std::string& path, Texture& texture, KtxLoadStatistics* statistics = nullptr);
 
 } // namespace PbrDemo
 
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// HEADER
+#include "mesh-cache.h"
+
+// EXTERNAL INCLUDES
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include "shared/cache-directory.h"
+#include "shared/memory-mapped-file.h"
+
+namespace PbrDemo
+{
+namespace
+{
+// 'PBRM' tag in the native byte order
+const uint32_t PBRM_TAG(0x4D524250);
+const uint32_t MESH_CACHE_VERSION(2u);
+
+inline uint32_t AlignTo4(uint32_t offset)
+{
+  return (offset + 3u) & ~3u;
+}
+
+/**
+ * @brief Retrieves the path of the cache entry for the given OBJ file and parameters, empty if there is no cache directory.
+ */
+std::string GetCachePath(const std::string& url, int objectProperties, bool useSoftNormals)
+{
+  static const std::string cacheDirectory = DemoHelper::GetCacheDirectory("rendering-basic-pbr");
+  if(cacheDirectory.empty())
+  {
+    return cacheDirectory;
+  }
+
+  char key[64];
+  snprintf(key, sizeof(key), "%zx-%x%c.mesh", std::hash<std::string>()(url), objectProperties, useSoftNormals ? 's' : 'h');
+  return cacheDirectory + key;
+}
+
+} // namespace
+
+Dali::Geometry LoadCachedGeometry(const std::string& url, int objectProperties, bool useSoftNormals)
+{
+  uint64_t sourceSize;
+  int64_t  sourceModifiedTime;
+  if(!DemoHelper::GetFileSizeAndTime(url, sourceSize, sourceModifiedTime))
+  {
+    return Dali::Geometry();
+  }
+
+  const std::string cachePath = GetCachePath(url, objectProperties, useSoftNormals);
+  if(cachePath.empty())
+  {
+    return Dali::Geometry();
+  }
+
+  DemoHelper::MemoryMappedFile file(cachePath);
+  if(!file || file.GetSize() < sizeof(MeshCacheHeader))
+  {
+    return Dali::Geometry();
+  }
+
+  MeshCacheHeader header;
+  memcpy(&header, file.GetData(), sizeof(header));
+
+  // Validate the key and that every section lies within the file, so a truncated or foreign file is never uploaded.
+  const uint64_t vertexDataSize = uint64_t(header.vertexCount) * ObjLoader::GetVertexStride(header.attributes) * sizeof(float);
+  const uint64_t indexDataSize  = uint64_t(header.indexCount) * sizeof(unsigned short);
+  if(header.tag != PBRM_TAG ||
+     header.version != MESH_CACHE_VERSION ||
+     header.sourceSize != sourceSize ||
+     header.sourceModifiedTime != sourceModifiedTime ||
+     header.objectProperties != uint32_t(objectProperties) ||
+     header.useSoftNormals != uint32_t(useSoftNormals) ||
+     header.sourcePathLength != url.size() ||
+     sizeof(MeshCacheHeader) + header.sourcePathLength > file.GetSize() ||
+     url.compare(0, url.size(), file.GetData() + sizeof(MeshCacheHeader), header.sourcePathLength) != 0 ||
+     header.vertexDataOffset % 4u != 0u ||
+     header.indexDataOffset % 4u != 0u ||
+     header.vertexDataOffset + vertexDataSize > file.GetSize() ||
+     header.indexDataOffset + indexDataSize > file.GetSize())
+  {
+    return Dali::Geometry();
+  }
+
+  return ObjLoader::CreateGeometry(header.attributes,
+                                   reinterpret_cast<const float*>(file.GetData() + header.vertexDataOffset),
+                                   header.vertexCount,
+                                   reinterpret_cast<const unsigned short*>(file.GetData() + header.indexDataOffset),
+                                   header.indexCount);
+}
+
+bool StoreCachedGeometry(const std::string& url, int objectProperties, bool useSoftNormals, const ObjLoader::InterleavedData& data)
+{
+  MeshCacheHeader header;
+  memset(&header, 0, sizeof(header));
+  if(!DemoHelper::GetFileSizeAndTime(url, header.sourceSize, header.sourceModifiedTime))
+  {
+    return false;
+  }
+
+  const std::string cachePath = GetCachePath(url, objectProperties, useSoftNormals);
+  if(cachePath.empty())
+  {
+    return false;
+  }
+
+  header.tag              = PBRM_TAG;
+  header.version          = MESH_CACHE_VERSION;
+  header.objectProperties = objectProperties;
+  header.useSoftNormals   = useSoftNormals;
+  header.attributes       = data.attributes;
+  header.vertexCount      = data.vertices.Count() / ObjLoader::GetVertexStride(data.attributes);
+  header.indexCount       = data.indices.Count();
+  header.sourcePathLength = url.size();
+  header.vertexDataOffset = AlignTo4(sizeof(MeshCacheHeader) + header.sourcePathLength);
+  header.indexDataOffset  = AlignTo4(header.vertexDataOffset + data.vertices.Count() * sizeof(float));
+
+  return DemoHelper::WriteFileAtomically(cachePath, [&](FILE* file) {
+    const char   padding[4]  = {0, 0, 0, 0};
+    const size_t pathPadding = header.vertexDataOffset - (sizeof(MeshCacheHeader) + header.sourcePathLength);
+    const size_t dataPadding = header.indexDataOffset - (header.vertexDataOffset + data.vertices.Count() * sizeof(float));
+
+    return fwrite(&header, sizeof(header), 1, file) == 1 &&
+           fwrite(url.data(), 1, url.size(), file) == url.size() &&
+           fwrite(padding, 1, pathPadding, file) == pathPadding &&
+           fwrite(data.vertices.Begin(), sizeof(float), data.vertices.Count(), file) == data.vertices.Count() &&
+           fwrite(padding, 1, dataPadding, file) == dataPadding &&
+           fwrite(data.indices.Begin(), sizeof(unsigned short), data.indices.Count(), file) == data.indices.Count();
+  });
+}
+
+} // namespace PbrDemo
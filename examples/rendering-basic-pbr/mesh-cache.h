@@ -0,0 +1,79 @@
+#ifndef DALI_DEMO_PBR_MESH_CACHE_H
+#define DALI_DEMO_PBR_MESH_CACHE_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/rendering/geometry.h>
+#include <cstdint>
+#include <string>
+
+// INTERNAL INCLUDES
+#include "obj-loader.h"
+
+namespace PbrDemo
+{
+/**
+ * @brief The MeshCacheHeader struct
+ * Header of a cached mesh file, followed by the source path, the interleaved vertex data and the indices.
+ * Like the fpp-game '.mod' files, the data is ready to be copied directly into the GPU buffers.
+ * The cache is only ever read on the machine that wrote it, so everything is in native byte order.
+ */
+struct MeshCacheHeader
+{
+  uint32_t tag;                /// 'PBRM' tag, also used to reject files written with a different byte order
+  uint32_t version;            /// File version
+  uint64_t sourceSize;         /// Size of the OBJ file the mesh was generated from
+  int64_t  sourceModifiedTime; /// Modification time of the OBJ file the mesh was generated from, in nanoseconds
+  uint32_t objectProperties;   /// The ObjLoader::ObjectProperties requested when the mesh was generated
+  uint32_t useSoftNormals;     /// Whether soft normals were requested when the mesh was generated
+  uint32_t attributes;         /// The ObjLoader::ObjectProperties actually present in the vertex data
+  uint32_t vertexCount;        /// Number of vertices
+  uint32_t indexCount;         /// Number of 16-bit indices, may be 0
+  uint32_t sourcePathLength;   /// Length of the source path stored after the header
+  uint32_t vertexDataOffset;   /// Start of the vertex data, 4-byte aligned
+  uint32_t indexDataOffset;    /// Start of the index data, 4-byte aligned
+};
+
+/**
+ * @brief Loads the geometry of an OBJ file from the mesh cache.
+ *
+ * The cache file is memory-mapped and uploaded straight from the mapping, so neither the OBJ parsing
+ * nor the normal & tangent generation is repeated.
+ *
+ * @param[in] url The path of the OBJ file.
+ * @param[in] objectProperties The ObjectProperties the geometry needs.
+ * @param[in] useSoftNormals Whether the normals are averaged at each point.
+ * @return The geometry, or an empty handle if there is no valid cache entry for the file and parameters.
+ */
+Dali::Geometry LoadCachedGeometry(const std::string& url, int objectProperties, bool useSoftNormals);
+
+/**
+ * @brief Stores the interleaved data generated for an OBJ file in the mesh cache.
+ *
+ * @param[in] url The path of the OBJ file.
+ * @param[in] objectProperties The ObjectProperties the data was created with.
+ * @param[in] useSoftNormals Whether the data was created with soft normals.
+ * @param[in] data The data to store.
+ * @return Whether the data was stored.
+ */
+bool StoreCachedGeometry(const std::string& url, int objectProperties, bool useSoftNormals, const ObjLoader::InterleavedData& data);
+
+} // namespace PbrDemo
+
+#endif // DALI_DEMO_PBR_MESH_CACHE_H
@@ -19,11 +19,11 @@
 #include "model-pbr.h"
 
 // EXTERNAL INCLUDES
-#include <dali/devel-api/adaptor-framework/file-loader.h>
 #include <string.h>
 #include <cstdio>
 
 // INTERNAL INCLUDES
+#include "mesh-cache.h"
 #include "obj-loader.h"
 
 namespace
@@ -79,11 +79,13 @@ void ModelPbr::Init(Shader shader, const std::string& modelUrl, const Vector3& p
 /**
  * Set texture and sampler
  */
-void ModelPbr::InitTexture(Texture albedoM, Texture normalR, Texture texDiffuse, Texture texSpecular)
+void ModelPbr::InitTexture(Texture albedoM, Sampler albedoMSampler, Texture normalR, Sampler normalRSampler, Texture texDiffuse, Texture texSpecular)
 {
   mTextureSet = TextureSet::New();
   mTextureSet.SetTexture(0u, albedoM);
+  mTextureSet.SetSampler(0u, albedoMSampler);
   mTextureSet.SetTexture(1u, normalR);
+  mTextureSet.SetSampler(1u, normalRSampler);
   mTextureSet.SetTexture(2u, texDiffuse);
   mTextureSet.SetTexture(3u, texSpecular);
 
@@ -103,19 +105,23 @@ Actor& ModelPbr::GetActor()
  */
 Geometry ModelPbr::CreateGeometry(const std::string& url)
 {
-  std::streampos     fileSize;
-  Dali::Vector<char> fileContent;
+  const int  objectProperties = PbrDemo::ObjLoader::TEXTURE_COORDINATES | PbrDemo::ObjLoader::TANGENTS;
+  const bool useSoftNormals   = true;
 
-  Geometry geometry;
-
-  if(FileLoader::ReadFile(url, fileSize, fileContent, FileLoader::TEXT))
+  // Re-use the vertex data generated by a previous run if the model has not changed since.
+  Geometry geometry = PbrDemo::LoadCachedGeometry(url, objectProperties, useSoftNormals);
+  if(!geometry)
   {
     PbrDemo::ObjLoader objLoader;
-
-    objLoader.ClearArrays();
-    objLoader.LoadObject(fileContent.Begin(), fileSize);
-
-    geometry = objLoader.CreateGeometry(PbrDemo::ObjLoader::TEXTURE_COORDINATES | PbrDemo::ObjLoader::TANGENTS, true);
+    if(objLoader.LoadObject(url))
+    {
+      PbrDemo::ObjLoader::InterleavedData data;
+      objLoader.CreateInterleavedData(objectProperties, useSoftNormals, data);
+      PbrDemo::StoreCachedGeometry(url, objectProperties, useSoftNormals, data);
+
+      const unsigned int vertexCount = data.vertices.Count() / PbrDemo::ObjLoader::GetVertexStride(data.attributes);
+      geometry                       = PbrDemo::ObjLoader::CreateGeometry(data.attributes, data.vertices.Begin(), vertexCount, data.indices.Begin(), data.indices.Count());
+    }
   }
 
   return geometry;
@@ -63,11 +63,13 @@ public:
    * @brief Initializes the @p mTextureSet member with the needed textures for Physically Based Rendering.
    *
    * @param[in] albedoMetalTexture The albedo metal texture.
+   * @param[in] albedoMetalSampler The sampler of the albedo metal texture.
    * @param[in] normalRoughTexture The normal rough texture.
+   * @param[in] normalRoughSampler The sampler of the normal rough texture.
    * @param[in] diffuseTexture The diffuse texture.
    * @param[in] specularTexture The specular texture.
    */
-  void InitTexture(Texture albedoMetalTexture, Texture normalRoughTexture, Texture diffuseTexture, Texture specularTexture);
+  void InitTexture(Texture albedoMetalTexture, Sampler albedoMetalSampler, Texture normalRoughTexture, Sampler normalRoughSampler, Texture diffuseTexture, Texture specularTexture);
 
   /**
    * @brief Retrieves the actor created by calling the Init() method.
@@ -0,0 +1,288 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// HEADER
+#include "obj-loader-benchmark.h"
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/file-loader.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+
+// INTERNAL INCLUDES
+#include "obj-loader.h"
+
+namespace PbrDemo
+{
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+struct LoadResult
+{
+  double       milliseconds{0.0};
+  unsigned int points{0u};
+  unsigned int triangles{0u};
+};
+
+double Median(std::vector<double> values)
+{
+  std::sort(values.begin(), values.end());
+  return values.empty() ? 0.0 : values[values.size() / 2];
+}
+
+LoadResult LoadWithStreams(const std::string& url)
+{
+  LoadResult result;
+  auto       start = Clock::now();
+
+  std::streampos     fileSize;
+  Dali::Vector<char> fileContent;
+  ObjLoader          objLoader;
+  if(FileLoader::ReadFile(url, fileSize, fileContent, FileLoader::TEXT))
+  {
+    objLoader.LoadObjectWithStreams(fileContent.Begin(), fileSize);
+  }
+
+  result.milliseconds = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+  result.points       = objLoader.GetPointCount();
+  result.triangles    = objLoader.GetTriangleCount();
+  return result;
+}
+
+LoadResult LoadSinglePass(const std::string& url)
+{
+  LoadResult result;
+  auto       start = Clock::now();
+
+  ObjLoader objLoader;
+  objLoader.LoadObject(url);
+
+  result.milliseconds = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+  result.points       = objLoader.GetPointCount();
+  result.triangles    = objLoader.GetTriangleCount();
+  return result;
+}
+
+/**
+ * @brief An OBJ document and the number of points & triangles it holds.
+ */
+struct KnownObj
+{
+  const char*  description;
+  const char*  obj;
+  unsigned int points;
+  unsigned int triangles;
+};
+
+const KnownObj KNOWN_OBJS[] = {
+  {"untextured, no normals, no final newline", "v 0 0 0\nv 1 0 0\nv 0 1 0\nv 1 1 0\nf 1 2 3\nf 2 4 3", 4u, 2u},
+  {"textured quad, no normals", "# quad\nv 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\nvt 0 0\nvt 1 0\nvt 1 1\nvt 0 1\nf 1/1 2/2 3/3 4/4\n", 4u, 2u},
+  {"untextured with normals", "v 0 0 0\nv 1 0 0\nv 0 1 0\nvn 0 0 1\nf 1//1 2//1 3//1\n", 3u, 1u},
+};
+
+/**
+ * @brief Checks the single-pass parser finds the known counts and that every vertex gets a unit normal.
+ */
+bool CheckKnownObj(const KnownObj& known, bool useSoftNormals)
+{
+  ObjLoader objLoader;
+  objLoader.LoadObject(known.obj, strlen(known.obj));
+  if(objLoader.GetPointCount() != known.points || objLoader.GetTriangleCount() != known.triangles)
+  {
+    printf("  MISMATCH: %s: found %u points and %u triangles, expected %u and %u\n", known.description, objLoader.GetPointCount(), objLoader.GetTriangleCount(), known.points, known.triangles);
+    return false;
+  }
+
+  ObjLoader::InterleavedData data;
+  objLoader.CreateInterleavedData(ObjLoader::TEXTURE_COORDINATES | ObjLoader::TANGENTS, useSoftNormals, data);
+
+  const unsigned int stride = ObjLoader::GetVertexStride(data.attributes);
+  for(size_t i = 0u; i + stride <= data.vertices.Count(); i += stride)
+  {
+    // The normal follows the position.
+    const float length = std::sqrt(data.vertices[i + 3] * data.vertices[i + 3] + data.vertices[i + 4] * data.vertices[i + 4] + data.vertices[i + 5] * data.vertices[i + 5]);
+    if(!(std::abs(length - 1.0f) < 1e-3f))
+    {
+      printf("  MISMATCH: %s: vertex %zu has a normal of length %g with %s normals\n", known.description, i / stride, length, useSoftNormals ? "soft" : "hard");
+      return false;
+    }
+  }
+  return data.vertices.Count() > 0u;
+}
+
+/**
+ * @brief Writes a gridSize x gridSize vertex grid, rippled so its normals vary, as OBJ text without normals.
+ */
+std::string CreateSyntheticObj(unsigned int gridSize)
+{
+  std::string obj;
+  obj.reserve(static_cast<size_t>(gridSize) * gridSize * 96u);
+
+  char line[128];
+  for(unsigned int y = 0u; y < gridSize; ++y)
+  {
+    for(unsigned int x = 0u; x < gridSize; ++x)
+    {
+      const float u = static_cast<float>(x) / (gridSize - 1u);
+      const float v = static_cast<float>(y) / (gridSize - 1u);
+      snprintf(line, sizeof(line), "v %f %f %f\nvt %f %f\n", u, v, 0.05f * std::sin(u * 40.0f) * std::cos(v * 40.0f), u, v);
+      obj += line;
+    }
+  }
+
+  // One-based indices; each quad is split into two triangles by the loader.
+  for(unsigned int y = 0u; y + 1u < gridSize; ++y)
+  {
+    for(unsigned int x = 0u; x + 1u < gridSize; ++x)
+    {
+      const unsigned int a = y * gridSize + x + 1u;
+      const unsigned int b = a + 1u;
+      const unsigned int c = b + gridSize;
+      const unsigned int d = a + gridSize;
+      snprintf(line, sizeof(line), "f %u/%u %u/%u %u/%u %u/%u\n", a, a, b, b, c, c, d, d);
+      obj += line;
+    }
+  }
+  return obj;
+}
+
+} // namespace
+
+bool RunObjLoaderBenchmark(const std::vector<std::string>& urls, unsigned int iterations)
+{
+  bool allMatch = true;
+  iterations    = std::max(iterations, 1u);
+
+  // The stream parser skips the first line, so it cannot vouch for the counts on its own.
+  for(const KnownObj& known : KNOWN_OBJS)
+  {
+    allMatch &= CheckKnownObj(known, true);
+    allMatch &= CheckKnownObj(known, false);
+  }
+
+  printf("%-48s %10s %10s %12s %12s %8s\n", "file", "points", "triangles", "streams(ms)", "single(ms)", "speedup");
+  for(const auto& url : urls)
+  {
+    std::vector<double> streamTimes;
+    std::vector<double> singlePassTimes;
+    LoadResult          streamResult;
+    LoadResult          singlePassResult;
+
+    // Alternate the parsers so neither benefits more from a warm file cache.
+    for(unsigned int i = 0u; i < iterations; ++i)
+    {
+      streamResult     = LoadWithStreams(url);
+      singlePassResult = LoadSinglePass(url);
+      streamTimes.push_back(streamResult.milliseconds);
+      singlePassTimes.push_back(singlePassResult.milliseconds);
+    }
+
+    const double streamMs     = Median(streamTimes);
+    const double singlePassMs = Median(singlePassTimes);
+    printf("%-48s %10u %10u %12.2f %12.2f %7.1fx\n", url.c_str(), singlePassResult.points, singlePassResult.triangles, streamMs, singlePassMs, singlePassMs > 0.0 ? streamMs / singlePassMs : 0.0);
+
+    if(streamResult.points != singlePassResult.points || streamResult.triangles != singlePassResult.triangles)
+    {
+      printf("  MISMATCH: stream parser found %u points and %u triangles\n", streamResult.points, streamResult.triangles);
+      allMatch = false;
+    }
+  }
+
+  return allMatch;
+}
+
+bool RunNormalGenerationBenchmark(unsigned int gridSize, unsigned int iterations)
+{
+  gridSize   = std::max(gridSize, 2u);
+  iterations = std::max(iterations, 1u);
+
+  const std::string obj = CreateSyntheticObj(gridSize);
+
+  const unsigned int        coreCount = std::max(std::thread::hardware_concurrency(), 1u);
+  std::vector<unsigned int> threadCounts;
+  for(unsigned int threadCount = 1u; threadCount < coreCount; threadCount *= 2u)
+  {
+    threadCounts.push_back(threadCount);
+  }
+  threadCounts.push_back(coreCount);
+
+  const int objectProperties = ObjLoader::TEXTURE_COORDINATES | ObjLoader::TANGENTS;
+
+  bool               allMatch       = true;
+  double             singleThreadMs = 0.0;
+  std::vector<float> referenceVertices;
+
+  printf("synthetic grid: %u x %u vertices, %u triangles, %u cores\n", gridSize, gridSize, 2u * (gridSize - 1u) * (gridSize - 1u), coreCount);
+  printf("%8s %12s %8s %12s\n", "threads", "median(ms)", "speedup", "max diff");
+  for(unsigned int threadCount : threadCounts)
+  {
+    std::vector<double>        times;
+    ObjLoader::InterleavedData data;
+    for(unsigned int i = 0u; i < iterations; ++i)
+    {
+      ObjLoader objLoader;
+      objLoader.SetThreadCount(threadCount);
+      objLoader.LoadObject(obj.data(), obj.size());
+
+      auto start = Clock::now();
+      objLoader.CalculateNormalsAndTangents(true);
+      times.push_back(std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+
+      if(i == 0u)
+      {
+        objLoader.CreateInterleavedData(objectProperties, true, data);
+      }
+    }
+
+    // Summing in a different order per thread count only changes the rounding.
+    float maxDifference = 0.0f;
+    if(referenceVertices.empty())
+    {
+      referenceVertices.assign(data.vertices.Begin(), data.vertices.End());
+    }
+    else if(referenceVertices.size() != data.vertices.Count())
+    {
+      maxDifference = INFINITY;
+    }
+    else
+    {
+      for(size_t i = 0u; i < referenceVertices.size(); ++i)
+      {
+        maxDifference = std::max(maxDifference, std::abs(referenceVertices[i] - data.vertices[i]));
+      }
+    }
+
+    const double milliseconds = Median(times);
+    singleThreadMs            = (threadCount == 1u) ? milliseconds : singleThreadMs;
+    printf("%8u %12.2f %7.1fx %12g\n", threadCount, milliseconds, milliseconds > 0.0 ? singleThreadMs / milliseconds : 0.0, maxDifference);
+
+    if(!(maxDifference < 1e-4f))
+    {
+      printf("  MISMATCH: vertex data differs from the single threaded result\n");
+      allMatch = false;
+    }
+  }
+
+  return allMatch;
+}
+
+} // namespace PbrDemo
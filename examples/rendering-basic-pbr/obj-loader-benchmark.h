@@ -0,0 +1,57 @@
+#ifndef DALI_DEMO_PBR_OBJ_LOADER_BENCHMARK_H
+#define DALI_DEMO_PBR_OBJ_LOADER_BENCHMARK_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <string>
+#include <vector>
+
+namespace PbrDemo
+{
+/**
+ * @brief Times loading OBJ files with the stream based and the single-pass ObjLoader parsers.
+ *
+ * Each file is loaded @p iterations times with each parser, including reading the file, and the
+ * median time of each is printed to stdout with the speed-up. The point and triangle counts of both
+ * parsers are compared so a mismatch is reported rather than hidden behind a faster time. The single-pass
+ * parser is first checked against small documents whose counts are known, including one whose last line
+ * has no newline and an untextured one without normals, which must have normals generated.
+ *
+ * @param[in] urls The paths of the OBJ files to load.
+ * @param[in] iterations The number of times each file is loaded by each parser.
+ * @return Whether the known counts were found and both parsers agreed on every file.
+ */
+bool RunObjLoaderBenchmark(const std::vector<std::string>& urls, unsigned int iterations);
+
+/**
+ * @brief Times generating the normals and tangents of a large synthetic mesh with increasing numbers of threads.
+ *
+ * The mesh is a textured, rippled grid without normals, so ObjLoader has to generate both. The median time for
+ * each thread count (1, 2, 4... up to the number of cores) is printed to stdout with the speed-up over one thread,
+ * along with the largest difference from the single threaded vertex data, which should only be rounding.
+ *
+ * @param[in] gridSize The number of vertices along each side of the grid, which has 2 * (gridSize - 1)^2 triangles.
+ * @param[in] iterations The number of times the generation is timed for each thread count.
+ * @return Whether every thread count produced the same vertex data, within rounding.
+ */
+bool RunNormalGenerationBenchmark(unsigned int gridSize, unsigned int iterations);
+
+} // namespace PbrDemo
+
+#endif // DALI_DEMO_PBR_OBJ_LOADER_BENCHMARK_H
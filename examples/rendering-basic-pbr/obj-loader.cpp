@@ -21,22 +21,646 @@
 // EXTERNAL INCLUDES
 #include <dali/integration-api/debug.h>
 #include <string.h>
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
 #include <sstream>
+#include <thread>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define DALI_DEMO_PBR_USE_SSE 1
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define DALI_DEMO_PBR_USE_NEON 1
+#endif
+
+// INTERNAL INCLUDES
+#include "shared/memory-mapped-file.h"
+#include "shared/thread-pool.h"
 
 namespace PbrDemo
 {
 namespace
 {
 const int MAX_POINT_INDICES = 4;
+
+const int    MAX_MANTISSA_DIGITS = 19; ///< The number of decimal digits which always fit in a uint64_t.
+const double POWERS_OF_TEN[]     = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+const int    NUM_POWERS_OF_TEN   = sizeof(POWERS_OF_TEN) / sizeof(POWERS_OF_TEN[0]);
+
+inline bool IsSpace(char c)
+{
+  return c == ' ' || c == '\t' || c == '\r';
+}
+
+inline bool IsDigit(char c)
+{
+  return c >= '0' && c <= '9';
+}
+
+inline void SkipSpaces(const char*& p, const char* end)
+{
+  while(p < end && IsSpace(*p))
+  {
+    ++p;
+  }
+}
+
+inline const char* FindLineEnd(const char* p, const char* end)
+{
+  const char* lineEnd = static_cast<const char*>(memchr(p, '\n', end - p));
+  return lineEnd ? lineEnd : end;
+}
+
+/**
+ * @brief Reads the whitespace separated token at p, which is left pointing after it.
+ * @return The length of the token.
+ */
+inline size_t ReadToken(const char*& p, const char* end, const char*& token)
+{
+  SkipSpaces(p, end);
+  token = p;
+  while(p < end && !IsSpace(*p))
+  {
+    ++p;
+  }
+  return p - token;
+}
+
+inline bool TokenIs(const char* token, size_t length, const char* tag)
+{
+  return length == strlen(tag) && memcmp(token, tag, length) == 0;
+}
+
+inline double PowerOfTen(int exponent)
+{
+  return exponent < NUM_POWERS_OF_TEN ? POWERS_OF_TEN[exponent] : std::pow(10.0, exponent);
+}
+
+/**
+ * @brief Parses a decimal floating point number, always in the "C" locale.
+ *
+ * Accumulates up to MAX_MANTISSA_DIGITS significant digits in an integer and scales it once by a power of ten,
+ * which is exact for the powers in POWERS_OF_TEN, so the result matches strtof() for the precision found in OBJ files.
+ *
+ * @param[in,out] p The position to parse from, left after the number.
+ * @param[in] end The end of the buffer.
+ * @param[out] value The parsed value.
+ * @return Whether a number was found.
+ */
+bool ParseFloat(const char*& p, const char* end, float& value)
+{
+  SkipSpaces(p, end);
+
+  bool negative = false;
+  if(p < end && (*p == '-' || *p == '+'))
+  {
+    negative = (*p == '-');
+    ++p;
+  }
+
+  uint64_t mantissa          = 0u;
+  int      exponent          = 0;
+  int      significantDigits = 0;
+  bool     hasDigits         = false;
+
+  for(; p < end && IsDigit(*p); ++p, hasDigits = true)
+  {
+    if(significantDigits < MAX_MANTISSA_DIGITS)
+    {
+      mantissa = mantissa * 10u + (*p - '0');
+      significantDigits += (mantissa != 0u);
+    }
+    else
+    {
+      ++exponent; // Digits beyond the precision only affect the magnitude.
+    }
+  }
+
+  if(p < end && *p == '.')
+  {
+    for(++p; p < end && IsDigit(*p); ++p, hasDigits = true)
+    {
+      if(significantDigits < MAX_MANTISSA_DIGITS)
+      {
+        mantissa = mantissa * 10u + (*p - '0');
+        significantDigits += (mantissa != 0u);
+        --exponent;
+      }
+    }
+  }
+
+  if(!hasDigits)
+  {
+    return false;
+  }
+
+  if(p < end && (*p == 'e' || *p == 'E'))
+  {
+    const char* exponentStart    = p++;
+    bool        negativeExponent = false;
+    if(p < end && (*p == '-' || *p == '+'))
+    {
+      negativeExponent = (*p == '-');
+      ++p;
+    }
+
+    if(p < end && IsDigit(*p))
+    {
+      int explicitExponent = 0;
+      for(; p < end && IsDigit(*p); ++p)
+      {
+        explicitExponent = std::min(explicitExponent * 10 + (*p - '0'), 1000);
+      }
+      exponent += negativeExponent ? -explicitExponent : explicitExponent;
+    }
+    else
+    {
+      p = exponentStart; // Not an exponent after all.
+    }
+  }
+
+  double result = static_cast<double>(mantissa);
+  result        = exponent < 0 ? result / PowerOfTen(-exponent) : result * PowerOfTen(exponent);
+  value         = static_cast<float>(negative ? -result : result);
+  return true;
+}
+
+/**
+ * @brief Parses a (possibly negative) decimal integer at p without skipping leading spaces.
+ * @return Whether an integer was found.
+ */
+bool ParseInt(const char*& p, const char* end, int& value)
+{
+  bool negative = false;
+  if(p < end && *p == '-')
+  {
+    negative = true;
+    ++p;
+  }
+
+  if(p >= end || !IsDigit(*p))
+  {
+    return false;
+  }
+
+  int result = 0;
+  for(; p < end && IsDigit(*p); ++p)
+  {
+    result = result * 10 + (*p - '0');
+  }
+  value = negative ? -result : result;
+  return true;
+}
+
+/**
+ * @brief Converts a one-based OBJ index, which is relative to the end of the list if negative, to a zero-based one.
+ */
+inline int ToZeroBasedIndex(int objIndex, unsigned int count)
+{
+  return objIndex < 0 ? static_cast<int>(count) + objIndex : objIndex - 1;
+}
+
+/**
+ * @brief Parses one vertex of a face, of the form A, A/B, A//C or A/B/C.
+ * @return Whether a vertex was found; missing texture & normal indices are returned as 0.
+ */
+bool ParseFaceVertex(const char*& p, const char* end, int& pointIndex, int& textureIndex, int& normalIndex, bool& hasTexture)
+{
+  SkipSpaces(p, end);
+
+  textureIndex = 0;
+  normalIndex  = 0;
+  if(!ParseInt(p, end, pointIndex))
+  {
+    return false;
+  }
+
+  if(p < end && *p == '/')
+  {
+    ++p;
+    if(ParseInt(p, end, textureIndex))
+    {
+      hasTexture = true;
+    }
+
+    if(p < end && *p == '/')
+    {
+      ++p;
+      ParseInt(p, end, normalIndex);
+    }
+  }
+
+  // Skip anything unexpected, so the next vertex starts at a separator.
+  while(p < end && !IsSpace(*p))
+  {
+    ++p;
+  }
+  return true;
+}
+
+/**
+ * @brief Counts the elements in the OBJ buffer so the arrays can be reserved before parsing.
+ */
+void CountElements(const char* p, const char* end, unsigned int& points, unsigned int& normals, unsigned int& textureUvs, unsigned int& triangles)
+{
+  points = normals = textureUvs = triangles = 0u;
+  while(p < end)
+  {
+    const char* lineEnd = FindLineEnd(p, end);
+    SkipSpaces(p, lineEnd);
+
+    if(lineEnd - p > 1 && IsSpace(p[1]))
+    {
+      if(p[0] == 'v')
+      {
+        ++points;
+      }
+      else if(p[0] == 'f')
+      {
+        // A face of n vertices (up to MAX_POINT_INDICES) makes n - 2 triangles.
+        int vertices = 0;
+        for(++p; p < lineEnd && vertices < MAX_POINT_INDICES; ++vertices)
+        {
+          const char* vertex;
+          if(ReadToken(p, lineEnd, vertex) == 0)
+          {
+            break;
+          }
+        }
+        triangles += vertices > 2 ? vertices - 2 : 0;
+      }
+    }
+    else if(lineEnd - p > 2 && p[0] == 'v' && IsSpace(p[2]))
+    {
+      normals += (p[1] == 'n');
+      textureUvs += (p[1] == 't');
+    }
+
+    p = (lineEnd < end) ? lineEnd + 1 : end;
+  }
 }
 
+/**
+ * @brief Objects with fewer triangles per thread than this are not worth splitting across threads.
+ */
+const size_t MIN_TRIANGLES_PER_THREAD = 8192u;
+
+/**
+ * @brief The threads used to generate the normals & tangents of large objects, shared by all loaders.
+ */
+DemoHelper::ThreadPool& GetThreadPool()
+{
+  static DemoHelper::ThreadPool threadPool;
+  return threadPool;
+}
+
+/**
+ * @brief Four floats processed together, using SSE2 or NEON where available.
+ */
+struct Float4
+{
+#if defined(DALI_DEMO_PBR_USE_SSE)
+  __m128 value;
+
+  static Float4 Set(float a, float b, float c, float d)
+  {
+    return {_mm_setr_ps(a, b, c, d)};
+  }
+
+  static Float4 Splat(float a)
+  {
+    return {_mm_set1_ps(a)};
+  }
+
+  void Store(float* out) const
+  {
+    _mm_storeu_ps(out, value);
+  }
+#elif defined(DALI_DEMO_PBR_USE_NEON)
+  float32x4_t value;
+
+  static Float4 Set(float a, float b, float c, float d)
+  {
+    const float values[4] = {a, b, c, d};
+    return {vld1q_f32(values)};
+  }
+
+  static Float4 Splat(float a)
+  {
+    return {vdupq_n_f32(a)};
+  }
+
+  void Store(float* out) const
+  {
+    vst1q_f32(out, value);
+  }
+#else
+  float value[4];
+
+  static Float4 Set(float a, float b, float c, float d)
+  {
+    return {{a, b, c, d}};
+  }
+
+  static Float4 Splat(float a)
+  {
+    return {{a, a, a, a}};
+  }
+
+  void Store(float* out) const
+  {
+    memcpy(out, value, sizeof(value));
+  }
+#endif
+};
+
+#if defined(DALI_DEMO_PBR_USE_SSE)
+// clang-format off
+inline Float4 operator+(Float4 a, Float4 b) { return {_mm_add_ps(a.value, b.value)}; }
+inline Float4 operator-(Float4 a, Float4 b) { return {_mm_sub_ps(a.value, b.value)}; }
+inline Float4 operator*(Float4 a, Float4 b) { return {_mm_mul_ps(a.value, b.value)}; }
+inline Float4 operator/(Float4 a, Float4 b) { return {_mm_div_ps(a.value, b.value)}; }
+inline Float4 Max(Float4 a, Float4 b)       { return {_mm_max_ps(a.value, b.value)}; }
+inline Float4 Sqrt(Float4 a)                { return {_mm_sqrt_ps(a.value)}; }
+// clang-format on
+#elif defined(DALI_DEMO_PBR_USE_NEON)
+// clang-format off
+inline Float4 operator+(Float4 a, Float4 b) { return {vaddq_f32(a.value, b.value)}; }
+inline Float4 operator-(Float4 a, Float4 b) { return {vsubq_f32(a.value, b.value)}; }
+inline Float4 operator*(Float4 a, Float4 b) { return {vmulq_f32(a.value, b.value)}; }
+inline Float4 operator/(Float4 a, Float4 b) { return {vdivq_f32(a.value, b.value)}; }
+inline Float4 Max(Float4 a, Float4 b)       { return {vmaxq_f32(a.value, b.value)}; }
+inline Float4 Sqrt(Float4 a)                { return {vsqrtq_f32(a.value)}; }
+// clang-format on
+#else
+template<typename Operation>
+inline Float4 ForEachLane(Float4 a, Float4 b, Operation operation)
+{
+  return {{operation(a.value[0], b.value[0]), operation(a.value[1], b.value[1]), operation(a.value[2], b.value[2]), operation(a.value[3], b.value[3])}};
+}
+
+// clang-format off
+inline Float4 operator+(Float4 a, Float4 b) { return ForEachLane(a, b, [](float x, float y) { return x + y; }); }
+inline Float4 operator-(Float4 a, Float4 b) { return ForEachLane(a, b, [](float x, float y) { return x - y; }); }
+inline Float4 operator*(Float4 a, Float4 b) { return ForEachLane(a, b, [](float x, float y) { return x * y; }); }
+inline Float4 operator/(Float4 a, Float4 b) { return ForEachLane(a, b, [](float x, float y) { return x / y; }); }
+inline Float4 Max(Float4 a, Float4 b)       { return ForEachLane(a, b, [](float x, float y) { return std::max(x, y); }); }
+inline Float4 Sqrt(Float4 a)                { return ForEachLane(a, a, [](float x, float) { return std::sqrt(x); }); }
+// clang-format on
+#endif
+
+/**
+ * @brief Four Vector3s stored as structure of arrays, so each operation handles all four at once.
+ */
+struct Vector3x4
+{
+  Float4 x;
+  Float4 y;
+  Float4 z;
+
+  static Vector3x4 Set(const Vector3& a, const Vector3& b, const Vector3& c, const Vector3& d)
+  {
+    return {Float4::Set(a.x, b.x, c.x, d.x), Float4::Set(a.y, b.y, c.y, d.y), Float4::Set(a.z, b.z, c.z, d.z)};
+  }
+
+  /**
+   * @brief Writes the first count vectors to out[ 0 .. count - 1 ].
+   */
+  void Store(Vector3* out, unsigned int count) const
+  {
+    float xs[4], ys[4], zs[4];
+    x.Store(xs);
+    y.Store(ys);
+    z.Store(zs);
+    for(unsigned int i = 0u; i < count; ++i)
+    {
+      out[i] = Vector3(xs[i], ys[i], zs[i]);
+    }
+  }
+};
+
+inline Vector3x4 operator-(const Vector3x4& a, const Vector3x4& b)
+{
+  return {a.x - b.x, a.y - b.y, a.z - b.z};
+}
+
+inline Vector3x4 operator*(const Vector3x4& a, Float4 scale)
+{
+  return {a.x * scale, a.y * scale, a.z * scale};
+}
+
+inline Float4 Dot(const Vector3x4& a, const Vector3x4& b)
+{
+  return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+inline Vector3x4 Cross(const Vector3x4& a, const Vector3x4& b)
+{
+  return {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x};
+}
+
+/**
+ * @brief Normalizes the vectors, leaving zero vectors as they are like Vector3::Normalize().
+ */
+inline Vector3x4 Normalize(const Vector3x4& v)
+{
+  return v * (Float4::Splat(1.0f) / Sqrt(Max(Dot(v, v), Float4::Splat(FLT_MIN))));
+}
+
+/**
+ * @brief Gathers the given corner of four triangles from the points.
+ */
+inline Vector3x4 GatherCorner(const Vector3* points, const ObjLoader::TriIndex* const triangles[4], int corner)
+{
+  return Vector3x4::Set(points[triangles[0]->pointIndex[corner]],
+                        points[triangles[1]->pointIndex[corner]],
+                        points[triangles[2]->pointIndex[corner]],
+                        points[triangles[3]->pointIndex[corner]]);
+}
+
+/**
+ * @brief Calls function(triangles, count) for each group of four triangles in [ begin, end ).
+ *
+ * The last group is padded by repeating its last triangle, so the function can always process four; only the
+ * first count triangles of a group should be written back.
+ */
+template<typename Function>
+inline void ForEachTriangleGroup(ObjLoader::TriIndex* triangles, size_t begin, size_t end, Function function)
+{
+  ObjLoader::TriIndex* group[4];
+  for(size_t i = begin; i < end; i += 4u)
+  {
+    const unsigned int count = static_cast<unsigned int>(std::min<size_t>(4u, end - i));
+    for(unsigned int j = 0u; j < 4u; ++j)
+    {
+      group[j] = triangles + i + std::min(j, count - 1u);
+    }
+    function(group, count);
+  }
+}
+
+/**
+ * @brief Adds the (area weighted) normal of each triangle in [ begin, end ) to the normals of its points.
+ *
+ * Also sets the triangles' normal indices to their point indices, as there is one normal per point.
+ */
+void AccumulateFaceNormals(const Vector3* points, ObjLoader::TriIndex* triangles, size_t begin, size_t end, Vector3* normals)
+{
+  ForEachTriangleGroup(triangles, begin, end, [points, normals](ObjLoader::TriIndex* const group[4], unsigned int count) {
+    const Vector3x4 v0 = GatherCorner(points, group, 0);
+    const Vector3x4 v1 = GatherCorner(points, group, 1);
+    const Vector3x4 v2 = GatherCorner(points, group, 2);
+
+    Vector3 faceNormals[4];
+    Cross(v1 - v0, v2 - v0).Store(faceNormals, count);
+
+    for(unsigned int i = 0u; i < count; ++i)
+    {
+      for(int j = 0; j < 3; ++j)
+      {
+        const int pointIndex     = group[i]->pointIndex[j];
+        group[i]->normalIndex[j] = pointIndex;
+        normals[pointIndex] += faceNormals[i];
+      }
+    }
+  });
+}
+
+/**
+ * @brief Adds the tangent of each triangle in [ begin, end ) to the tangents of its normals.
+ */
+void AccumulateFaceTangents(const Vector3* points, const Vector2* textureUvs, ObjLoader::TriIndex* triangles, size_t begin, size_t end, Vector3* tangents)
+{
+  ForEachTriangleGroup(triangles, begin, end, [points, textureUvs, tangents](ObjLoader::TriIndex* const group[4], unsigned int count) {
+    const Vector3x4 v0    = GatherCorner(points, group, 0);
+    const Vector3x4 edge1 = GatherCorner(points, group, 1) - v0;
+    const Vector3x4 edge2 = GatherCorner(points, group, 2) - v0;
+
+    const Vector2* w[4][3];
+    for(int i = 0; i < 4; ++i)
+    {
+      for(int j = 0; j < 3; ++j)
+      {
+        w[i][j] = &textureUvs[group[i]->textureIndex[j]];
+      }
+    }
+
+    const Float4 deltaU1 = Float4::Set(w[0][1]->x - w[0][0]->x, w[1][1]->x - w[1][0]->x, w[2][1]->x - w[2][0]->x, w[3][1]->x - w[3][0]->x);
+    const Float4 deltaV1 = Float4::Set(w[0][1]->y - w[0][0]->y, w[1][1]->y - w[1][0]->y, w[2][1]->y - w[2][0]->y, w[3][1]->y - w[3][0]->y);
+    const Float4 deltaU2 = Float4::Set(w[0][2]->x - w[0][0]->x, w[1][2]->x - w[1][0]->x, w[2][2]->x - w[2][0]->x, w[3][2]->x - w[3][0]->x);
+    const Float4 deltaV2 = Float4::Set(w[0][2]->y - w[0][0]->y, w[1][2]->y - w[1][0]->y, w[2][2]->y - w[2][0]->y, w[3][2]->y - w[3][0]->y);
+
+    // 1.0/f could cause division by zero in some cases, this factor will act
+    // as a weight of the tangent vector and it is fixed when it is normalised.
+    const Float4 f = deltaU1 * deltaV2 - deltaU2 * deltaV1;
+
+    Vector3 faceTangents[4];
+    ((edge1 * deltaV2 - edge2 * deltaV1) * f).Store(faceTangents, count);
+
+    for(unsigned int i = 0u; i < count; ++i)
+    {
+      for(int j = 0; j < 3; ++j)
+      {
+        tangents[group[i]->normalIndex[j]] += faceTangents[i];
+      }
+    }
+  });
+}
+
+/**
+ * @brief Normalizes the vectors in [ begin, end ).
+ */
+void NormalizeRange(Vector3* vectors, size_t begin, size_t end)
+{
+  for(size_t i = begin; i < end; i += 4u)
+  {
+    const unsigned int count = static_cast<unsigned int>(std::min<size_t>(4u, end - i));
+    const Vector3*     v     = vectors + i;
+    const Vector3x4    group = Vector3x4::Set(v[0], v[std::min(1u, count - 1u)], v[std::min(2u, count - 1u)], v[count - 1u]);
+    Normalize(group).Store(vectors + i, count);
+  }
+}
+
+/**
+ * @brief Makes the tangents in [ begin, end ) orthogonal to their normals (Gram-Schmidt) and normalizes them.
+ */
+void OrthonormalizeRange(const Vector3* normals, Vector3* tangents, size_t begin, size_t end)
+{
+  for(size_t i = begin; i < end; i += 4u)
+  {
+    const unsigned int count = static_cast<unsigned int>(std::min<size_t>(4u, end - i));
+    const unsigned int last  = count - 1u;
+    const Vector3*     n     = normals + i;
+    const Vector3*     t     = tangents + i;
+    const Vector3x4    n4    = Vector3x4::Set(n[0], n[std::min(1u, last)], n[std::min(2u, last)], n[last]);
+    const Vector3x4    t4    = Vector3x4::Set(t[0], t[std::min(1u, last)], t[std::min(2u, last)], t[last]);
+    Normalize(t4 - n4 * Dot(n4, t4)).Store(tangents + i, count);
+  }
+}
+
+/**
+ * @brief Sums per-thread accumulations of triangle data into per-vertex vectors and finishes them.
+ *
+ * Each thread scatters its share of the triangles into its own accumulator, so no two threads write to the same
+ * memory; the first thread uses the output itself. The accumulators are then added together, again split across
+ * the threads but by vertex this time, and each vertex's result finished by the given function.
+ *
+ * @param[in] triangleCount The number of triangles.
+ * @param[in] threadCount The number of threads to use.
+ * @param[in,out] output The per-vertex vectors, which must already be sized and zeroed.
+ * @param[in] accumulate Called as accumulate(begin, end, accumulator) to add the triangles in [ begin, end ).
+ * @param[in] finish Called as finish(begin, end) once the vertices in [ begin, end ) hold the totals.
+ */
+template<typename Accumulate, typename Finish>
+void AccumulateInParallel(size_t triangleCount, unsigned int threadCount, Dali::Vector<Vector3>& output, Accumulate accumulate, Finish finish)
+{
+  if(threadCount <= 1u)
+  {
+    accumulate(0u, triangleCount, output.Begin());
+    finish(0u, output.Size());
+    return;
+  }
+
+  DemoHelper::ThreadPool&            threadPool = GetThreadPool();
+  std::vector<Dali::Vector<Vector3>> accumulators(threadCount);
+
+  threadPool.ParallelFor(triangleCount, threadCount, [&](size_t begin, size_t end, unsigned int thread) {
+    Vector3* accumulator = output.Begin();
+    if(thread > 0u)
+    {
+      accumulators[thread].Resize(output.Size()); // Zeroed by the thread using it, so its pages are local to it.
+      accumulator = accumulators[thread].Begin();
+    }
+    accumulate(begin, end, accumulator);
+  });
+
+  threadPool.ParallelFor(output.Size(), threadCount, [&](size_t begin, size_t end, unsigned int) {
+    for(unsigned int thread = 1u; thread < threadCount; ++thread)
+    {
+      const Vector3* accumulator = accumulators[thread].Begin();
+      for(size_t i = begin; i < end; ++i)
+      {
+        output[i] += accumulator[i];
+      }
+    }
+    finish(begin, end);
+  });
+}
+
+} // namespace
+
 ObjLoader::ObjLoader()
 : mSceneLoaded(false),
   mMaterialLoaded(false),
   mHasTextureUv(false),
   mHasDiffuseMap(false),
   mHasNormalMap(false),
-  mHasSpecularMap(false)
+  mHasSpecularMap(false),
+  mThreadCount(0u)
 {
   mSceneAABB.Init();
 }
@@ -91,41 +715,21 @@ void ObjLoader::CalculateHardFaceNormals(const Dali::Vector<Vector3>& points, Da
 
 void ObjLoader::CalculateSoftFaceNormals(const Dali::Vector<Vector3>& points, Dali::Vector<TriIndex>& triangles, Dali::Vector<Vector3>& normals)
 {
-  int normalIndex = 0; //Tracks progress through the array of normals.
-
   normals.Clear();
   normals.Resize(points.Size()); //One (averaged) normal per point.
 
   //For each triangle, calculate the normal by crossing two vectors on the triangle's plane
-  //We then add the triangle's normal to the cumulative normals at each point of it
-  for(unsigned long i = 0; i < triangles.Size(); i++)
-  {
-    //Triangle points.
-    const Vector3& v0 = points[triangles[i].pointIndex[0]];
-    const Vector3& v1 = points[triangles[i].pointIndex[1]];
-    const Vector3& v2 = points[triangles[i].pointIndex[2]];
-
-    //Triangle edges.
-    Vector3 edge1 = v1 - v0;
-    Vector3 edge2 = v2 - v0;
-
-    //Using edges as vectors on the plane, cross to get the normal.
-    Vector3 normalVector = edge1.Cross(edge2);
-
-    //Add this triangle's normal to the cumulative normal of each constituent triangle point and set the index of the normal accordingly.
-    for(unsigned long j = 0; j < 3; j++)
-    {
-      normalIndex                 = triangles[i].pointIndex[j];
-      triangles[i].normalIndex[j] = normalIndex; //Normal index matches up to vertex index, as one normal per vertex.
-      normals[normalIndex] += normalVector;
-    }
-  }
-
-  //Normalise the normals.
-  for(unsigned long i = 0; i < normals.Size(); i++)
-  {
-    normals[i].Normalize();
-  }
+  //We then add the triangle's normal to the cumulative normals at each point of it, and normalise the totals.
+  AccumulateInParallel(
+    triangles.Size(),
+    GetThreadCount(triangles.Size()),
+    normals,
+    [&points, &triangles](size_t begin, size_t end, Vector3* accumulator) {
+      AccumulateFaceNormals(points.Begin(), triangles.Begin(), begin, end, accumulator);
+    },
+    [&normals](size_t begin, size_t end) {
+      NormalizeRange(normals.Begin(), begin, end);
+    });
 }
 
 void ObjLoader::CalculateTangentFrame()
@@ -135,49 +739,23 @@ void ObjLoader::CalculateTangentFrame()
   mTangents.Resize(mNormals.Size());
 
   //For each triangle, calculate the tangent vector and then add it to the total tangent vector of each normal.
-  for(unsigned long a = 0; a < mTriangles.Size(); a++)
-  {
-    Vector3 tangentVector;
-
-    const Vector3& v0 = mPoints[mTriangles[a].pointIndex[0]];
-    const Vector3& v1 = mPoints[mTriangles[a].pointIndex[1]];
-    const Vector3& v2 = mPoints[mTriangles[a].pointIndex[2]];
-
-    Vector3 edge1 = v1 - v0;
-    Vector3 edge2 = v2 - v0;
-
-    const Vector2& w0 = mTextureUv[mTriangles[a].textureIndex[0]];
-    const Vector2& w1 = mTextureUv[mTriangles[a].textureIndex[1]];
-    const Vector2& w2 = mTextureUv[mTriangles[a].textureIndex[2]];
-
-    float deltaU1 = w1.x - w0.x;
-    float deltaV1 = w1.y - w0.y;
-    float deltaU2 = w2.x - w0.x;
-    float deltaV2 = w2.y - w0.y;
-
-    // 1.0/f could cause division by zero in some cases, this factor will act
-    // as a weight of the tangent vector and it is fixed when it is normalised.
-    float f = (deltaU1 * deltaV2 - deltaU2 * deltaV1);
-
-    tangentVector.x = f * (deltaV2 * edge1.x - deltaV1 * edge2.x);
-    tangentVector.y = f * (deltaV2 * edge1.y - deltaV1 * edge2.y);
-    tangentVector.z = f * (deltaV2 * edge1.z - deltaV1 * edge2.z);
-
-    mTangents[mTriangles[a].normalIndex[0]] += tangentVector;
-    mTangents[mTriangles[a].normalIndex[1]] += tangentVector;
-    mTangents[mTriangles[a].normalIndex[2]] += tangentVector;
-  }
-
-  //Orthogonalize tangents.
-  for(unsigned long a = 0; a < mTangents.Size(); a++)
-  {
-    const Vector3& n = mNormals[a];
-    const Vector3& t = mTangents[a];
+  //The totals are then made orthogonal to the normals and normalised.
+  AccumulateInParallel(
+    mTriangles.Size(),
+    GetThreadCount(mTriangles.Size()),
+    mTangents,
+    [this](size_t begin, size_t end, Vector3* accumulator) {
+      AccumulateFaceTangents(mPoints.Begin(), mTextureUv.Begin(), mTriangles.Begin(), begin, end, accumulator);
+    },
+    [this](size_t begin, size_t end) {
+      OrthonormalizeRange(mNormals.Begin(), mTangents.Begin(), begin, end);
+    });
+}
 
-    // Gram-Schmidt orthogonalize
-    mTangents[a] = t - n * n.Dot(t);
-    mTangents[a].Normalize();
-  }
+unsigned int ObjLoader::GetThreadCount(size_t triangleCount) const
+{
+  const unsigned int threadCount = mThreadCount ? mThreadCount : std::max(std::thread::hardware_concurrency(), 1u);
+  return static_cast<unsigned int>(std::max<size_t>(1u, std::min<size_t>(threadCount, triangleCount / MIN_TRIANGLES_PER_THREAD)));
 }
 
 void ObjLoader::CenterAndScale(bool center, Dali::Vector<Vector3>& points)
@@ -207,12 +785,12 @@ void ObjLoader::CenterAndScale(bool center, Dali::Vector<Vector3>& points)
   mSceneAABB = newAABB;
 }
 
-void ObjLoader::CreateGeometryArray(Dali::Vector<Vector3>&        positions,
-                                    Dali::Vector<Vector3>&        normals,
-                                    Dali::Vector<Vector3>&        tangents,
-                                    Dali::Vector<Vector2>&        textures,
-                                    Dali::Vector<unsigned short>& indices,
-                                    bool                          useSoftNormals)
+void ObjLoader::SetThreadCount(unsigned int threadCount)
+{
+  mThreadCount = threadCount;
+}
+
+void ObjLoader::CalculateNormalsAndTangents(bool useSoftNormals)
 {
   //We must calculate the tangents if they weren't supplied, or if they don't match up.
   bool mustCalculateTangents = (mTangents.Size() == 0) || (mTangents.Size() != mNormals.Size());
@@ -220,11 +798,11 @@ void ObjLoader::CreateGeometryArray(Dali::Vector<Vector3>&        positions,
   //However, we don't need to do this if the object doesn't use textures to begin with.
   mustCalculateTangents &= mHasTextureUv;
 
-  // We calculate the normals if hard normals(flat normals) is set.
+  // We calculate the normals if the file has none or hard normals(flat normals) is set.
   // Use the normals provided by the file to make the tangent calculation per normal,
   // the correct results depends of normal generated by file, otherwise we need to recalculate
   // the normal programmatically.
-  if(((mNormals.Size() == 0) && mustCalculateTangents) || !useSoftNormals)
+  if((mNormals.Size() == 0) || !useSoftNormals)
   {
     if(useSoftNormals)
     {
@@ -240,6 +818,16 @@ void ObjLoader::CreateGeometryArray(Dali::Vector<Vector3>&        positions,
   {
     CalculateTangentFrame();
   }
+}
+
+void ObjLoader::CreateGeometryArray(Dali::Vector<Vector3>&        positions,
+                                    Dali::Vector<Vector3>&        normals,
+                                    Dali::Vector<Vector3>&        tangents,
+                                    Dali::Vector<Vector2>&        textures,
+                                    Dali::Vector<unsigned short>& indices,
+                                    bool                          useSoftNormals)
+{
+  CalculateNormalsAndTangents(useSoftNormals);
 
   bool mapsCorrespond; //True if the sizes of the arrays necessary to draw the object match.
 
@@ -317,6 +905,139 @@ void ObjLoader::CreateGeometryArray(Dali::Vector<Vector3>&        positions,
 }
 
 bool ObjLoader::LoadObject(char* objBuffer, std::streampos fileSize)
+{
+  return LoadObject(static_cast<const char*>(objBuffer), static_cast<size_t>(fileSize));
+}
+
+bool ObjLoader::LoadObject(const std::string& url)
+{
+  DemoHelper::MemoryMappedFile file(url);
+  return file && LoadObject(file.GetData(), file.GetSize());
+}
+
+bool ObjLoader::LoadObject(const char* objBuffer, size_t size)
+{
+  const char* p   = objBuffer;
+  const char* end = objBuffer + size;
+
+  //Reserve the arrays up-front so they are not reallocated while parsing.
+  unsigned int numPoints, numNormals, numTextureUvs, numTriangles;
+  CountElements(p, end, numPoints, numNormals, numTextureUvs, numTriangles);
+  mPoints.Reserve(mPoints.Size() + numPoints);
+  mNormals.Reserve(mNormals.Size() + numNormals);
+  mTextureUv.Reserve(mTextureUv.Size() + numTextureUvs);
+  mTriangles.Reserve(mTriangles.Size() + numTriangles);
+
+  Vector3  point;
+  Vector2  texture;
+  int      ptIdx[MAX_POINT_INDICES];
+  int      nrmIdx[MAX_POINT_INDICES];
+  int      texIdx[MAX_POINT_INDICES];
+  TriIndex triangle;
+  bool     iniObj         = false;
+  bool     hasTexture     = false;
+  bool     missingNormals = false;
+
+  //Init AABB for the file
+  mSceneAABB.Init();
+
+  while(p < end)
+  {
+    const char* lineEnd = FindLineEnd(p, end);
+
+    const char* tag;
+    size_t      tagLength = ReadToken(p, lineEnd, tag);
+
+    if(TokenIs(tag, tagLength, "v"))
+    {
+      ParseFloat(p, lineEnd, point.x);
+      ParseFloat(p, lineEnd, point.y);
+      ParseFloat(p, lineEnd, point.z);
+      mPoints.PushBack(point);
+
+      mSceneAABB.ConsiderNewPointInVolume(point);
+    }
+    else if(TokenIs(tag, tagLength, "vn"))
+    {
+      ParseFloat(p, lineEnd, point.x);
+      ParseFloat(p, lineEnd, point.y);
+      ParseFloat(p, lineEnd, point.z);
+      mNormals.PushBack(point);
+    }
+    else if(TokenIs(tag, tagLength, "vt"))
+    {
+      ParseFloat(p, lineEnd, texture.x);
+      ParseFloat(p, lineEnd, texture.y);
+      texture.y = 1.0 - texture.y;
+      mTextureUv.PushBack(texture);
+    }
+    else if(TokenIs(tag, tagLength, "f"))
+    {
+      iniObj = true;
+
+      int numIndices = 0;
+      while(numIndices < MAX_POINT_INDICES && ParseFaceVertex(p, lineEnd, ptIdx[numIndices], texIdx[numIndices], nrmIdx[numIndices], hasTexture))
+      {
+        missingNormals |= (nrmIdx[numIndices] == 0);
+        numIndices++;
+      }
+
+      //A triangle, or a quad which is split into the triangles (0, 1, 2) & (2, 3, 0).
+      for(int t = 0; t < numIndices - 2; t++)
+      {
+        for(int i = 0; i < 3; i++)
+        {
+          int idx                  = (2 * t + i) % numIndices;
+          triangle.pointIndex[i]   = ToZeroBasedIndex(ptIdx[idx], mPoints.Size());
+          triangle.normalIndex[i]  = ToZeroBasedIndex(nrmIdx[idx], mNormals.Size());
+          triangle.textureIndex[i] = ToZeroBasedIndex(texIdx[idx], mTextureUv.Size());
+        }
+        mTriangles.PushBack(triangle);
+      }
+    }
+    else if(TokenIs(tag, tagLength, "#_#tangent"))
+    {
+      ParseFloat(p, lineEnd, point.x);
+      ParseFloat(p, lineEnd, point.y);
+      ParseFloat(p, lineEnd, point.z);
+      mTangents.PushBack(point);
+    }
+    else if(TokenIs(tag, tagLength, "#_#binormal"))
+    {
+      ParseFloat(p, lineEnd, point.x);
+      ParseFloat(p, lineEnd, point.y);
+      ParseFloat(p, lineEnd, point.z);
+      mBiTangents.PushBack(point);
+    }
+    else if(TokenIs(tag, tagLength, "#_#vt1"))
+    {
+      ParseFloat(p, lineEnd, texture.x);
+      ParseFloat(p, lineEnd, texture.y);
+      texture.y = 1.0 - texture.y;
+      mTextureUv2.PushBack(texture);
+    }
+
+    p = (lineEnd < end) ? lineEnd + 1 : end;
+  }
+
+  if(missingNormals)
+  {
+    //Faces of the form A or A/B do not reference the file's normals, so they have to be calculated instead.
+    mNormals.Clear();
+  }
+
+  if(iniObj)
+  {
+    CenterAndScale(true, mPoints);
+    mSceneLoaded  = true;
+    mHasTextureUv = hasTexture;
+    return true;
+  }
+
+  return false;
+}
+
+bool ObjLoader::LoadObjectWithStreams(char* objBuffer, std::streampos fileSize)
 {
   Vector3     point;
   Vector2     texture;
@@ -597,64 +1318,93 @@ void ObjLoader::LoadMaterial(char*          objBuffer,
   mMaterialLoaded = true;
 }
 
-Geometry ObjLoader::CreateGeometry(int objectProperties, bool useSoftNormals)
+void ObjLoader::CreateInterleavedData(int objectProperties, bool useSoftNormals, InterleavedData& data)
 {
-  Geometry surface = Geometry::New();
+  Dali::Vector<Vector3> positions;
+  Dali::Vector<Vector3> normals;
+  Dali::Vector<Vector3> tangents;
+  Dali::Vector<Vector2> textures;
 
-  Dali::Vector<Vector3>        positions;
-  Dali::Vector<Vector3>        normals;
-  Dali::Vector<Vector3>        tangents;
-  Dali::Vector<Vector2>        textures;
-  Dali::Vector<unsigned short> indices;
+  CreateGeometryArray(positions, normals, tangents, textures, data.indices, useSoftNormals);
 
-  CreateGeometryArray(positions, normals, tangents, textures, indices, useSoftNormals);
+  //All vertices have Position and Normal, some need tangents and texture coordinates.
+  data.attributes = 0;
+  if(mHasTextureUv)
+  {
+    data.attributes = objectProperties & (TANGENTS | TEXTURE_COORDINATES);
+  }
 
-  //All vertices need at least Position and Normal
+  const unsigned int stride = GetVertexStride(data.attributes);
+  data.vertices.Resize(positions.Count() * stride);
 
-  Property::Map positionMap;
-  positionMap["aPosition"]    = Property::VECTOR3;
-  VertexBuffer positionBuffer = VertexBuffer::New(positionMap);
-  positionBuffer.SetData(positions.Begin(), positions.Count());
+  float* vertex = data.vertices.Begin();
+  for(unsigned int i = 0; i < positions.Count(); ++i)
+  {
+    *vertex++ = positions[i].x;
+    *vertex++ = positions[i].y;
+    *vertex++ = positions[i].z;
+    *vertex++ = normals[i].x;
+    *vertex++ = normals[i].y;
+    *vertex++ = normals[i].z;
+
+    if(data.attributes & TANGENTS)
+    {
+      *vertex++ = tangents[i].x;
+      *vertex++ = tangents[i].y;
+      *vertex++ = tangents[i].z;
+    }
 
-  Property::Map normalMap;
-  normalMap["aNormal"]      = Property::VECTOR3;
-  VertexBuffer normalBuffer = VertexBuffer::New(normalMap);
-  normalBuffer.SetData(normals.Begin(), normals.Count());
+    if(data.attributes & TEXTURE_COORDINATES)
+    {
+      *vertex++ = textures[i].x;
+      *vertex++ = textures[i].y;
+    }
+  }
+}
 
-  surface.AddVertexBuffer(positionBuffer);
-  surface.AddVertexBuffer(normalBuffer);
+unsigned int ObjLoader::GetVertexStride(int attributes)
+{
+  return 6u + ((attributes & TANGENTS) ? 3u : 0u) + ((attributes & TEXTURE_COORDINATES) ? 2u : 0u);
+}
 
-  //Some need tangent
-  if((objectProperties & TANGENTS) && mHasTextureUv)
+Geometry ObjLoader::CreateGeometry(int attributes, const float* vertices, unsigned int vertexCount, const unsigned short* indices, unsigned int indexCount)
+{
+  //The attributes are interleaved in the order they are added to the format.
+  Property::Map vertexFormat;
+  vertexFormat["aPosition"] = Property::VECTOR3;
+  vertexFormat["aNormal"]   = Property::VECTOR3;
+  if(attributes & TANGENTS)
   {
-    Property::Map tangentMap;
-    tangentMap["aTangent"]     = Property::VECTOR3;
-    VertexBuffer tangentBuffer = VertexBuffer::New(tangentMap);
-    tangentBuffer.SetData(tangents.Begin(), tangents.Count());
-
-    surface.AddVertexBuffer(tangentBuffer);
+    vertexFormat["aTangent"] = Property::VECTOR3;
   }
-
-  //Some need texture coordinates
-  if((objectProperties & TEXTURE_COORDINATES) && mHasTextureUv)
+  if(attributes & TEXTURE_COORDINATES)
   {
-    Property::Map textCoordMap;
-    textCoordMap["aTexCoord"]   = Property::VECTOR2;
-    VertexBuffer texCoordBuffer = VertexBuffer::New(textCoordMap);
-    texCoordBuffer.SetData(textures.Begin(), textures.Count());
-
-    surface.AddVertexBuffer(texCoordBuffer);
+    vertexFormat["aTexCoord"] = Property::VECTOR2;
   }
 
+  VertexBuffer vertexBuffer = VertexBuffer::New(vertexFormat);
+  vertexBuffer.SetData(vertices, vertexCount);
+
+  Geometry surface = Geometry::New();
+  surface.AddVertexBuffer(vertexBuffer);
+
   //If indices are required, we set them.
-  if(indices.Size())
+  if(indexCount)
   {
-    surface.SetIndexBuffer(&indices[0], indices.Size());
+    surface.SetIndexBuffer(indices, indexCount);
   }
 
   return surface;
 }
 
+Geometry ObjLoader::CreateGeometry(int objectProperties, bool useSoftNormals)
+{
+  InterleavedData data;
+  CreateInterleavedData(objectProperties, useSoftNormals, data);
+
+  return CreateGeometry(data.attributes, data.vertices.Begin(), data.vertices.Count() / GetVertexStride(data.attributes), data.indices.Begin(), data.indices.Count());
+}
+
 Vector3 ObjLoader::GetCenter()
 {
   Vector3 center = GetSize() * 0.5 + mSceneAABB.pointMin;
@@ -667,6 +1417,16 @@ Vector3 ObjLoader::GetSize()
   return size;
 }
 
+unsigned int ObjLoader::GetPointCount()
+{
+  return mPoints.Size();
+}
+
+unsigned int ObjLoader::GetTriangleCount()
+{
+  return mTriangles.Size();
+}
+
 void ObjLoader::ClearArrays()
 {
   mPoints.Clear();
@@ -21,6 +21,7 @@
 // EXTERNAL INCLUDES
 #include <dali/public-api/rendering/geometry.h>
 #include <limits>
+#include <string>
 
 using namespace Dali;
 
@@ -73,15 +74,105 @@ public:
   bool IsSceneLoaded();
   bool IsMaterialLoaded();
 
+  /**
+   * @brief Parses an OBJ file held in memory.
+   *
+   * The buffer is parsed in place, in a single pass, without copying it or allocating per line.
+   *
+   * @param[in] objBuffer The contents of the OBJ file, which does not need to be null terminated.
+   * @param[in] size The size of the buffer in bytes.
+   * @return Whether the buffer contained at least one face.
+   */
+  bool LoadObject(const char* objBuffer, size_t size);
+
+  /**
+   * @copydoc LoadObject(const char*, size_t)
+   */
   bool LoadObject(char* objBuffer, std::streampos fileSize);
 
+  /**
+   * @brief Memory-maps the OBJ file at the given url and parses it.
+   *
+   * @param[in] url The path of the OBJ file.
+   * @return Whether the file could be read and contained at least one face.
+   */
+  bool LoadObject(const std::string& url);
+
+  /**
+   * @brief The original parser, which reads the buffer through a std::istringstream per line.
+   *
+   * Kept as the reference the faster LoadObject() is benchmarked and validated against.
+   *
+   * @param[in] objBuffer The contents of the OBJ file.
+   * @param[in] fileSize The size of the buffer in bytes.
+   * @return Whether the buffer contained at least one face.
+   */
+  bool LoadObjectWithStreams(char* objBuffer, std::streampos fileSize);
+
   void LoadMaterial(char* objBuffer, std::streampos fileSize, std::string& diffuseTextureUrl, std::string& normalTextureUrl, std::string& glossTextureUrl);
 
+  /**
+   * @brief The vertex data of the loaded object, laid out as it is uploaded to the GPU.
+   */
+  struct InterleavedData
+  {
+    Dali::Vector<float>          vertices;   ///< The position & normal, then the tangent & texture coordinates if present in attributes, of each vertex.
+    Dali::Vector<unsigned short> indices;    ///< Indices of the triangles' vertices, empty if the vertices are not shared.
+    int                          attributes; ///< The optional ObjectProperties present in vertices.
+  };
+
+  /**
+   * @brief Creates the interleaved vertex and index data of the loaded object.
+   *
+   * @param[in] objectProperties The ObjectProperties the geometry needs; ignored when the object has no texture coordinates.
+   * @param[in] useSoftNormals Indicates whether we should average the normals at each point to smooth the surface or not.
+   * @param[out] data The vertex and index data.
+   */
+  void CreateInterleavedData(int objectProperties, bool useSoftNormals, InterleavedData& data);
+
+  /**
+   * @brief Retrieves the number of floats per vertex in InterleavedData::vertices.
+   */
+  static unsigned int GetVertexStride(int attributes);
+
+  /**
+   * @brief Creates a geometry from interleaved vertex data, e.g. from InterleavedData.
+   *
+   * @param[in] attributes The optional ObjectProperties present in vertices.
+   * @param[in] vertices The interleaved vertex data.
+   * @param[in] vertexCount The number of vertices.
+   * @param[in] indices The indices, may be nullptr if indexCount is 0.
+   * @param[in] indexCount The number of indices.
+   */
+  static Geometry CreateGeometry(int attributes, const float* vertices, unsigned int vertexCount, const unsigned short* indices, unsigned int indexCount);
+
   Geometry CreateGeometry(int objectProperties, bool useSoftNormals);
 
+  /**
+   * @brief Sets how many threads are used to generate the normals and tangents of large objects.
+   *
+   * The triangles are split between the threads, each accumulating into its own copy of the normals or tangents,
+   * which are then summed. Objects too small to benefit always use the calling thread only.
+   *
+   * @param[in] threadCount The number of threads, 0 (the default) for one per core, 1 for the calling thread only.
+   */
+  void SetThreadCount(unsigned int threadCount);
+
+  /**
+   * @brief Generates the normals and tangents the geometry needs but the file did not provide.
+   *
+   * Called by CreateGeometry() and CreateInterleavedData(), public so it can be timed on its own.
+   *
+   * @param[in] useSoftNormals Indicates whether we should average the normals at each point to smooth the surface or not.
+   */
+  void CalculateNormalsAndTangents(bool useSoftNormals);
+
   Vector3 GetCenter();
   Vector3 GetSize();
 
+  unsigned int GetPointCount();
+  unsigned int GetTriangleCount();
+
   void ClearArrays();
 
   bool IsTexturePresent();
@@ -109,6 +200,8 @@ private:
   bool mHasNormalMap;
   bool mHasSpecularMap;
 
+  unsigned int mThreadCount; ///< The number of threads requested by SetThreadCount().
+
   /**
    * @brief Calculates normals for each point on a per-face basis.
    *
@@ -142,6 +235,11 @@ private:
    */
   void CalculateTangentFrame();
 
+  /**
+   * @brief Retrieves the number of threads to use for the given number of triangles.
+   */
+  unsigned int GetThreadCount(size_t triangleCount) const;
+
   void CenterAndScale(bool center, Dali::Vector<Vector3>& points);
 
   /**
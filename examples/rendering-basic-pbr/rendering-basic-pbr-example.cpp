@@ -26,7 +26,10 @@
 #include <dali/integration-api/debug.h>
 #include "ktx-loader.h"
 #include "model-pbr.h"
+#include "obj-loader-benchmark.h"
 #include "model-skybox.h"
+#include "shared/baked-texture.h"
+#include "shared/launch-latency.h"
 
 using namespace Dali;
 using namespace Toolkit;
@@ -73,6 +76,9 @@ const Vector3 CAMERA_DEFAULT_POSITION(0.0f, 0.0f, 3.5f);
  * - Pan up/down on right side of screen to change metalness
  * - Pan anywhere else to rotate scene
  *
+ * Run with "--benchmark-obj-loader [iterations] [file.obj...]" to time the OBJ parsers on the
+ * example's models (and any other given files) instead of showing the scene.
+ *
 */
 
 class BasicPbrController : public ConnectionTracker
@@ -339,43 +345,51 @@ public:
    */
   void CreateTexture()
   {
-    PixelData albeldoPixelData   = SyncImageLoader::Load(ALBEDO_METAL_TEXTURE_URL);
-    Texture   textureAlbedoMetal = Texture::New(TextureType::TEXTURE_2D, albeldoPixelData.GetPixelFormat(), albeldoPixelData.GetWidth(), albeldoPixelData.GetHeight());
-    textureAlbedoMetal.Upload(albeldoPixelData, 0, 0, 0, 0, albeldoPixelData.GetWidth(), albeldoPixelData.GetHeight());
-
-    PixelData normalPixelData    = SyncImageLoader::Load(NORMAL_ROUGH_TEXTURE_URL);
-    Texture   textureNormalRough = Texture::New(TextureType::TEXTURE_2D, normalPixelData.GetPixelFormat(), normalPixelData.GetWidth(), normalPixelData.GetHeight());
-    textureNormalRough.Upload(normalPixelData, 0, 0, 0, 0, normalPixelData.GetWidth(), normalPixelData.GetHeight());
+    // Baked (ETC2 compressed & mipmapped) versions of these textures are used when they have been installed, then
+    // their samplers minify from the mipmaps
+    uint32_t albedoMetalLevels  = 1u;
+    uint32_t normalRoughLevels  = 1u;
+    Texture  textureAlbedoMetal = DemoHelper::LoadBakedTexture(ALBEDO_METAL_TEXTURE_URL, &albedoMetalLevels);
+    Texture  textureNormalRough = DemoHelper::LoadBakedTexture(NORMAL_ROUGH_TEXTURE_URL, &normalRoughLevels);
+    Sampler  samplerAlbedoMetal = DemoHelper::NewTextureSampler(albedoMetalLevels);
+    Sampler  samplerNormalRough = DemoHelper::NewTextureSampler(normalRoughLevels);
 
     // This texture should have 6 faces and only one mipmap
-    PbrDemo::CubeData diffuse;
-    PbrDemo::LoadCubeMapFromKtxFile(CUBEMAP_DIFFUSE_TEXTURE_URL, diffuse);
-
-    Texture diffuseTexture = Texture::New(TextureType::TEXTURE_CUBE, diffuse.img[0][0].GetPixelFormat(), diffuse.img[0][0].GetWidth(), diffuse.img[0][0].GetHeight());
-    for(unsigned int midmapLevel = 0; midmapLevel < diffuse.img[0].size(); ++midmapLevel)
-    {
-      for(unsigned int i = 0; i < diffuse.img.size(); ++i)
-      {
-        diffuseTexture.Upload(diffuse.img[i][midmapLevel], CubeMapLayer::POSITIVE_X + i, midmapLevel, 0, 0, diffuse.img[i][midmapLevel].GetWidth(), diffuse.img[i][midmapLevel].GetHeight());
-      }
-    }
+    Texture diffuseTexture = LoadCubeMap(CUBEMAP_DIFFUSE_TEXTURE_URL);
 
     // This texture should have 6 faces and 6 mipmaps
-    PbrDemo::CubeData specular;
-    PbrDemo::LoadCubeMapFromKtxFile(CUBEMAP_SPECULAR_TEXTURE_URL, specular);
+    Texture specularTexture = LoadCubeMap(CUBEMAP_SPECULAR_TEXTURE_URL);
 
-    Texture specularTexture = Texture::New(TextureType::TEXTURE_CUBE, specular.img[0][0].GetPixelFormat(), specular.img[0][0].GetWidth(), specular.img[0][0].GetHeight());
-    for(unsigned int midmapLevel = 0; midmapLevel < specular.img[0].size(); ++midmapLevel)
+    mModel[0].InitTexture(textureAlbedoMetal, samplerAlbedoMetal, textureNormalRough, samplerNormalRough, diffuseTexture, specularTexture);
+    mModel[1].InitTexture(textureAlbedoMetal, samplerAlbedoMetal, textureNormalRough, samplerNormalRough, diffuseTexture, specularTexture);
+    mSkybox.InitTexture(specularTexture);
+  }
+
+  /**
+   * @brief Loads a cube map from a KTX file and logs what it cost.
+   * @param[in] url The path of the KTX file.
+   * @return The cube texture, empty if the file could not be loaded.
+   */
+  Texture LoadCubeMap(const std::string& url)
+  {
+    Texture                    texture;
+    PbrDemo::KtxLoadStatistics statistics;
+    if(!PbrDemo::LoadCubeMapFromKtxFile(url, texture, &statistics))
     {
-      for(unsigned int i = 0; i < specular.img.size(); ++i)
-      {
-        specularTexture.Upload(specular.img[i][midmapLevel], CubeMapLayer::POSITIVE_X + i, midmapLevel, 0, 0, specular.img[i][midmapLevel].GetWidth(), specular.img[i][midmapLevel].GetHeight());
-      }
+      DALI_LOG_ERROR("Unable to load cube map %s\n", url.c_str());
+      return texture;
     }
 
-    mModel[0].InitTexture(textureAlbedoMetal, textureNormalRough, diffuseTexture, specularTexture);
-    mModel[1].InitTexture(textureAlbedoMetal, textureNormalRough, diffuseTexture, specularTexture);
-    mSkybox.InitTexture(specularTexture);
+    DALI_LOG_RELEASE_INFO("%s: %u faces x %u mipmaps, %zu of %zu bytes read (%s), %zu bytes uploaded%s\n",
+                          url.c_str(),
+                          statistics.faces,
+                          statistics.mipmaps,
+                          statistics.bytesRead,
+                          statistics.fileSize,
+                          statistics.mapped ? "mapped" : "copied",
+                          statistics.bytesUploaded,
+                          statistics.converted ? " after conversion" : "");
+    return texture;
   }
 
   /**
@@ -457,8 +471,35 @@ private:
 
 int DALI_EXPORT_API main(int argc, char** argv)
 {
+  if(argc > 1 && std::string(argv[1]) == "--benchmark-obj-loader")
+  {
+    unsigned int             iterations = 10u;
+    std::vector<std::string> urls       = {SPHERE_URL, TEAPOT_URL};
+    for(int i = 2; i < argc; ++i)
+    {
+      std::string arg(argv[i]);
+      if(!arg.empty() && isdigit(arg[0]))
+      {
+        iterations = atoi(arg.c_str());
+      }
+      else
+      {
+        urls.push_back(arg);
+      }
+    }
+    return PbrDemo::RunObjLoaderBenchmark(urls, iterations) ? 0 : 1;
+  }
+
+  if(argc > 1 && std::string(argv[1]) == "--benchmark-normals")
+  {
+    unsigned int gridSize   = (argc > 2) ? atoi(argv[2]) : 1024u;
+    unsigned int iterations = (argc > 3) ? atoi(argv[3]) : 5u;
+    return PbrDemo::RunNormalGenerationBenchmark(gridSize, iterations) ? 0 : 1;
+  }
+
   Application        application = Application::New(&argc, &argv);
   BasicPbrController test(application);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
   return 0;
 }
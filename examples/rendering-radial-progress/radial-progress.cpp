@@ -18,6 +18,8 @@
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali/dali.h>
 
+#include "shared/launch-latency.h"
+
 using namespace Dali;
 
 namespace // unnamed namespace
@@ -311,6 +313,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application              application = Application::New(&argc, &argv);
   RadialProgressController test(application);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
   return 0;
 }
@@ -19,6 +19,8 @@
 #include <dali/dali.h>
 
 #include "look-camera.h"
+#include "shared/baked-texture.h"
+#include "shared/launch-latency.h"
 
 using namespace Dali;
 using namespace Toolkit;
@@ -103,9 +105,7 @@ const Vector3 CAMERA_DEFAULT_POSITION(0.0f, 0.0f, 100.0f);
 
 const char* TEXTURE_URL = DEMO_IMAGE_DIR "wood.png";
 
-const unsigned int SKYBOX_FACE_COUNT  = 6;
-const unsigned int SKYBOX_FACE_WIDTH  = 2048;
-const unsigned int SKYBOX_FACE_HEIGHT = 2048;
+const unsigned int SKYBOX_FACE_COUNT = 6;
 
 /*
  * Credit to Joey do Vries for the following cubemap images
@@ -362,15 +362,14 @@ public:
    */
   void DisplayCube()
   {
-    // Load image from file
-    PixelData pixels = SyncImageLoader::Load(TEXTURE_URL);
-
-    Texture texture = Texture::New(TextureType::TEXTURE_2D, pixels.GetPixelFormat(), pixels.GetWidth(), pixels.GetHeight());
-    texture.Upload(pixels, 0, 0, 0, 0, pixels.GetWidth(), pixels.GetHeight());
+    // Load image from file, or its baked version if it has been installed
+    uint32_t mipmapLevels = 1u;
+    Texture  texture      = DemoHelper::LoadBakedTexture(TEXTURE_URL, &mipmapLevels);
 
     // create TextureSet
     mTextureSet = TextureSet::New();
     mTextureSet.SetTexture(0, texture);
+    mTextureSet.SetSampler(0, DemoHelper::NewTextureSampler(mipmapLevels));
 
     mRenderer = Renderer::New(mGeometry, mShaderCube);
     mRenderer.SetTextures(mTextureSet);
@@ -399,17 +398,14 @@ public:
    */
   void DisplaySkybox()
   {
-    // Load skybox faces from file
-    Texture texture = Texture::New(TextureType::TEXTURE_CUBE, Pixel::RGBA8888, SKYBOX_FACE_WIDTH, SKYBOX_FACE_HEIGHT);
-    for(unsigned int i = 0; i < SKYBOX_FACE_COUNT; i++)
-    {
-      PixelData pixels = SyncImageLoader::Load(SKYBOX_FACES[i]);
-      texture.Upload(pixels, CubeMapLayer::POSITIVE_X + i, 0, 0, 0, SKYBOX_FACE_WIDTH, SKYBOX_FACE_HEIGHT);
-    }
+    // Load skybox faces from file, or their baked versions if they have been installed
+    uint32_t mipmapLevels = 1u;
+    Texture  texture      = DemoHelper::LoadTextureLayers(std::vector<std::string>(SKYBOX_FACES, SKYBOX_FACES + SKYBOX_FACE_COUNT), TextureType::TEXTURE_CUBE, &mipmapLevels);
 
     // create TextureSet
     mSkyboxTextures = TextureSet::New();
     mSkyboxTextures.SetTexture(0, texture);
+    mSkyboxTextures.SetSampler(0, DemoHelper::NewTextureSampler(mipmapLevels));
 
     mSkyboxRenderer = Renderer::New(mSkyboxGeometry, mShaderSkybox);
     mSkyboxRenderer.SetTextures(mSkyboxTextures);
@@ -469,6 +465,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application            application = Application::New(&argc, &argv);
   TexturedCubeController test(application);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
   return 0;
 }
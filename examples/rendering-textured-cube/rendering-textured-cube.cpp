@@ -18,6 +18,9 @@
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali/dali.h>
 
+#include "shared/baked-texture.h"
+#include "shared/launch-latency.h"
+
 using namespace Dali;
 using namespace Toolkit;
 
@@ -215,21 +218,20 @@ public:
   }
 
   /**
-   * This function loads a pixel data from a file. In order to load it we use SyncImageLoader utility.
-   * If loading succeeds returned PixelData object can be used to create a texture.
-   * Texture must be uploaded. In the end the texture must be set on the TextureSet object.
+   * This function loads a texture from a file. DemoHelper::LoadBakedTexture() decodes the image, or uploads its
+   * baked (compressed & mipmapped) version when there is one, in which case the sampler minifies from its mipmaps.
+   * In the end the texture must be set on the TextureSet object.
    */
   void CreateTexture()
   {
-    // Load image from file
-    PixelData pixels = SyncImageLoader::Load(TEXTURE_URL);
-
-    Texture texture = Texture::New(TextureType::TEXTURE_2D, pixels.GetPixelFormat(), pixels.GetWidth(), pixels.GetHeight());
-    texture.Upload(pixels, 0, 0, 0, 0, pixels.GetWidth(), pixels.GetHeight());
+    // Load image from file, or its baked version if it has been installed
+    uint32_t mipmapLevels = 1u;
+    Texture  texture      = DemoHelper::LoadBakedTexture(TEXTURE_URL, &mipmapLevels);
 
     // create TextureSet
     mTextureSet = TextureSet::New();
     mTextureSet.SetTexture(0, texture);
+    mTextureSet.SetSampler(0, DemoHelper::NewTextureSampler(mipmapLevels));
   }
 
   /**
@@ -290,6 +292,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application            application = Application::New(&argc, &argv);
   TexturedCubeController test(application);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
   return 0;
 }
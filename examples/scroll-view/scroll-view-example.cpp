@@ -21,6 +21,7 @@
 // INTERNAL INCLUDES
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali/dali.h>
+#include "shared/launch-latency.h"
 #include "shared/view.h"
 
 using namespace Dali;
@@ -586,6 +587,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application       app = Application::New(&argc, &argv, DEMO_THEME_PATH);
   ExampleController test(app);
+  DemoHelper::ReportLaunchLatency(app);
   app.MainLoop();
   return 0;
 }
@@ -16,6 +16,7 @@
  */
 
 // INTERNAL INCLUDES
+#include "shared/launch-latency.h"
 #include "shared/view.h"
 
 #include <dali-toolkit/dali-toolkit.h>
@@ -510,6 +511,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application app = Application::New(&argc, &argv, DEMO_THEME_PATH);
   TestApp     theApp(app);
+  DemoHelper::ReportLaunchLatency(app);
   app.MainLoop();
   return 0;
 }
@@ -27,6 +27,9 @@
 #include <dali/devel-api/text-abstraction/bitmap-font.h>
 #include <dali/devel-api/text-abstraction/font-client.h>
 
+// INTERNAL INCLUDES
+#include "shared/launch-latency.h"
+
 using namespace Dali;
 using namespace Dali::Toolkit;
 
@@ -186,6 +189,7 @@ void RunTest(Application& application)
 {
   SimpleTextLabelExample test(application);
 
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
 }
 
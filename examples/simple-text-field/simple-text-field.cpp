@@ -25,6 +25,9 @@
 #include <dali-toolkit/devel-api/controls/text-controls/text-field-devel.h>
 #include <iostream>
 
+// INTERNAL INCLUDES
+#include "shared/launch-latency.h"
+
 using namespace Dali;
 using namespace Dali::Toolkit;
 
@@ -132,6 +135,7 @@ void RunTest(Application& application)
 {
   SimpleTextFieldExample test(application);
 
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
 }
 
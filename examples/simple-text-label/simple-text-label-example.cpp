@@ -23,6 +23,9 @@
 // EXTERNAL INCLUDES
 #include <dali-toolkit/dali-toolkit.h>
 
+// INTERNAL INCLUDES
+#include "shared/launch-latency.h"
+
 using namespace Dali;
 using namespace Dali::Toolkit;
 
@@ -89,6 +92,7 @@ void RunTest(Application& application)
 {
   SimpleTextLabelExample test(application);
 
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
 }
 
@@ -26,6 +26,9 @@
 #include <dali/devel-api/adaptor-framework/image-loading.h>
 #include <dali/devel-api/adaptor-framework/pixel-buffer.h>
 
+// INTERNAL INCLUDES
+#include "shared/launch-latency.h"
+
 using namespace std;
 using namespace Dali;
 using namespace Dali::Toolkit;
@@ -338,6 +341,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 
   SimpleTextRendererExample test(application);
 
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
 
   return 0;
@@ -23,6 +23,9 @@
 // EXTERNAL INCLUDES
 #include <dali-toolkit/dali-toolkit.h>
 
+// INTERNAL INCLUDES
+#include "shared/launch-latency.h"
+
 using namespace Dali;
 using namespace Dali::Toolkit;
 
@@ -91,6 +94,7 @@ void RunTest(Application& application)
 {
   TextVisualExample test(application);
 
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
 }
 
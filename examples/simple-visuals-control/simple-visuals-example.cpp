@@ -23,6 +23,7 @@
 #include <dali/dali.h>
 
 // INTERNAL INCLUDES
+#include "shared/launch-latency.h"
 #include "simple-visuals-application.h"
 
 namespace
@@ -35,6 +36,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application                    application = Application::New(&argc, &argv, SIMPLE_DEMO_THEME); // Use the above defined style sheet for this application.
   Demo::SimpleVisualsApplication simpleVisualsApplication(application);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
   return 0;
 }
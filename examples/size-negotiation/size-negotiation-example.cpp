@@ -20,6 +20,7 @@
 #include <dali-toolkit/devel-api/controls/table-view/table-view.h>
 #include <dali-toolkit/devel-api/focus-manager/keyinput-focus-manager.h>
 #include <dali/dali.h>
+#include "shared/launch-latency.h"
 #include "shared/view.h"
 
 using namespace Dali;
@@ -817,6 +818,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application               application = Application::New(&argc, &argv, DEMO_THEME_PATH);
   SizeNegotiationController test(application);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
   return 0;
 }
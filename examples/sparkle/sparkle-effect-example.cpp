@@ -17,13 +17,22 @@
 
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali/dali.h>
+#include <dali/devel-api/common/stage-devel.h>
 
 #include <algorithm>
 #include <chrono> // std::chrono::system_clock
+#include <cmath>
+#include <cstring>
+#include <iostream>
 #include <map>
 #include <random> // std::default_random_engine
 #include <sstream>
+#include <type_traits>
+#include <vector>
 
+#include "shared/frame-time-recorder.h"
+#include "shared/launch-latency.h"
+#include "shared/particle-system.h"
 #include "shared/utility.h"
 #include "sparkle-effect.h"
 
@@ -58,23 +67,44 @@ float Mix(const Vector2& range, float a)
 
 const Vector4 BACKGROUND_COLOR(0.f, 0.f, 0.05f, 1.f);
 
+// the center of the circle the paths are defined in
+const Vector2 PATH_CENTER(250.f, 250.f);
+// the rotation between repeats of the paths, which spreads them evenly around the circle
+const float PATH_REPEAT_ANGLE = 2.39996323f; // golden angle
+
+// --particle-sweep
+const unsigned int PARTICLE_SWEEP_COUNTS[] = {NUM_PARTICLE, 1000u, 2000u, 4000u, 8000u, MAX_PARTICLE_COUNT};
+const unsigned int PARTICLE_SWEEP_WARM_UP_MS(1000u);
+const unsigned int PARTICLE_SWEEP_STEP_MS(4000u);
+
 } // unnamed namespace
 
 // This example shows a sparkle particle effect
 //
+// Invoked with --particles N it draws N particles, up to 16000, rather than one per path.
+// Invoked with --particle-sweep it will print the frame times for increasing numbers of particles,
+// then quit.
+//
 class SparkleEffectExample : public ConnectionTracker
 {
 public:
   /**
    * Create the SparkleEffectExample
    * @param[in] application The DALi application instance
+   * @param[in] particleCount The number of particles
+   * @param[in] particleSweep Whether to print the frame times for increasing numbers of particles, then quit
    */
-  SparkleEffectExample(Application& application)
+  SparkleEffectExample(Application& application, unsigned int particleCount, bool particleSweep)
   : mApplication(application),
+    mParticles(particleSweep ? MAX_PARTICLE_COUNT : particleCount, STATE_ROW_COUNT),
     mAnimationIndex(0u),
-    mShaking(false)
+    mShaking(false),
+    mParticleSweep(particleSweep),
+    mSweepStep(0u)
   {
+    mParticles.SetParticleCount(particleCount);
     mApplication.InitSignal().Connect(this, &SparkleEffectExample::OnInit);
+    mApplication.TerminateSignal().Connect(this, &SparkleEffectExample::OnTerminate);
   }
 
 private:
@@ -94,7 +124,7 @@ private:
 
     window.Add(mCircleBackground);
 
-    mEffect = SparkleEffect::New();
+    mEffect = SparkleEffect::New(mParticles.GetVertexShaderPrologue());
 
     mMeshActor = CreateMeshActor();
 
@@ -112,58 +142,96 @@ private:
     mPanGestureDetector.Attach(mCircleBackground);
 
     PlayWanderAnimation(35.f);
+
+    if(mParticleSweep)
+    {
+      DevelStage::AddFrameCallback(Stage::GetCurrent(), mFrameTimeRecorder, window.GetRootLayer());
+      std::cout << "particles, frames, medianMs, p95Ms, meanMs" << std::endl;
+
+      mSweepStep = 0u;
+      StartSweepStep();
+    }
   }
 
   /**
-   * Create the mesh representing all the particles
+   * Stop the particle sweep, if any
+   * @param[in] application The DALi application instance
    */
-  Actor CreateMeshActor()
+  void OnTerminate(Application& application)
   {
-    // shuffling to assign the color in random order
-    unsigned int* shuffleArray = new unsigned int[NUM_PARTICLE];
-    for(unsigned int i = 0; i < NUM_PARTICLE; i++)
+    if(mSweepTimer)
     {
-      shuffleArray[i] = i;
+      mSweepTimer.Stop();
+      DevelStage::RemoveFrameCallback(Stage::GetCurrent(), mFrameTimeRecorder);
     }
-    const unsigned int seed = std::chrono::system_clock::now().time_since_epoch().count();
-    std::shuffle(&shuffleArray[0], &shuffleArray[NUM_PARTICLE], std::default_random_engine(seed));
+  }
 
-    // Create vertices
+  /**
+   * Set the particle count for the next step of the sweep and wait for it to settle
+   */
+  void StartSweepStep()
+  {
+    mParticles.SetParticleCount(PARTICLE_SWEEP_COUNTS[mSweepStep]);
 
-    std::vector<Vertex>         vertices;
-    std::vector<unsigned short> faces;
+    mSweepTimer = Timer::New(PARTICLE_SWEEP_WARM_UP_MS);
+    mSweepTimer.TickSignal().Connect(this, &SparkleEffectExample::OnSweepTimer);
+    mSweepTimer.Start();
+  }
 
-    for(unsigned int i = 0; i < NUM_PARTICLE; i++)
+  /**
+   * Callback of the sweep timer: starts recording the frame times once warmed up, then prints them
+   */
+  bool OnSweepTimer()
+  {
+    if(!mFrameTimeRecorder.IsRecording())
     {
-      float colorIndex = GetColorIndex(shuffleArray[i]);
-      AddParticletoMesh(vertices, faces, PATHS[i], colorIndex);
+      mFrameTimeRecorder.Start();
+      mSweepTimer.SetInterval(PARTICLE_SWEEP_STEP_MS);
+      return true;
     }
 
-    delete[] shuffleArray;
+    const DemoHelper::FrameTimeStatistics statistics = DemoHelper::CalculateFrameTimeStatistics(mFrameTimeRecorder.Stop());
+    std::cout << mParticles.GetParticleCount() << ", " << statistics.frameCount << ", " << statistics.median << ", "
+              << statistics.percentile95 << ", " << statistics.mean << std::endl;
 
-    Property::Map vertexFormat;
-    vertexFormat["aTexCoord"]      = Property::VECTOR2;
-    vertexFormat["aParticlePath0"] = Property::VECTOR2;
-    vertexFormat["aParticlePath1"] = Property::VECTOR2;
-    vertexFormat["aParticlePath2"] = Property::VECTOR2;
-    vertexFormat["aParticlePath3"] = Property::VECTOR2;
-    vertexFormat["aParticlePath4"] = Property::VECTOR2;
-    vertexFormat["aParticlePath5"] = Property::VECTOR2;
+    if(++mSweepStep < std::extent<decltype(PARTICLE_SWEEP_COUNTS)>::value)
+    {
+      StartSweepStep();
+    }
+    else
+    {
+      mApplication.Quit();
+    }
+    return false;
+  }
 
-    VertexBuffer vertexBuffer = VertexBuffer::New(vertexFormat);
-    vertexBuffer.SetData(&vertices[0], vertices.size());
+  /**
+   * Create the mesh representing all the particles
+   */
+  Actor CreateMeshActor()
+  {
+    const unsigned int capacity = mParticles.GetCapacity();
 
-    Geometry geometry = Geometry::New();
-    geometry.AddVertexBuffer(vertexBuffer);
-    geometry.SetIndexBuffer(&faces[0], faces.size());
-    geometry.SetType(Geometry::TRIANGLES);
+    // shuffling to assign the color in random order
+    std::vector<unsigned int> shuffleArray(capacity);
+    for(unsigned int i = 0; i < capacity; i++)
+    {
+      shuffleArray[i] = i;
+    }
+    const unsigned int seed = std::chrono::system_clock::now().time_since_epoch().count();
+    std::shuffle(shuffleArray.begin(), shuffleArray.end(), std::default_random_engine(seed));
 
-    Texture    particleTexture = DemoHelper::LoadTexture(PARTICLE_IMAGE);
-    TextureSet textureSet      = TextureSet::New();
-    textureSet.SetTexture(0u, particleTexture);
+    // The state of every particle, even those beyond the particle count, so that changing the count only
+    // changes a uniform.
+    for(unsigned int i = 0; i < capacity; i++)
+    {
+      float colorIndex = GetColorIndex(shuffleArray[i] % NUM_PARTICLE);
+      SetParticleState(i, colorIndex);
+    }
 
-    Renderer renderer = Renderer::New(geometry, mEffect);
-    renderer.SetTextures(textureSet);
+    Texture  particleTexture = DemoHelper::LoadTexture(PARTICLE_IMAGE);
+    Renderer renderer        = mParticles.CreateRenderer(mEffect);
+    renderer.GetTextures().SetTexture(1u, particleTexture);
 
     Actor meshActor = Actor::New();
     meshActor.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
@@ -191,53 +259,39 @@ private:
   }
 
   /**
-   * All a particle to the mesh by giving the moving path and color index
-   *
-   * Two triangles per particle
-   *  0---------3
-   *   |\      |
-   *   |  \    |
-   *   |    \  |
-   *   |      \|
-   *  1---------2
-   *
-   * The information we need to pass in through attribute include:
+   * Set the state of a particle: its moving path and color index, fully opaque
    *
-   *   path which contains 12 integer
-   *          ---- passed in 6 Vector2 attributes
+   * The particles beyond the NUM_PARTICLE paths repeat them, each repeat rotated around the center of the circle.
    *
-   *   color index, particle index and textureCoor( (0,0) or (1,0) or (0,1) or (1,1)  )
-   *          ---- package these info into texCood attribute as: (+-colorIndex, +-particleIndex)
+   * The path, which contains 12 integers, is stored in 4 rows of the state; the color index, whose fraction is
+   * the particle's opacity, and the particle's offset along the path in another, see SparkleEffect::StateRow.
    */
-  void AddParticletoMesh(std::vector<Vertex>&         vertices,
-                         std::vector<unsigned short>& faces,
-                         MovingPath&                  movingPath,
-                         float                        colorIndex)
+  void SetParticleState(unsigned int particleIndex, float colorIndex)
   {
-    unsigned int idx = vertices.size();
-
-    // store the path into position and normal, which would be decoded inside the shader
-    Vector2 particlePath0(movingPath[0], movingPath[1]);
-    Vector2 particlePath1(movingPath[2], movingPath[3]);
-    Vector2 particlePath2(movingPath[4], movingPath[5]);
-    Vector2 particlePath3(movingPath[6], movingPath[7]);
-    Vector2 particlePath4(movingPath[8], movingPath[9]);
-    Vector2 particlePath5(movingPath[10], movingPath[11]);
-
-    float particleIdx = static_cast<float>(idx / 4 + 1); // count from 1
-    float colorIdx    = colorIndex + 1.f;                // count from 1
-    vertices.push_back(Vertex(Vector2(-colorIdx, -particleIdx), particlePath0, particlePath1, particlePath2, particlePath3, particlePath4, particlePath5));
-    vertices.push_back(Vertex(Vector2(-colorIdx, particleIdx), particlePath0, particlePath1, particlePath2, particlePath3, particlePath4, particlePath5));
-    vertices.push_back(Vertex(Vector2(colorIdx, particleIdx), particlePath0, particlePath1, particlePath2, particlePath3, particlePath4, particlePath5));
-    vertices.push_back(Vertex(Vector2(colorIdx, -particleIdx), particlePath0, particlePath1, particlePath2, particlePath3, particlePath4, particlePath5));
-
-    faces.push_back(idx);
-    faces.push_back(idx + 1);
-    faces.push_back(idx + 2);
-
-    faces.push_back(idx);
-    faces.push_back(idx + 2);
-    faces.push_back(idx + 3);
+    const MovingPath&  movingPath = PATHS[particleIndex % NUM_PARTICLE];
+    const unsigned int repeat     = particleIndex / NUM_PARTICLE;
+    const float        cosAngle   = std::cos(repeat * PATH_REPEAT_ANGLE);
+    const float        sinAngle   = std::sin(repeat * PATH_REPEAT_ANGLE);
+
+    float path[12];
+    for(unsigned int i = 0; i < 12; i += 2)
+    {
+      const Vector2 point = Vector2(movingPath[i], movingPath[i + 1]) - PATH_CENTER;
+      path[i]             = PATH_CENTER.x + point.x * cosAngle - point.y * sinAngle;
+      path[i + 1]         = PATH_CENTER.y + point.x * sinAngle + point.y * cosAngle;
+    }
+
+    mParticles.SetState(particleIndex, STATE_PATH_0, Vector3(path[0], path[1], path[2]));
+    mParticles.SetState(particleIndex, STATE_PATH_1, Vector3(path[3], path[4], path[5]));
+    mParticles.SetState(particleIndex, STATE_PATH_2, Vector3(path[6], path[7], path[8]));
+    mParticles.SetState(particleIndex, STATE_PATH_3, Vector3(path[9], path[10], path[11]));
+
+    // As the movement along the b-curve has nonuniform speed, the particles on the same path start at different
+    // points of it to look more random.
+    const float increment = static_cast<float>(particleIndex % NUM_PARTICLE) / NUM_PARTICLE * 5.f + repeat * 0.618034f;
+    mParticles.SetState(particleIndex, STATE_APPEARANCE, Vector3(colorIndex, increment, 0.f));
+    mParticles.SetState(particleIndex, STATE_OPACITY, Vector3(1.f, 1.f, 0.f));
+    mParticles.SetState(particleIndex, STATE_OPACITY_TIME, Vector3::ZERO);
   }
 
   /*
@@ -275,7 +329,7 @@ private:
       {
         case 0:
         {
-          PlayParticleFadeAnimation(0, NUM_PARTICLE, 0.f, 3.f);
+          PlayParticleFadeAnimation(0, mParticles.GetParticleCount(), 0.f, 3.f);
           break;
         }
         case 1:
@@ -364,16 +418,17 @@ private:
     breakAnimation.AnimateTo(Property(mMeshActor, Actor::Property::POSITION), ACTOR_POSITION, EaseOutSquare);
     breakAnimation.FinishedSignal().Connect(this, &SparkleEffectExample::OnBreakAnimationFinished);
 
-    float              timeUnit = duration / (NUM_PARTICLE + 1) / (NUM_PARTICLE + 1);
-    std::ostringstream oss;
-    for(unsigned int i = 0; i < NUM_PARTICLE; i++)
+    // the particles appear one after another, each fading in at its own time within the animation
+    const unsigned int particleCount = mParticles.GetParticleCount();
+    float              timeUnit      = duration / (particleCount + 1) / (particleCount + 1);
+    for(unsigned int i = 0; i < particleCount; i++)
     {
-      oss.str("");
-      oss << OPACITY_UNIFORM_NAME << i << "]";
-      mEffect.SetProperty(mEffect.GetPropertyIndex(oss.str()), 0.01f);
       float timeSlice = timeUnit * i * i;
-      breakAnimation.AnimateTo(Property(mEffect, oss.str()), 1.f, AlphaFunction::EASE_IN_OUT_SINE, TimePeriod(timeSlice * 0.5f, timeSlice));
+      mParticles.SetState(i, STATE_OPACITY, Vector3(0.01f, 1.f, 0.f));
+      mParticles.SetState(i, STATE_OPACITY_TIME, Vector3(timeSlice * 0.5f, timeSlice, 0.f));
     }
+    mParticles.Flush();
+    StartOpacityAnimation(breakAnimation, duration * 1.5f, 1.f);
 
     breakAnimation.Play();
   }
@@ -397,22 +452,42 @@ private:
     float timeSlice    = duration / (numParticle + 1);
     float fadeDuration = timeSlice > 0.5f ? timeSlice : 0.5f;
 
-    Animation          fadeAnimation = Animation::New(duration + fadeDuration * 2.f);
-    std::ostringstream oss;
-    for(unsigned int i = startIndex; i < numParticle; i++)
+    Animation fadeAnimation = Animation::New(duration + fadeDuration * 2.f);
+    for(unsigned int i = 0; i < mParticles.GetParticleCount(); i++)
     {
-      if(i >= NUM_PARTICLE) break; // out of bound
-
-      oss.str("");
-      oss << OPACITY_UNIFORM_NAME << i << "]";
-      fadeAnimation.AnimateTo(Property(mEffect, oss.str()), targetValue, TimePeriod(timeSlice * i, fadeDuration * 2.f));
+      // the particles outside the range keep the opacity they ended the previous animation with
+      const float opacity = mParticles.GetState(i, STATE_OPACITY).y;
+      if(i >= startIndex && i < numParticle)
+      {
+        mParticles.SetState(i, STATE_OPACITY, Vector3(opacity, targetValue, 0.f));
+        mParticles.SetState(i, STATE_OPACITY_TIME, Vector3(timeSlice * i, fadeDuration * 2.f, 0.f));
+      }
+      else
+      {
+        mParticles.SetState(i, STATE_OPACITY, Vector3(opacity, opacity, 0.f));
+      }
     }
+    mParticles.Flush();
+    StartOpacityAnimation(fadeAnimation, duration + fadeDuration * 2.f, 0.f);
 
     fadeAnimation.Play();
     mFadeAnimation = fadeAnimation;
     mFadeAnimation.FinishedSignal().Connect(this, &SparkleEffectExample::OnFadeAnimationFinished);
   }
 
+  /**
+   * Animate the time through the particles' opacity animation, which has been set in their state
+   * @param[in] animation The animation to add the opacity animation to
+   * @param[in] duration The duration of the opacity animation
+   * @param[in] ease 0.0 for the particles to fade linearly, 1.0 to ease in & out
+   */
+  void StartOpacityAnimation(Animation& animation, float duration, float ease)
+  {
+    mEffect.SetProperty(mEffect.GetPropertyIndex(OPACITY_TIME_UNIFORM_NAME), 0.f);
+    mEffect.SetProperty(mEffect.GetPropertyIndex(OPACITY_EASE_UNIFORM_NAME), ease);
+    animation.AnimateTo(Property(mEffect, OPACITY_TIME_UNIFORM_NAME), duration);
+  }
+
   /**
    * Push the particles to the edge all around the circle then bounce back
    * @param[in] duration The duration for the animation
@@ -528,10 +603,11 @@ private:
   }
 
 private:
-  Application& mApplication;
-  Shader       mEffect;
-  ImageView    mCircleBackground;
-  Actor        mMeshActor;
+  Application&               mApplication;
+  DemoHelper::ParticleSystem mParticles;
+  Shader                     mEffect;
+  ImageView                  mCircleBackground;
+  Actor                      mMeshActor;
 
   PanGestureDetector mPanGestureDetector;
   TapGestureDetector mTapDetector;
@@ -545,12 +621,33 @@ private:
   bool         mShaking;
 
   std::map<Animation, int> mTapAnimationIndexPair;
+
+  // --particle-sweep
+  DemoHelper::FrameTimeRecorder mFrameTimeRecorder;
+  Timer                         mSweepTimer;
+  bool                          mParticleSweep;
+  unsigned int                  mSweepStep;
 };
 
 int DALI_EXPORT_API main(int argc, char** argv)
 {
+  unsigned int particleCount = NUM_PARTICLE;
+  bool         particleSweep = false;
+  for(int i = 1; i < argc; ++i)
+  {
+    if(strcmp(argv[i], "--particle-sweep") == 0)
+    {
+      particleSweep = true;
+    }
+    else if(strcmp(argv[i], "--particles") == 0 && i + 1 < argc)
+    {
+      particleCount = std::min(std::max(atoi(argv[++i]), 1), static_cast<int>(MAX_PARTICLE_COUNT));
+    }
+  }
+
   Application          application = Application::New(&argc, &argv);
-  SparkleEffectExample theApp(application);
+  SparkleEffectExample theApp(application, particleCount, particleSweep);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
   return 0;
 }
@@ -34,8 +34,6 @@ namespace SparkleEffect
 const std::string PERCENTAGE_UNIFORM_NAME("uPercentage");
 // uniform array of particle color, set their value as the PARTICLE_COLORS given below
 const std::string PARTICLE_COLOR_UNIFORM_NAME("uParticleColors[");
-// uniform array of particle opacity
-const std::string OPACITY_UNIFORM_NAME("uOpacity[");
 // uniform which offsets the path control point, with this values >=0, the paths are squeezed towards the GatheringPoint
 const std::string ACCELARATION_UNIFORM_NAME("uAcceleration");
 // uniform which indicates the ongoing tap animations
@@ -195,60 +193,43 @@ const Vector3 ACTOR_POSITION(-176.f, -176.f, 1.f);
 
 const int MAXIMUM_ANIMATION_COUNT = 30;
 
-// Geometry format used by the SparkeEffect
-struct Vertex
-{
-  Vertex(const Vector2& texCoord,
-         const Vector2& aParticlePath0,
-         const Vector2& aParticlePath1,
-         const Vector2& aParticlePath2,
-         const Vector2& aParticlePath3,
-         const Vector2& aParticlePath4,
-         const Vector2& aParticlePath5)
-  : aTexCoord(texCoord),
-    aParticlePath0(aParticlePath0),
-    aParticlePath1(aParticlePath1),
-    aParticlePath2(aParticlePath2),
-    aParticlePath3(aParticlePath3),
-    aParticlePath4(aParticlePath4),
-    aParticlePath5(aParticlePath5)
-  {
-  }
+// The particles beyond the NUM_PARTICLE paths above repeat them, rotated around the center of the circle.
+const unsigned int MAX_PARTICLE_COUNT = 16000u;
 
-  Vector2 aTexCoord;
-  Vector2 aParticlePath0;
-  Vector2 aParticlePath1;
-  Vector2 aParticlePath2;
-  Vector2 aParticlePath3;
-  Vector2 aParticlePath4;
-  Vector2 aParticlePath5;
+// The rows of each particle's state, see DemoHelper::ParticleSystem.
+enum StateRow
+{
+  STATE_PATH_0,       // p0.x, p0.y, p1.x
+  STATE_PATH_1,       // p1.y, p2.x, p2.y
+  STATE_PATH_2,       // p3.x, p3.y, p4.x
+  STATE_PATH_3,       // p4.y, p5.x, p5.y
+  STATE_APPEARANCE,   // color index (its fraction is the opacity), offset along the path, unused
+  STATE_OPACITY,      // opacity at the start & end of the current opacity animation, unused
+  STATE_OPACITY_TIME, // delay & duration of the particle's fade within the current opacity animation, unused
+  STATE_ROW_COUNT
 };
 
+// uniform which is animated from 0 to the duration of the current opacity animation, in seconds
+const std::string OPACITY_TIME_UNIFORM_NAME("uOpacityTime");
+// uniform which selects the current opacity animation's alpha function: 0.0 linear, 1.0 ease in-out sine
+const std::string OPACITY_EASE_UNIFORM_NAME("uOpacityEase");
+
 /**
    * Create a SparkleEffect object.
+   * @param[in] vertexShaderPrologue The start of the vertex shader, from DemoHelper::ParticleSystem
    * @return A handle to a newly allocated SparkleEffect
    */
-Shader New()
+Shader New(const std::string& vertexShaderPrologue)
 {
   // clang-format off
     std::string vertexShader = DALI_COMPOSE_SHADER(
-      precision highp float;\n
-      \n
-      attribute vec2  aTexCoord;\n
       uniform   mat4  uMvpMatrix;\n
-      varying   vec2  vTexCoord;\n
-      \n
-      attribute vec2  aParticlePath0;\n
-      attribute vec2  aParticlePath1;\n
-      attribute vec2  aParticlePath2;\n
-      attribute vec2  aParticlePath3;\n
-      attribute vec2  aParticlePath4;\n
-      attribute vec2  aParticlePath5;\n
+      out       vec2  vTexCoord;\n
       \n
       uniform float uPercentage;\n
-      uniform float uPercentageMarked;\n
       uniform vec3  uParticleColors[NUM_COLOR];\n
-      uniform float uOpacity[NUM_PARTICLE];\n
+      uniform float uOpacityTime;\n
+      uniform float uOpacityEase;\n
       uniform vec2  uTapIndices;
       uniform float uTapOffset[MAXIMUM_ANIMATION_COUNT];\n
       uniform vec2  uTapPoint[MAXIMUM_ANIMATION_COUNT];\n
@@ -257,15 +238,19 @@ Shader New()
       uniform float uScale;\n
       uniform float uBreak;\n
       \n
-      varying lowp vec4 vColor;\n
+      out lowp vec4 vColor;\n
       \n
       void main()\n
       {\n
-        // we store the particle index inside texCoord attribute
-        float idx = abs(aTexCoord.y)-1.0;\n
+        // the particle fades between two opacities, each one at its own time within the opacity animation
+        vec3 opacityFade = ParticleState(STATE_OPACITY);\n
+        vec3 opacityTime = ParticleState(STATE_OPACITY_TIME);\n
+        float fade = clamp((uOpacityTime - opacityTime.x) / max(opacityTime.y, 1e-5), 0.0, 1.0);\n
+        fade = mix(fade, 0.5 - 0.5 * cos(fade * 3.14159265), uOpacityEase);\n
+        float opacity = mix(opacityFade.x, opacityFade.y, fade);\n
         \n
         // early out if the particle is invisible
-        if(uOpacity[int(idx)]<1e-5)\n
+        if(!IsParticleVisible() || opacity<1e-5)\n
         {\n
           gl_Position = vec4(0.0);\n
           vColor = vec4(0.0);\n
@@ -274,24 +259,29 @@ Shader New()
         \n
         // As the movement along the b-curve has nonuniform speed with a uniform increasing parameter 'uPercentage'
         // we give different particles the different 'percentage' to make them looks more random
-        float increment = idx / float(NUM_PARTICLE)*5.0;
-        float percentage = mod(uPercentage +uAcceleration+increment, 1.0);
+        vec3 appearance = ParticleState(STATE_APPEARANCE);\n
+        float increment = appearance.y;\n
+        float percentage = mod(uPercentage +uAcceleration+increment, 1.0);\n
         \n
+        vec3 path0 = ParticleState(STATE_PATH_0);\n
+        vec3 path1 = ParticleState(STATE_PATH_1);\n
+        vec3 path2 = ParticleState(STATE_PATH_2);\n
+        vec3 path3 = ParticleState(STATE_PATH_3);\n
         vec2 p0; vec2 p1; vec2 p2; vec2 p3;
         // calculate the particle position by using the cubic b-curve equation
         if(percentage<0.5)\n // particle on the first b-curve
         {\n
-          p0 = aParticlePath0;\n
-          p1 = aParticlePath1;\n
-          p2 = aParticlePath2;\n
-          p3 = aParticlePath3;\n
+          p0 = path0.xy;\n
+          p1 = vec2(path0.z, path1.x);\n
+          p2 = path1.yz;\n
+          p3 = path2.xy;\n
         }\n
         else\n
         {\n
-          p0 = aParticlePath3;\n
-          p1 = aParticlePath4;\n
-          p2 = aParticlePath5;\n
-          p3 = aParticlePath0;\n
+          p0 = path2.xy;\n
+          p1 = vec2(path2.z, path3.x);\n
+          p2 = path3.yz;\n
+          p3 = path0.xy;\n
         }\n
         float t = mod( percentage*2.0, 1.0);\n
         vec2 position = (1.0-t)*(1.0-t)*(1.0-t)*p0 + 3.0*(1.0-t)*(1.0-t)*t*p1+3.0*(1.0-t)*t*t*p2 + t*t*t*p3;\n
@@ -306,47 +296,54 @@ Shader New()
           position = mix( position, edgePoint, uTapOffset[id] ) ;\n
         }\n
         \n
-        position = mix( position, vec2( 250.0,250.0 ),uBreak*(1.0-uOpacity[int(idx)]) ) ;
+        position = mix( position, vec2( 250.0,250.0 ),uBreak*(1.0-opacity) ) ;
         \n
-        // vertex position on the mesh: (sign(aTexCoord.x), sign(aTexCoord.y))*PARTICLE_HALF_SIZE
-        gl_Position = uMvpMatrix * vec4( position.x+sign(aTexCoord.x)*PARTICLE_HALF_SIZE/uScale,
-                                         position.y+sign(aTexCoord.y)*PARTICLE_HALF_SIZE/uScale,
-                                         0.0, 1.0 );\n
+        // vertex position on the mesh: corner*PARTICLE_HALF_SIZE
+        vec2 corner = ParticleCorner();\n
+        gl_Position = uMvpMatrix * vec4( position + corner*PARTICLE_HALF_SIZE/uScale, 0.0, 1.0 );\n
         \n
-        // we store the color index inside texCoord attribute
-        float colorIndex = abs(aTexCoord.x);
-        vColor.rgb = uParticleColors[int(colorIndex)-1];\n
-        vColor.a = fract(colorIndex) * uOpacity[int(idx)];\n
+        // we store the color index inside the appearance state
+        float colorIndex = appearance.x;
+        vColor.rgb = uParticleColors[int(colorIndex)];\n
+        vColor.a = fract(colorIndex) * opacity;\n
         \n
         // produce a 'seemingly' random fade in/out
         percentage = mod(uPercentage+increment+0.15, 1.0);\n
         float ramdomOpacity = (min(percentage, 0.25)-0.15+0.9-max(percentage,0.9))*10.0;\n
         vColor.a *=ramdomOpacity;\n
         \n
-        vTexCoord = clamp(aTexCoord, 0.0, 1.0);\n
+        vTexCoord = corner * 0.5 + 0.5;\n
       }\n
     );
 
-    std::string fragmentShader = DALI_COMPOSE_SHADER(
+    std::string fragmentShader = DALI_COMPOSE_SHADER(#version 300 es\n
         precision highp float;\n
         uniform sampler2D sTexture;\n
-        varying vec2      vTexCoord;\n
+        in vec2      vTexCoord;\n
         \n
-        varying lowp vec4 vColor;\n
+        in lowp vec4 vColor;\n
+        out vec4     fragColor;\n
         \n
         void main()\n
         {\n
-          gl_FragColor = vColor;\n
-          gl_FragColor.a *= texture2D(sTexture, vTexCoord).a;\n
+          fragColor = vColor;\n
+          fragColor.a *= texture(sTexture, vTexCoord).a;\n
         }\n
     );
   // clang-format on
 
   std::ostringstream vertexShaderStringStream;
-  vertexShaderStringStream << "#define NUM_COLOR " << NUM_COLOR << "\n"
-                           << "#define NUM_PARTICLE " << NUM_PARTICLE << "\n"
+  vertexShaderStringStream << vertexShaderPrologue
+                           << "#define NUM_COLOR " << NUM_COLOR << "\n"
                            << "#define PARTICLE_HALF_SIZE " << PARTICLE_SIZE * ACTOR_SCALE / 2.f << "\n"
                            << "#define MAXIMUM_ANIMATION_COUNT " << MAXIMUM_ANIMATION_COUNT << "\n"
+                           << "#define STATE_PATH_0 " << STATE_PATH_0 << "\n"
+                           << "#define STATE_PATH_1 " << STATE_PATH_1 << "\n"
+                           << "#define STATE_PATH_2 " << STATE_PATH_2 << "\n"
+                           << "#define STATE_PATH_3 " << STATE_PATH_3 << "\n"
+                           << "#define STATE_APPEARANCE " << STATE_APPEARANCE << "\n"
+                           << "#define STATE_OPACITY " << STATE_OPACITY << "\n"
+                           << "#define STATE_OPACITY_TIME " << STATE_OPACITY_TIME << "\n"
                            << vertexShader;
 
   Shader handle = Shader::New(vertexShaderStringStream.str(), fragmentShader);
@@ -364,12 +361,8 @@ Shader New()
 
   // set the initial uniform values
 
-  for(unsigned int i = 0; i < NUM_PARTICLE; i++)
-  {
-    oss.str("");
-    oss << OPACITY_UNIFORM_NAME << i << "]";
-    handle.RegisterProperty(oss.str(), 1.f);
-  }
+  handle.RegisterProperty(OPACITY_TIME_UNIFORM_NAME, 0.f);
+  handle.RegisterProperty(OPACITY_EASE_UNIFORM_NAME, 0.f);
   handle.RegisterProperty(PERCENTAGE_UNIFORM_NAME, 0.f);
   handle.RegisterProperty(ACCELARATION_UNIFORM_NAME, 0.f);
   handle.RegisterProperty(BREAK_UNIFORM_NAME, 0.f);
@@ -23,6 +23,7 @@
 #include <dali/dali.h>
 
 // Internal includes
+#include "shared/launch-latency.h"
 #include "styling-application.h"
 
 int DALI_EXPORT_API main(int argc, char** argv)
@@ -45,6 +46,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
   Application application = Application::New(&argc, &argv, themeName);
   {
     Demo::StylingApplication stylingApplication(application);
+    DemoHelper::ReportLaunchLatency(application);
     application.MainLoop();
   }
   return 0;
@@ -19,6 +19,8 @@
 #include <dali-toolkit/devel-api/controls/super-blur-view/super-blur-view.h>
 #include <dali/dali.h>
 
+#include "shared/launch-latency.h"
+
 using namespace Dali;
 using Dali::Toolkit::Button;
 using Dali::Toolkit::PushButton;
@@ -114,6 +116,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 
   SuperBlurViewExample test(application);
 
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
 
   return 0;
@@ -26,6 +26,7 @@
 #include <sstream>
 
 // INTERNAL INCLUDES
+#include "shared/launch-latency.h"
 #include "shared/view.h"
 
 using namespace Dali;
@@ -298,6 +299,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
   // DALI_DEMO_THEME_PATH not passed to Application so TextEditor example uses default Toolkit style sheet.
   Application       application = Application::New(&argc, &argv);
   TextEditorExample test(application);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
   return 0;
 }
@@ -26,6 +26,7 @@
 #include <iostream>
 
 // INTERNAL INCLUDES
+#include "shared/launch-latency.h"
 #include "shared/multi-language-strings.h"
 #include "shared/view.h"
 
@@ -209,6 +210,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
   // DALI_DEMO_THEME_PATH not passed to Application so TextField example uses default Toolkit style sheet.
   Application      application = Application::New(&argc, &argv);
   TextFieldExample test(application);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
   return 0;
 }
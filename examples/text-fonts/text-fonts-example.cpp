@@ -31,6 +31,7 @@
 #include <iostream>
 
 // INTERNAL INCLUDES
+#include "shared/launch-latency.h"
 #include "shared/multi-language-strings.h"
 #include "shared/view.h"
 
@@ -249,6 +250,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application      application = Application::New(&argc, &argv, DEMO_THEME_PATH);
   TextFontsExample test(application);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
   return 0;
 }
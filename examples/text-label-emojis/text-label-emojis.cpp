@@ -22,6 +22,7 @@
 
 // INTERNAL INCLUDES
 #include "emoji-strings.h"
+#include "shared/launch-latency.h"
 
 using namespace Dali;
 using namespace Dali::Toolkit;
@@ -135,6 +136,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application  application = Application::New(&argc, &argv, DEMO_THEME_PATH);
   EmojiExample test(application);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
   return 0;
 }
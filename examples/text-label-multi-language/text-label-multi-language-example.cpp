@@ -25,6 +25,7 @@
 #include <dali-toolkit/devel-api/controls/table-view/table-view.h>
 
 // INTERNAL INCLUDES
+#include "shared/launch-latency.h"
 #include "shared/multi-language-strings.h"
 #include "shared/view.h"
 
@@ -137,6 +138,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application                   application = Application::New(&argc, &argv, DEMO_THEME_PATH);
   TextLabelMultiLanguageExample test(application);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
   return 0;
 }
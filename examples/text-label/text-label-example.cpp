@@ -30,6 +30,7 @@
 
 // INTERNAL INCLUDES
 #include "expanding-buttons.h"
+#include "shared/launch-latency.h"
 #include "shared/multi-language-strings.h"
 #include "shared/view.h"
 
@@ -780,6 +781,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application      application = Application::New(&argc, &argv, DEMO_THEME_PATH);
   TextLabelExample test(application);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
   return 0;
 }
@@ -18,14 +18,30 @@
 /**
  * @file text-memory-profiling-example.cpp
  * @brief Memory consumption profiling for TextLabel
+ *
+ * Invoked with --profile it creates batches of labels of each type without any interaction, samples the
+ * memory after each batch, prints the memory per label of each type as CSV and quits. Further options:
+ *   --labels N    The number of labels in each batch, 100 by default.
+ *   --batches N   The number of batches of each type, 5 by default.
+ *   --type N      Only profile the given type, so that it can be run in a fresh process.
+ *   --json        Print JSON rather than CSV.
+ *   --output FILE Write the results to the given file rather than stdout.
  */
 
 // EXTERNAL INCLUDES
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali-toolkit/devel-api/controls/navigation-view/navigation-view.h>
 #include <dali/dali.h>
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <vector>
 
 // INTERNAL INCLUDES
+#include "shared/launch-latency.h"
+#include "shared/memory-usage.h"
+#include "shared/pooled-item-factory.h"
 #include "shared/view.h"
 
 using namespace Dali;
@@ -61,23 +77,49 @@ std::string TEXT_TYPE_STRING[NUMBER_OF_TYPES] =
 
 const int NUMBER_OF_LABELS = 500;
 
+const unsigned int PROFILE_SETTLE_INTERVAL_MS = 500u; ///< The time for a batch of labels to be laid out & rendered.
+
 const char* BACKGROUND_IMAGE("");
 const char* TOOLBAR_IMAGE(DEMO_IMAGE_DIR "top-bar.png");
 const char* BACK_IMAGE(DEMO_IMAGE_DIR "icon-change.png");
 const char* BACK_IMAGE_SELECTED(DEMO_IMAGE_DIR "icon-change-selected.png");
 const char* INDICATOR_IMAGE(DEMO_IMAGE_DIR "loading.png");
 
+/**
+ * @brief The options of the non-interactive profiling mode.
+ */
+struct ProfileOptions
+{
+  bool        enabled{false};      ///< Whether to profile rather than show the menu.
+  int         labelsPerBatch{100}; ///< The number of labels created between samples.
+  int         batches{5};          ///< The number of batches of each type.
+  int         type{-1};            ///< The only type to profile, or -1 for all of them.
+  bool        json{false};         ///< Whether to write JSON rather than CSV.
+  std::string output;              ///< The file to write the results to, stdout if empty.
+};
+
+/**
+ * @brief The memory samples of one type of text.
+ */
+struct TypeProfile
+{
+  int                                  type;    ///< The type of text.
+  std::vector<double>                  labels;  ///< The number of labels at each sample.
+  std::vector<DemoHelper::MemoryUsage> samples; ///< The memory after each batch, the first before any labels.
+};
+
 } // anonymous namespace
 
 /**
  * @brief The main class of the demo.
  */
-class TextMemoryProfilingExample : public ConnectionTracker, public Toolkit::ItemFactory
+class TextMemoryProfilingExample : public ConnectionTracker, public DemoHelper::PooledItemFactory
 {
 public:
-  TextMemoryProfilingExample(Application& application)
+  TextMemoryProfilingExample(Application& application, const ProfileOptions& profileOptions)
   : mApplication(application),
-    mCurrentTextStyle(SINGLE_COLOR_TEXT)
+    mCurrentTextStyle(SINGLE_COLOR_TEXT),
+    mProfileOptions(profileOptions)
   {
     // Connect to the Application's Init signal
     mApplication.InitSignal().Connect(this, &TextMemoryProfilingExample::Create);
@@ -222,11 +264,11 @@ public:
   }
 
   /**
-   * @brief Create new item for the main menu
+   * @brief Create a label for the items of the main menu
    */
-  virtual Actor NewItem(unsigned int itemId)
+  Actor CreateItem(unsigned int type) override
   {
-    TextLabel label = TextLabel::New(TEXT_TYPE_STRING[itemId]);
+    TextLabel label = TextLabel::New();
     label.SetStyleName("BuilderLabel");
     label.SetResizePolicy(ResizePolicy::FILL_TO_PARENT, Dimension::WIDTH);
 
@@ -236,6 +278,14 @@ public:
     return label;
   }
 
+  /**
+   * @brief Show an item of the main menu in a new or reused label
+   */
+  void BindItem(unsigned int itemId, Actor actor) override
+  {
+    actor.SetProperty(TextLabel::Property::TEXT, TEXT_TYPE_STRING[itemId]);
+  }
+
   /**
    * @brief Create text labels for memory profiling
    */
@@ -276,6 +326,12 @@ public:
 
     window.KeyEventSignal().Connect(this, &TextMemoryProfilingExample::OnKeyEvent);
 
+    if(mProfileOptions.enabled)
+    {
+      StartProfile(window);
+      return;
+    }
+
     Layer contents = DemoHelper::CreateView(mApplication,
                                             mView,
                                             mToolBar,
@@ -397,6 +453,148 @@ public:
     }
   }
 
+  /**
+   * @brief Starts creating the batches of labels, sampling the memory before the first one.
+   */
+  void StartProfile(Window window)
+  {
+    window.SetBackgroundColor(Color::WHITE);
+
+    mLayer = Layer::New();
+    mLayer.SetResizePolicy(ResizePolicy::FILL_TO_PARENT, Dimension::ALL_DIMENSIONS);
+    window.Add(mLayer);
+
+    StartTypeProfile(mProfileOptions.type >= 0 ? mProfileOptions.type : 0);
+
+    mProfileTimer = Timer::New(PROFILE_SETTLE_INTERVAL_MS);
+    mProfileTimer.TickSignal().Connect(this, &TextMemoryProfilingExample::OnProfileTimer);
+    mProfileTimer.Start();
+  }
+
+  /**
+   * @brief Starts profiling the given type of text.
+   */
+  void StartTypeProfile(int type)
+  {
+    mProfiles.push_back(TypeProfile());
+    mProfiles.back().type = type;
+  }
+
+  /**
+   * @brief Samples the memory once the last batch has settled, then creates the next batch.
+   *
+   * After the last batch of a type, its labels are destroyed and the next type is started; the memory freed by
+   * them is not necessarily returned to the system, so the fit rather than the baseline gives the cost per label.
+   */
+  bool OnProfileTimer()
+  {
+    TypeProfile& profile = mProfiles.back();
+    profile.labels.push_back(static_cast<double>(mLayer.GetChildCount()));
+    profile.samples.push_back(DemoHelper::SampleMemoryUsage());
+
+    if(profile.samples.size() <= static_cast<size_t>(mProfileOptions.batches))
+    {
+      for(int i = 0; i < mProfileOptions.labelsPerBatch; ++i)
+      {
+        mLayer.Add(SetupTextLabel(profile.type));
+      }
+      return true;
+    }
+
+    while(mLayer.GetChildCount() > 0u)
+    {
+      mLayer.Remove(mLayer.GetChildAt(0u));
+    }
+
+    if(mProfileOptions.type < 0 && profile.type + 1 < NUMBER_OF_TYPES)
+    {
+      StartTypeProfile(profile.type + 1);
+      return true;
+    }
+
+    if(mProfileOptions.output.empty())
+    {
+      WriteProfile(std::cout);
+    }
+    else
+    {
+      std::ofstream stream(mProfileOptions.output);
+      WriteProfile(stream);
+    }
+    mApplication.Quit();
+    return false;
+  }
+
+  /**
+   * @brief Writes the memory per label of each type of text, and the samples it was fitted to, as CSV or JSON.
+   */
+  void WriteProfile(std::ostream& stream)
+  {
+    if(!mProfiles.front().samples.front().valid)
+    {
+      std::cerr << "The memory usage of the process is not available on this platform" << std::endl;
+    }
+
+    if(!mProfileOptions.json)
+    {
+      stream << "type, labels, rssKB, rssAnonKB, graphicsKB" << std::endl;
+      for(const TypeProfile& profile : mProfiles)
+      {
+        for(size_t i = 0u; i < profile.samples.size(); ++i)
+        {
+          stream << '"' << TEXT_TYPE_STRING[profile.type] << "\", " << profile.labels[i] << ", " << profile.samples[i].rss << ", "
+                 << profile.samples[i].rssAnonymous << ", " << profile.samples[i].graphics << std::endl;
+        }
+      }
+
+      stream << std::endl
+             << "type, rssPerLabelKB, rssFixedKB, graphicsPerLabelKB, graphicsFixedKB" << std::endl;
+      for(const TypeProfile& profile : mProfiles)
+      {
+        const DemoHelper::MemoryFit rss      = FitProfile(profile, &DemoHelper::MemoryUsage::rss);
+        const DemoHelper::MemoryFit graphics = FitProfile(profile, &DemoHelper::MemoryUsage::graphics);
+        stream << '"' << TEXT_TYPE_STRING[profile.type] << "\", " << rss.perItem << ", " << rss.fixed << ", "
+               << graphics.perItem << ", " << graphics.fixed << std::endl;
+      }
+      return;
+    }
+
+    stream << "{ \"labelsPerBatch\": " << mProfileOptions.labelsPerBatch << ", \"types\": [";
+    for(size_t t = 0u; t < mProfiles.size(); ++t)
+    {
+      const TypeProfile&          profile  = mProfiles[t];
+      const DemoHelper::MemoryFit rss      = FitProfile(profile, &DemoHelper::MemoryUsage::rss);
+      const DemoHelper::MemoryFit graphics = FitProfile(profile, &DemoHelper::MemoryUsage::graphics);
+
+      stream << (t ? "," : "") << std::endl
+             << "  { \"type\": \"" << TEXT_TYPE_STRING[profile.type] << "\""
+             << ", \"rssPerLabelKB\": " << rss.perItem << ", \"rssFixedKB\": " << rss.fixed
+             << ", \"graphicsPerLabelKB\": " << graphics.perItem << ", \"graphicsFixedKB\": " << graphics.fixed
+             << ", \"samples\": [";
+      for(size_t i = 0u; i < profile.samples.size(); ++i)
+      {
+        stream << (i ? ", " : "") << "{ \"labels\": " << profile.labels[i] << ", \"rssKB\": " << profile.samples[i].rss
+               << ", \"rssAnonKB\": " << profile.samples[i].rssAnonymous << ", \"graphicsKB\": " << profile.samples[i].graphics << " }";
+      }
+      stream << "] }";
+    }
+    stream << std::endl
+           << "] }" << std::endl;
+  }
+
+  /**
+   * @brief Fits one of the memory values of the given type's samples against the number of labels.
+   */
+  static DemoHelper::MemoryFit FitProfile(const TypeProfile& profile, uint64_t DemoHelper::MemoryUsage::*value)
+  {
+    std::vector<double> samples;
+    for(const DemoHelper::MemoryUsage& sample : profile.samples)
+    {
+      samples.push_back(static_cast<double>(sample.*value));
+    }
+    return DemoHelper::FitMemoryUsage(profile.labels, samples);
+  }
+
 private:
   Application& mApplication;
 
@@ -415,12 +613,46 @@ private:
   TapGestureDetector mTapDetector;
 
   unsigned int mCurrentTextStyle;
+
+  ProfileOptions           mProfileOptions; ///< The options of the non-interactive profiling mode.
+  std::vector<TypeProfile> mProfiles;       ///< The samples of each type profiled so far.
+  Timer                    mProfileTimer;   ///< Waits for each batch of labels to settle.
 };
 
 int DALI_EXPORT_API main(int argc, char** argv)
 {
+  ProfileOptions profileOptions;
+  for(int i = 1; i < argc; ++i)
+  {
+    if(strcmp(argv[i], "--profile") == 0)
+    {
+      profileOptions.enabled = true;
+    }
+    else if(strcmp(argv[i], "--json") == 0)
+    {
+      profileOptions.json = true;
+    }
+    else if(strcmp(argv[i], "--labels") == 0 && i + 1 < argc)
+    {
+      profileOptions.labelsPerBatch = std::max(1, atoi(argv[++i]));
+    }
+    else if(strcmp(argv[i], "--batches") == 0 && i + 1 < argc)
+    {
+      profileOptions.batches = std::max(1, atoi(argv[++i]));
+    }
+    else if(strcmp(argv[i], "--type") == 0 && i + 1 < argc)
+    {
+      profileOptions.type = std::min(std::max(0, atoi(argv[++i])), NUMBER_OF_TYPES - 1);
+    }
+    else if(strcmp(argv[i], "--output") == 0 && i + 1 < argc)
+    {
+      profileOptions.output = argv[++i];
+    }
+  }
+
   Application                application = Application::New(&argc, &argv, DEMO_THEME_PATH);
-  TextMemoryProfilingExample test(application);
+  TextMemoryProfilingExample test(application, profileOptions);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
   return 0;
 }
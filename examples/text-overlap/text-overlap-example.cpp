@@ -21,6 +21,8 @@
 
 #include <iostream>
 
+#include "shared/launch-latency.h"
+
 using namespace Dali;
 using namespace Dali::Toolkit;
 
@@ -156,6 +158,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
   {
     Application                 app = Application::New(&argc, &argv);
     Demo::TextOverlapController controller(app);
+    DemoHelper::ReportLaunchLatency(app);
     app.MainLoop();
   }
   exit(0);
@@ -18,6 +18,8 @@
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali/devel-api/adaptor-framework/tilt-sensor.h>
 
+#include "shared/launch-latency.h"
+
 using namespace Dali;
 using Dali::Toolkit::TextLabel;
 
@@ -118,6 +120,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
   Application    application = Application::New(&argc, &argv);
   TiltController test(application);
 
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
   return 0;
 }
@@ -18,6 +18,7 @@
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali/integration-api/debug.h>
 #include "dali-toolkit/devel-api/controls/web-view/web-view.h"
+#include "shared/launch-latency.h"
 
 using namespace Dali;
 
@@ -132,6 +133,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application       application = Application::New(&argc, &argv);
   WebViewController test(application);
+  DemoHelper::ReportLaunchLatency(application);
   application.MainLoop();
   return 0;
 }
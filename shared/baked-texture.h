@@ -0,0 +1,282 @@
+#ifndef DALI_DEMO_BAKED_TEXTURE_H
+#define DALI_DEMO_BAKED_TEXTURE_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/image-loading.h>
+#include <dali/devel-api/adaptor-framework/pixel-buffer.h>
+#include <dali/integration-api/debug.h>
+#include <dali/public-api/images/pixel-data.h>
+#include <dali/public-api/rendering/sampler.h>
+#include <dali/public-api/rendering/texture.h>
+#include <sys/stat.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include "shared/memory-mapped-file.h"
+
+namespace DemoHelper
+{
+const uint8_t  BAKED_KTX_IDENTIFIER[12] = {0xAB, 'K', 'T', 'X', ' ', '1', '1', 0xBB, '\r', '\n', 0x1A, '\n'};
+const uint32_t BAKED_KTX_ENDIANNESS(0x04030201);
+const uint32_t BAKED_FORMAT_RGB8_ETC2(0x9274);      ///< GL_COMPRESSED_RGB8_ETC2
+const uint32_t BAKED_FORMAT_RGBA8_ETC2_EAC(0x9278); ///< GL_COMPRESSED_RGBA8_ETC2_EAC
+
+/**
+ * @brief The header of the KTX (version 1) files written by the texture-baker tool.
+ */
+struct BakedKtxHeader
+{
+  char     identifier[12];
+  uint32_t endianness;
+  uint32_t glType;
+  uint32_t glTypeSize;
+  uint32_t glFormat;
+  uint32_t glInternalFormat;
+  uint32_t glBaseInternalFormat;
+  uint32_t pixelWidth;
+  uint32_t pixelHeight;
+  uint32_t pixelDepth;
+  uint32_t numberOfArrayElements;
+  uint32_t numberOfFaces;
+  uint32_t numberOfMipmapLevels;
+  uint32_t bytesOfKeyValueData;
+};
+
+/**
+ * @brief Retrieves the path of the baked version of an image, e.g. "images/baked/wood.ktx" for "images/wood.png".
+ *
+ * Baked images are ETC2 compressed and include their mipmaps, so they are uploaded as they are instead of
+ * being decoded. Setting DALI_DEMO_BAKED_IMAGES=0 ignores them, e.g. to compare the startup time & memory.
+ *
+ * @param[in] url The path of the image.
+ * @return The path of the baked image, or an empty string if there is none.
+ */
+inline std::string GetBakedImagePath(const std::string& url)
+{
+  const char* enabled = getenv("DALI_DEMO_BAKED_IMAGES");
+  if(enabled && strcmp(enabled, "0") == 0)
+  {
+    return std::string();
+  }
+
+  const size_t nameStart = url.find_last_of("/\\") + 1u;
+  const size_t extension = url.find_last_of('.');
+  if(extension == std::string::npos || extension < nameStart)
+  {
+    return std::string();
+  }
+
+  const std::string bakedPath = url.substr(0u, nameStart) + "baked/" + url.substr(nameStart, extension - nameStart) + ".ktx";
+  struct stat       fileStatus;
+  return stat(bakedPath.c_str(), &fileStatus) == 0 ? bakedPath : std::string();
+}
+
+/**
+ * @brief Reads a baked image, passing each mipmap level in turn, largest first, to @p upload.
+ *
+ * @param[in] path The path of the baked KTX file.
+ * @param[in] upload Called as upload(Dali::PixelData pixels, uint32_t level, size_t size) for each level.
+ * @return The number of levels read, 0 if the file is not a baked image or is truncated, in which case some
+ * levels may have been passed to @p upload already.
+ */
+template<typename UploadFunction>
+uint32_t ForEachBakedMipmap(const std::string& path, UploadFunction upload)
+{
+  MemoryMappedFile file(path);
+  BakedKtxHeader   header;
+  if(!file || file.GetSize() < sizeof(header))
+  {
+    return 0u;
+  }
+  memcpy(&header, file.GetData(), sizeof(header));
+
+  Dali::Pixel::Format format;
+  if(memcmp(header.identifier, BAKED_KTX_IDENTIFIER, sizeof(BAKED_KTX_IDENTIFIER)) != 0 ||
+     header.endianness != BAKED_KTX_ENDIANNESS ||
+     header.numberOfFaces != 1u)
+  {
+    return 0u;
+  }
+  else if(header.glInternalFormat == BAKED_FORMAT_RGB8_ETC2)
+  {
+    format = Dali::Pixel::COMPRESSED_RGB8_ETC2;
+  }
+  else if(header.glInternalFormat == BAKED_FORMAT_RGBA8_ETC2_EAC)
+  {
+    format = Dali::Pixel::COMPRESSED_RGBA8_ETC2_EAC;
+  }
+  else
+  {
+    return 0u;
+  }
+
+  uint32_t width  = header.pixelWidth;
+  uint32_t height = header.pixelHeight;
+  size_t   offset = sizeof(header) + header.bytesOfKeyValueData;
+  for(uint32_t level = 0u; level < header.numberOfMipmapLevels; ++level)
+  {
+    uint32_t imageSize;
+    if(offset + sizeof(imageSize) > file.GetSize())
+    {
+      return 0u;
+    }
+    memcpy(&imageSize, file.GetData() + offset, sizeof(imageSize));
+    offset += sizeof(imageSize);
+    if(offset + imageSize > file.GetSize())
+    {
+      return 0u;
+    }
+
+    // PixelData has to own its buffer, so each level is copied out of the mapping right before it is uploaded.
+    uint8_t* buffer = static_cast<uint8_t*>(malloc(imageSize));
+    memcpy(buffer, file.GetData() + offset, imageSize);
+    upload(Dali::PixelData::New(buffer, imageSize, width, height, format, Dali::PixelData::FREE), level, size_t(imageSize));
+
+    offset = (offset + imageSize + 3u) & ~size_t(3u);
+    width  = std::max(width / 2u, 1u);
+    height = std::max(height / 2u, 1u);
+  }
+  return header.numberOfMipmapLevels;
+}
+
+/**
+ * @brief Loads images into the layers of a texture, e.g. the faces of a cube map, from their baked versions
+ * if every image has one.
+ *
+ * How long it took and how much texture memory it needs are logged, to compare the two.
+ *
+ * @param[in] urls The paths of the images, one per layer.
+ * @param[in] type The type of the texture.
+ * @param[out] mipmapLevels If not null, set to the number of mipmap levels of the texture: its full mipmap chain
+ * when baked, 1 when decoded. Pass it to NewTextureSampler() so the mipmaps are sampled.
+ * @return The texture, empty if an image could not be loaded.
+ */
+inline Dali::Texture LoadTextureLayers(const std::vector<std::string>& urls, Dali::TextureType::Type type, uint32_t* mipmapLevels = nullptr)
+{
+  const auto    start = std::chrono::steady_clock::now();
+  Dali::Texture texture;
+  size_t        textureSize = 0u;
+  uint32_t      levels      = 1u;
+
+  // The layers must share a format, so either every image is baked or none is.
+  std::vector<std::string> bakedPaths;
+  for(const std::string& url : urls)
+  {
+    bakedPaths.push_back(GetBakedImagePath(url));
+    if(bakedPaths.back().empty())
+    {
+      bakedPaths.clear();
+      break;
+    }
+  }
+
+  bool                baked = !bakedPaths.empty();
+  Dali::Pixel::Format format;
+  for(uint32_t layer = 0u; baked && layer < bakedPaths.size(); ++layer)
+  {
+    bool sameFormat = true;
+    levels          = ForEachBakedMipmap(bakedPaths[layer], [&](Dali::PixelData pixels, uint32_t level, size_t size) {
+      if(!texture)
+      {
+        format  = pixels.GetPixelFormat();
+        texture = Dali::Texture::New(type, format, pixels.GetWidth(), pixels.GetHeight());
+      }
+      else if(pixels.GetPixelFormat() != format)
+      {
+        sameFormat = false; // e.g. only some of the images have an alpha channel
+        return;
+      }
+      texture.Upload(pixels, layer, level, 0u, 0u, pixels.GetWidth(), pixels.GetHeight());
+      textureSize += size;
+    });
+    baked = levels > 0u && sameFormat;
+
+    if(!baked)
+    {
+      DALI_LOG_ERROR("Unable to load the baked image %s\n", bakedPaths[layer].c_str());
+      texture.Reset();
+      textureSize = 0u;
+      levels      = 1u;
+    }
+  }
+
+  for(uint32_t layer = 0u; !baked && layer < urls.size(); ++layer)
+  {
+    Dali::Devel::PixelBuffer pixelBuffer = Dali::LoadImageFromFile(urls[layer]);
+    if(!pixelBuffer)
+    {
+      return Dali::Texture();
+    }
+
+    Dali::PixelData pixels = Dali::Devel::PixelBuffer::Convert(pixelBuffer);
+    if(!texture)
+    {
+      texture = Dali::Texture::New(type, pixels.GetPixelFormat(), pixels.GetWidth(), pixels.GetHeight());
+    }
+    texture.Upload(pixels, layer, 0u, 0u, 0u, pixels.GetWidth(), pixels.GetHeight());
+    textureSize += size_t(pixels.GetWidth()) * pixels.GetHeight() * Dali::Pixel::GetBytesPerPixel(pixels.GetPixelFormat());
+  }
+
+  DALI_LOG_RELEASE_INFO("%s%s: %s in %.1f ms, %zu bytes of texture memory\n",
+                        urls.front().c_str(),
+                        urls.size() > 1u ? " etc." : "",
+                        baked ? "baked" : "decoded",
+                        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count(),
+                        textureSize);
+  if(mipmapLevels)
+  {
+    *mipmapLevels = levels;
+  }
+  return texture;
+}
+
+/**
+ * @brief Loads an image into a 2D texture, from its baked version if there is one.
+ * @see LoadTextureLayers()
+ */
+inline Dali::Texture LoadBakedTexture(const std::string& url, uint32_t* mipmapLevels = nullptr)
+{
+  return LoadTextureLayers({url}, Dali::TextureType::TEXTURE_2D, mipmapLevels);
+}
+
+/**
+ * @brief Creates a sampler for a texture loaded by LoadTextureLayers(), which minifies from its mipmaps if it has any.
+ *
+ * The default sampler minifies linearly from the top level only, so the mipmaps of a baked texture would be unused.
+ *
+ * @param[in] mipmapLevels The number of mipmap levels LoadTextureLayers() reported.
+ * @return The sampler to set with the texture.
+ */
+inline Dali::Sampler NewTextureSampler(uint32_t mipmapLevels)
+{
+  Dali::Sampler sampler = Dali::Sampler::New();
+  sampler.SetFilterMode(mipmapLevels > 1u ? Dali::FilterMode::LINEAR_MIPMAP_LINEAR : Dali::FilterMode::LINEAR, Dali::FilterMode::LINEAR);
+  return sampler;
+}
+
+} // namespace DemoHelper
+
+#endif // DALI_DEMO_BAKED_TEXTURE_H
@@ -0,0 +1,168 @@
+#ifndef DALI_DEMO_CACHE_DIRECTORY_H
+#define DALI_DEMO_CACHE_DIRECTORY_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <sys/stat.h>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#ifdef _WIN32
+#include <direct.h>
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace DemoHelper
+{
+/**
+ * @brief Creates the given directory and any missing parents.
+ * @return Whether the directory exists afterwards.
+ */
+inline bool CreateDirectories(const std::string& directory)
+{
+  for(size_t position = directory.find('/', 1); ; position = directory.find('/', position + 1))
+  {
+    const std::string parent = directory.substr(0, position);
+#ifdef _WIN32
+    _mkdir(parent.c_str());
+#else
+    mkdir(parent.c_str(), 0755); // Fails harmlessly if it already exists.
+#endif
+    if(position == std::string::npos)
+    {
+      break;
+    }
+  }
+
+  struct stat status;
+  return stat(directory.c_str(), &status) == 0 && (status.st_mode & S_IFDIR);
+}
+
+/**
+ * @brief Retrieves (and creates) a directory the demos can cache generated data in.
+ *
+ * The DALI_DEMO_CACHE_DIR environment variable is used if set, otherwise "dali-demo" in the user's
+ * cache directory ($XDG_CACHE_HOME or $HOME/.cache).
+ *
+ * @param[in]  subDirectory  The directory within the cache, usually the name of the example.
+ * @return The directory, including a trailing '/', or an empty string if caching is not possible.
+ */
+inline std::string GetCacheDirectory(const std::string& subDirectory)
+{
+  std::string directory;
+  if(const char* cacheDir = getenv("DALI_DEMO_CACHE_DIR"))
+  {
+    directory = cacheDir;
+  }
+  else if(const char* xdgCacheHome = getenv("XDG_CACHE_HOME"))
+  {
+    directory = std::string(xdgCacheHome) + "/dali-demo";
+  }
+  else if(const char* home = getenv("HOME"))
+  {
+    directory = std::string(home) + "/.cache/dali-demo";
+  }
+  else
+  {
+    return std::string();
+  }
+
+  directory += "/" + subDirectory;
+  return CreateDirectories(directory) ? directory + "/" : std::string();
+}
+
+/**
+ * @brief Retrieves the size and modification time of a file, used to tell whether cached data is stale.
+ *
+ * The time is in nanoseconds where the platform records them, so a file rewritten within the same second
+ * is still seen as modified.
+ *
+ * @return Whether the file exists.
+ */
+inline bool GetFileSizeAndTime(const std::string& path, uint64_t& size, int64_t& modificationTime)
+{
+  struct stat status;
+  if(stat(path.c_str(), &status) != 0)
+  {
+    return false;
+  }
+
+  size = static_cast<uint64_t>(status.st_size);
+#if defined(__linux__)
+  modificationTime = static_cast<int64_t>(status.st_mtim.tv_sec) * 1000000000 + status.st_mtim.tv_nsec;
+#elif defined(__APPLE__)
+  modificationTime = static_cast<int64_t>(status.st_mtimespec.tv_sec) * 1000000000 + status.st_mtimespec.tv_nsec;
+#else
+  modificationTime = static_cast<int64_t>(status.st_mtime) * 1000000000;
+#endif
+  return true;
+}
+
+/**
+ * @brief Writes a file via a temporary file, so readers never see a partially written file.
+ *
+ * The temporary file gets a unique name in the same directory, so processes writing the same file at
+ * once do not write into each other's temporary file, and the last one to finish wins.
+ *
+ * @param[in]  path     The path of the file.
+ * @param[in]  writer   Called with the open temporary file, returns whether everything was written.
+ * @return Whether the file was written.
+ */
+template<typename Writer>
+bool WriteFileAtomically(const std::string& path, Writer writer)
+{
+  std::string temporaryPath = path + ".XXXXXX";
+
+#ifdef _WIN32
+  FILE* file = _mktemp_s(&temporaryPath[0], temporaryPath.size() + 1) == 0 ? fopen(temporaryPath.c_str(), "wb") : nullptr;
+#else
+  const int descriptor = mkstemp(&temporaryPath[0]);
+  FILE*     file       = descriptor >= 0 ? fdopen(descriptor, "wb") : nullptr;
+  if(descriptor >= 0 && !file)
+  {
+    close(descriptor);
+    remove(temporaryPath.c_str());
+  }
+#endif
+  if(!file)
+  {
+    return false;
+  }
+
+  bool written = writer(file);
+  written      = (fclose(file) == 0) && written;
+
+#ifdef _WIN32
+  remove(path.c_str()); // rename() does not replace an existing file on Windows.
+#endif
+  if(!written || rename(temporaryPath.c_str(), path.c_str()) != 0)
+  {
+    remove(temporaryPath.c_str());
+    return false;
+  }
+  return true;
+}
+
+} // namespace DemoHelper
+
+#endif // DALI_DEMO_CACHE_DIRECTORY_H
@@ -26,8 +26,13 @@
 #include <dali-toolkit/devel-api/shader-effects/distance-field-effect.h>
 #include <dali-toolkit/devel-api/visual-factory/visual-factory.h>
 #include <dali/devel-api/actors/actor-devel.h>
+#include <dali/devel-api/adaptor-framework/application-devel.h>
+#include <dali/devel-api/common/stage-devel.h>
 #include <dali/devel-api/images/distance-field.h>
 #include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
 
 // INTERNAL INCLUDES
 #include "shared/execute-process.h"
@@ -68,6 +73,13 @@ const Vector3 SCROLLVIEW_RELATIVE_SIZE(0.9f, 1.0f, 0.8f); ///< ScrollView's rela
 const Vector3 TABLE_RELATIVE_SIZE(0.95f, 0.9f, 0.8f);     ///< TableView's relative size to the entire stage. The Y value means sum of the logo and table relative heights.
 const float   STENCIL_RELATIVE_SIZE = 1.0f;
 
+const int          REALISED_PAGE_RADIUS      = 1;                       ///< How many pages either side of the current one have their tiles realised
+const unsigned int FIRST_FRAME_POLL_INTERVAL = 16u;                     ///< How often to check whether the first frame has been updated, in milliseconds
+const float        TILE_MARGIN               = 2.0f;                    ///< Padding around each tile
+const float        TILE_PARENT_MULTIPLIER    = 1.0f / EXAMPLES_PER_ROW; ///< Size of a tile relative to its page
+
+const std::chrono::milliseconds IDLE_POPULATE_BUDGET(4); ///< Time spent realising tiles in each idle callback
+
 const float   EFFECT_SNAP_DURATION  = 0.66f; ///< Scroll Snap Duration for Effects
 const float   EFFECT_FLICK_DURATION = 0.5f;  ///< Scroll Flick Duration for Effects
 const Vector3 ANGLE_CUBE_PAGE_ROTATE(Math::PI * 0.5f, Math::PI * 0.5f, 0.0f);
@@ -94,8 +106,72 @@ const unsigned int BACKGROUND_ANIMATION_DURATION = 15000; // 15 secs
 const float BUBBLE_MIN_Z = -1.0;
 const float BUBBLE_MAX_Z = 0.0f;
 
+const float BUBBLE_TIME_ANIMATION_DURATION = 1000.0f; ///< Period of the instanced bubbles' time animation, in seconds
+
+const char* const SHAPE_ATLAS_CACHE_NAME = "launcher-shapes"; ///< The name the packed shapes are cached under
+
 const char* const DEMO_BUILD_DATE = __DATE__ " " __TIME__;
 
+// clang-format off
+
+/**
+ * Draws every bubble from one vertex buffer: each quad carries its bubble's attributes, so the
+ * parallax & vertical wrapping of AnimateBubbleConstraint and the rising animation happen here.
+ */
+const char* const BUBBLE_VERTEX_SHADER = DALI_COMPOSE_SHADER(
+  attribute mediump vec2  aCorner;\n
+  attribute mediump vec2  aTexCoord;\n
+  attribute highp   vec3  aPosition;\n // x & y relative to the layer size
+  attribute mediump float aSize;\n
+  attribute mediump float aSpeed;\n    // pixels per second
+  attribute mediump float aParallax;\n
+  attribute lowp    vec4  aColor;\n
+  uniform   highp   mat4  uMvpMatrix;\n
+  uniform   highp   vec3  uSize;\n
+  uniform   highp   vec2  uScrollPosition;\n
+  uniform   highp   float uTime;\n
+  varying   mediump vec2  vTexCoord;\n
+  varying   lowp    vec4  vColor;\n
+  \n
+  void main()\n
+  {\n
+    highp vec2 position = aPosition.xy * uSize.xy;\n
+    \n
+    // Bubbles X position moves parallax to horizontal panning by a scale factor unique to each bubble.
+    position.x += uScrollPosition.x * aParallax;\n
+    \n
+    // Rise, wrapping vertically (the arithmetic modulus, as opposed to the remainder).
+    highp float range = uSize.y + aSize;\n
+    position.y = mod(position.y - aSpeed * uTime, range) - 0.5 * range;\n
+    \n
+    gl_Position = uMvpMatrix * vec4(position + aCorner * aSize, aPosition.z, 1.0);\n
+    vTexCoord   = aTexCoord;\n
+    vColor      = aColor;\n
+  }\n
+);
+
+/**
+ * The distance field effect without outline, glow or shadow, taking the color from the bubble.
+ */
+const char* const BUBBLE_FRAGMENT_SHADER =
+  "#extension GL_OES_standard_derivatives : enable\n"
+  DALI_COMPOSE_SHADER(
+  varying mediump vec2      vTexCoord;\n
+  varying lowp    vec4      vColor;\n
+  uniform         sampler2D sTexture;\n
+  uniform lowp    vec4      uColor;\n
+  \n
+  void main()\n
+  {\n
+    mediump float distance    = texture2D(sTexture, vTexCoord).a;\n
+    mediump float smoothWidth = fwidth(distance);\n
+    mediump float alphaFactor = smoothstep(0.5 - smoothWidth, 0.5 + smoothWidth, distance);\n
+    gl_FragColor = vec4(vColor.rgb, vColor.a * alphaFactor) * uColor;\n
+  }\n
+);
+
+// clang-format on
+
 /**
  * Creates the background image
  */
@@ -177,6 +253,30 @@ private:
   float mTileXOffset;
 };
 
+/**
+ * The vertex format of the instanced bubbles: every corner of a quad holds its bubble's attributes.
+ */
+struct BubbleVertex
+{
+  Vector2 corner;   ///< The corner of the quad, from -0.5 to 0.5
+  Vector2 texCoord; ///< The corner's texture coordinate within the shape atlas
+  Vector3 position; ///< The initial position of the bubble, x & y relative to the layer size
+  float   size;     ///< The width & height of the bubble
+  float   speed;    ///< The rising speed of the bubble in pixels per second
+  float   parallax; ///< The parallax factor applied to the scroll position
+  Vector4 color;    ///< The color of the bubble
+};
+
+/**
+ * Retrieves the color a style (e.g. one of BUBBLE_COLOR_STYLE_NAME) gives to a control.
+ */
+Vector4 GetStyleColor(const char* styleName)
+{
+  Control control = Control::New();
+  control.SetStyleName(styleName);
+  return control.GetProperty<Vector4>(Actor::Property::COLOR);
+}
+
 bool CompareByTitle(const Example& lhs, const Example& rhs)
 {
   return lhs.title < rhs.title;
@@ -184,7 +284,36 @@ bool CompareByTitle(const Example& lhs, const Example& rhs)
 
 } // namespace
 
-DaliTableView::DaliTableView(Application& application)
+LauncherOptions LauncherOptions::FromCommandLine(int argc, char** argv)
+{
+  LauncherOptions options;
+  for(int i = 1; i < argc; ++i)
+  {
+    if(strcmp(argv[i], "--eager-population") == 0)
+    {
+      options.lazyPopulation = false;
+    }
+    else if(strcmp(argv[i], "--report-first-frame") == 0)
+    {
+      options.reportFirstFrame = true;
+    }
+    else if(strcmp(argv[i], "--example-list-scale") == 0 && i + 1 < argc)
+    {
+      options.exampleListScale = std::max(1, atoi(argv[++i]));
+    }
+    else if(strcmp(argv[i], "--zygote") == 0)
+    {
+      options.zygote = true;
+    }
+    else if(strcmp(argv[i], "--report-launch-latency") == 0)
+    {
+      options.reportLaunchLatency = true;
+    }
+  }
+  return options;
+}
+
+DaliTableView::DaliTableView(Application& application, const LauncherOptions& options)
 : mApplication(application),
   mRootActor(),
   mRotateAnimation(),
@@ -198,13 +327,19 @@ DaliTableView::DaliTableView(Application& application)
   mLogoTapDetector(),
   mVersionPopup(),
   mPages(),
+  mRealisedTileCounts(),
+  mPendingPages(),
+  mTilePools(EXAMPLES_PER_ROW),
   mBackgroundAnimations(),
   mExampleList(),
   mPageWidth(0.0f),
   mTotalPages(),
   mScrolling(false),
   mSortAlphabetically(false),
-  mBackgroundAnimsPlaying(false)
+  mBackgroundAnimsPlaying(false),
+  mInstancedBackground(true),
+  mIdlePopulating(false),
+  mOptions(options)
 {
   application.InitSignal().Connect(this, &DaliTableView::Initialize);
 }
@@ -223,6 +358,11 @@ void DaliTableView::SortAlphabetically(bool sortAlphabetically)
   mSortAlphabetically = sortAlphabetically;
 }
 
+void DaliTableView::SetInstancedBackground(bool instanced)
+{
+  mInstancedBackground = instanced;
+}
+
 void DaliTableView::Initialize(Application& application)
 {
   Window window = application.GetWindow();
@@ -280,7 +420,9 @@ void DaliTableView::Initialize(Application& application)
   ApplyScrollViewEffect();
 
   // Add pages and tiles
+  const LauncherOptions::Clock::time_point populateStart = LauncherOptions::Clock::now();
   Populate();
+  mPopulateDuration = LauncherOptions::Clock::now() - populateStart;
 
   // Remove constraints for inner cube effect
   ApplyCubeEffectToPages();
@@ -313,6 +455,17 @@ void DaliTableView::Initialize(Application& application)
   mBackgroundAnimsPlaying = true;
 
   CreateFocusEffect();
+
+  // The first update from now on renders the launcher.
+  if(mOptions.reportFirstFrame)
+  {
+    mFirstFrameRecorder.reset(new DemoHelper::FirstFrameRecorder());
+    DevelStage::AddFrameCallback(Stage::GetCurrent(), *mFirstFrameRecorder, window.GetRootLayer());
+
+    mFirstFrameTimer = Timer::New(FIRST_FRAME_POLL_INTERVAL);
+    mFirstFrameTimer.TickSignal().Connect(this, &DaliTableView::OnFirstFrameTimer);
+    mFirstFrameTimer.Start();
+  }
 }
 
 void DaliTableView::CreateFocusEffect()
@@ -397,6 +550,17 @@ void DaliTableView::Populate()
 {
   const Window::WindowSize windowSize = mApplication.GetWindow().GetSize();
 
+  // Repeat the list to see how the launcher copes with many more examples.
+  if(mOptions.exampleListScale > 1)
+  {
+    const ExampleList examples(mExampleList);
+    mExampleList.reserve(examples.size() * mOptions.exampleListScale);
+    for(int copy = 1; copy < mOptions.exampleListScale; ++copy)
+    {
+      mExampleList.insert(mExampleList.end(), examples.begin(), examples.end());
+    }
+  }
+
   mTotalPages = (mExampleList.size() + EXAMPLES_PER_PAGE - 1) / EXAMPLES_PER_PAGE;
 
   // Populate ScrollView.
@@ -407,9 +571,7 @@ void DaliTableView::Populate()
       sort(mExampleList.begin(), mExampleList.end(), CompareByTitle);
     }
 
-    unsigned int         exampleCount = 0;
-    ExampleListConstIter iter         = mExampleList.begin();
-
+    // The pages are all created up front for the scroll-view effect, but their tiles are only realised when needed.
     for(int t = 0; t < mTotalPages; t++)
     {
       // Create Table
@@ -419,47 +581,19 @@ void DaliTableView::Populate()
       page.SetResizePolicy(ResizePolicy::FILL_TO_PARENT, Dimension::ALL_DIMENSIONS);
       mScrollView.Add(page);
 
-      // Calculate the number of images going across (columns) within a page, according to the screen resolution and dpi.
-      const float margin               = 2.0f;
-      const float tileParentMultiplier = 1.0f / EXAMPLES_PER_ROW;
-
-      for(int row = 0; row < ROWS_PER_PAGE; row++)
-      {
-        for(int column = 0; column < EXAMPLES_PER_ROW; column++)
-        {
-          const Example& example = (*iter);
-
-          // Calculate the tiles relative position on the page (between 0 & 1 in each dimension).
-          Vector2              position(static_cast<float>(column) / (EXAMPLES_PER_ROW - 1.0f), static_cast<float>(row) / (EXAMPLES_PER_ROW - 1.0f));
-          Actor                tile                 = CreateTile(example.name, example.title, Vector3(tileParentMultiplier, tileParentMultiplier, 1.0f), position);
-          AccessibilityManager accessibilityManager = AccessibilityManager::Get();
-          accessibilityManager.SetFocusOrder(tile, ++exampleCount);
-          accessibilityManager.SetAccessibilityAttribute(tile, Dali::Toolkit::AccessibilityManager::ACCESSIBILITY_LABEL, example.title);
-          accessibilityManager.SetAccessibilityAttribute(tile, Dali::Toolkit::AccessibilityManager::ACCESSIBILITY_TRAIT, "Tile");
-          accessibilityManager.SetAccessibilityAttribute(tile, Dali::Toolkit::AccessibilityManager::ACCESSIBILITY_HINT, "You can run this example");
-
-          tile.SetProperty(Actor::Property::PADDING, Padding(margin, margin, margin, margin));
-          page.AddChild(tile, TableView::CellPosition(row, column));
-
-          iter++;
-
-          if(iter == mExampleList.end())
-          {
-            break;
-          }
-        }
-
-        if(iter == mExampleList.end())
-        {
-          break;
-        }
-      }
-
       mPages.push_back(page);
+    }
+    mRealisedTileCounts.assign(mTotalPages, 0u);
 
-      if(iter == mExampleList.end())
+    if(mOptions.lazyPopulation)
+    {
+      UpdateRealisedPages(0);
+    }
+    else
+    {
+      for(int t = 0; t < mTotalPages; t++)
       {
-        break;
+        RealisePage(t);
       }
     }
   }
@@ -473,6 +607,149 @@ void DaliTableView::Populate()
   mScrollView.SetRulerY(mScrollRulerY);
 }
 
+bool DaliTableView::RealiseTile(int pageIndex)
+{
+  const unsigned int tileIndex    = mRealisedTileCounts[pageIndex];
+  const size_t       exampleIndex = pageIndex * EXAMPLES_PER_PAGE + tileIndex;
+  if(tileIndex >= static_cast<unsigned int>(EXAMPLES_PER_PAGE) || exampleIndex >= mExampleList.size())
+  {
+    return false;
+  }
+
+  const Example& example = mExampleList[exampleIndex];
+  const int      row     = tileIndex / EXAMPLES_PER_ROW;
+  const int      column  = tileIndex % EXAMPLES_PER_ROW;
+
+  // Tiles are pooled by column, as their shader constraint depends on it.
+  Actor               tile;
+  std::vector<Actor>& pool = mTilePools[column];
+  if(!pool.empty())
+  {
+    tile = pool.back();
+    pool.pop_back();
+    tile.SetProperty(Actor::Property::NAME, example.name);
+    tile.GetChildAt(1).SetProperty(TextLabel::Property::TEXT, example.title);
+  }
+  else
+  {
+    // Calculate the tiles relative position on the page (between 0 & 1 in each dimension).
+    Vector2 position(static_cast<float>(column) / (EXAMPLES_PER_ROW - 1.0f), static_cast<float>(row) / (EXAMPLES_PER_ROW - 1.0f));
+    tile = CreateTile(example.name, example.title, Vector3(TILE_PARENT_MULTIPLIER, TILE_PARENT_MULTIPLIER, 1.0f), position);
+    tile.SetProperty(Actor::Property::PADDING, Padding(TILE_MARGIN, TILE_MARGIN, TILE_MARGIN, TILE_MARGIN));
+  }
+
+  AccessibilityManager accessibilityManager = AccessibilityManager::Get();
+  accessibilityManager.SetFocusOrder(tile, exampleIndex + 1);
+  accessibilityManager.SetAccessibilityAttribute(tile, Dali::Toolkit::AccessibilityManager::ACCESSIBILITY_LABEL, example.title);
+  accessibilityManager.SetAccessibilityAttribute(tile, Dali::Toolkit::AccessibilityManager::ACCESSIBILITY_TRAIT, "Tile");
+  accessibilityManager.SetAccessibilityAttribute(tile, Dali::Toolkit::AccessibilityManager::ACCESSIBILITY_HINT, "You can run this example");
+
+  TableView::DownCast(mPages[pageIndex]).AddChild(tile, TableView::CellPosition(row, column));
+  ++mRealisedTileCounts[pageIndex];
+  return true;
+}
+
+void DaliTableView::RealisePage(int pageIndex)
+{
+  while(RealiseTile(pageIndex))
+  {
+  }
+}
+
+void DaliTableView::RecyclePage(int pageIndex)
+{
+  TableView page = TableView::DownCast(mPages[pageIndex]);
+  for(unsigned int tileIndex = mRealisedTileCounts[pageIndex]; tileIndex-- > 0u;)
+  {
+    const int column = tileIndex % EXAMPLES_PER_ROW;
+    Actor     tile   = page.RemoveChildAt(TableView::CellPosition(tileIndex / EXAMPLES_PER_ROW, column));
+    if(tile == mPressedActor)
+    {
+      mPressedActor.Reset();
+    }
+    mTilePools[column].push_back(tile);
+  }
+  mRealisedTileCounts[pageIndex] = 0u;
+}
+
+void DaliTableView::UpdateRealisedPages(int currentPage)
+{
+  if(currentPage < 0 || currentPage >= mTotalPages)
+  {
+    return;
+  }
+
+  // Recycle first, so the pages coming into range can reuse those tiles.
+  for(int page = 0; page < mTotalPages; ++page)
+  {
+    if(std::abs(page - currentPage) > REALISED_PAGE_RADIUS && mRealisedTileCounts[page] > 0u)
+    {
+      RecyclePage(page);
+    }
+  }
+
+  // The current page is needed right away, its neighbours are filled in when idle, nearest first.
+  RealisePage(currentPage);
+
+  mPendingPages.clear();
+  for(int distance = 1; distance <= REALISED_PAGE_RADIUS; ++distance)
+  {
+    for(int page : {currentPage - distance, currentPage + distance})
+    {
+      if(page >= 0 && page < mTotalPages)
+      {
+        mPendingPages.push_back(page);
+      }
+    }
+  }
+
+  if(!mPendingPages.empty() && !mIdlePopulating)
+  {
+    mIdlePopulating = DevelApplication::AddIdleWithReturnValue(mApplication, MakeCallback(this, &DaliTableView::OnIdlePopulate));
+  }
+}
+
+bool DaliTableView::OnIdlePopulate()
+{
+  const LauncherOptions::Clock::time_point start = LauncherOptions::Clock::now();
+  while(!mPendingPages.empty() && LauncherOptions::Clock::now() - start < IDLE_POPULATE_BUDGET)
+  {
+    if(!RealiseTile(mPendingPages.front()))
+    {
+      mPendingPages.pop_front();
+    }
+  }
+
+  mIdlePopulating = !mPendingPages.empty();
+  return mIdlePopulating;
+}
+
+bool DaliTableView::OnFirstFrameTimer()
+{
+  if(!mFirstFrameRecorder->HasFrame())
+  {
+    return true;
+  }
+  DevelStage::RemoveFrameCallback(Stage::GetCurrent(), *mFirstFrameRecorder);
+
+  using Milliseconds = std::chrono::duration<float, std::milli>;
+
+  unsigned int realisedTiles = 0u;
+  for(unsigned int count : mRealisedTileCounts)
+  {
+    realisedTiles += count;
+  }
+
+  std::cout << "{ \"examples\": " << mExampleList.size()
+            << ", \"pages\": " << mTotalPages
+            << ", \"lazyPopulation\": " << (mOptions.lazyPopulation ? "true" : "false")
+            << ", \"tilesRealised\": " << realisedTiles
+            << ", \"populateMs\": " << Milliseconds(mPopulateDuration).count()
+            << ", \"timeToFirstFrameMs\": " << Milliseconds(mFirstFrameRecorder->GetFrameTime() - mOptions.startTime).count()
+            << " }" << std::endl;
+  return false;
+}
+
 void DaliTableView::Rotate(unsigned int degrees)
 {
   // Resize the root actor
@@ -590,6 +867,8 @@ bool DaliTableView::DoTilePress(Actor actor, PointState::Type pointState)
 
     if(consumed)
     {
+      mLaunchTime = LauncherOptions::Clock::now(); // The example's launch latency is measured from the tap.
+
       mPressedAnimation = Animation::New(BUTTON_PRESS_ANIMATION_TIME);
       mPressedAnimation.SetEndAction(Animation::DISCARD);
 
@@ -615,7 +894,14 @@ void DaliTableView::OnPressedAnimationFinished(Dali::Animation& source)
   {
     std::string name = mPressedActor.GetProperty<std::string>(Dali::Actor::Property::NAME);
 
-    ExecuteProcess(name, mApplication);
+    if(mOptions.reportLaunchLatency)
+    {
+      ExecuteProcess(name, mApplication, mLaunchTime);
+    }
+    else
+    {
+      ExecuteProcess(name, mApplication);
+    }
 
     mPressedActor.Reset();
   }
@@ -632,6 +918,11 @@ void DaliTableView::OnScrollComplete(const Dali::Vector2& position)
 {
   mScrolling = false;
 
+  if(mOptions.lazyPopulation)
+  {
+    UpdateRealisedPages(mScrollView.GetCurrentPage());
+  }
+
   // move focus to 1st item of new page
   AccessibilityManager accessibilityManager = AccessibilityManager::Get();
   accessibilityManager.SetCurrentFocusActor(mPages[mScrollView.GetCurrentPage()].GetChildAt(0));
@@ -712,9 +1003,22 @@ void DaliTableView::OnKeyEvent(const KeyEvent& event)
 
 void DaliTableView::SetupBackground(Actor bubbleContainer)
 {
+  // Pack the shapes into one texture; this is read back from the cache rather than decoded after the first run.
+  if(mInstancedBackground)
+  {
+    for(int i = 0; i < NUMBER_OF_SHAPE_IMAGES; ++i)
+    {
+      mShapeAtlas.Add(SHAPE_IMAGE_TABLE[i]);
+    }
+    mShapeAtlas.Build(SHAPE_ATLAS_CACHE_NAME);
+  }
+
   // Add bubbles to the bubbleContainer.
   // Note: The bubbleContainer is parented externally to this function.
-  AddBackgroundActors(bubbleContainer, NUM_BACKGROUND_IMAGES);
+  if(!mInstancedBackground || !AddInstancedBackground(bubbleContainer, NUM_BACKGROUND_IMAGES))
+  {
+    AddBackgroundActors(bubbleContainer, NUM_BACKGROUND_IMAGES);
+  }
 }
 
 void DaliTableView::InitialiseBackgroundActors(Actor actor)
@@ -765,8 +1069,8 @@ void DaliTableView::AddBackgroundActors(Actor layer, int count)
     dfActor.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
 
     // Set the Image URL and the custom shader at the same time
-    Dali::Property::Map effect = Toolkit::CreateDistanceFieldEffect();
-    Property::Map       imageMap;
+    const Property::Map& effect = mShaderCache.GetShaderMap("distance-field", &Toolkit::CreateDistanceFieldEffect);
+    Property::Map        imageMap;
     imageMap.Add(ImageVisual::Property::URL, SHAPE_IMAGE_TABLE[shapeType]);
     imageMap.Add(Toolkit::Visual::Property::SHADER, effect);
     dfActor.SetProperty(Toolkit::ImageView::Property::IMAGE, imageMap);
@@ -780,6 +1084,111 @@ void DaliTableView::AddBackgroundActors(Actor layer, int count)
   layer.OnRelayoutSignal().Connect(this, &DaliTableView::InitialiseBackgroundActors);
 }
 
+bool DaliTableView::AddInstancedBackground(Actor layer, int count)
+{
+  // The quads can only share a renderer if all the shapes ended up in the same page.
+  Vector4 textureRects[NUMBER_OF_SHAPE_IMAGES];
+  for(int i = 0; i < NUMBER_OF_SHAPE_IMAGES; ++i)
+  {
+    DemoHelper::TextureAtlas::Region region;
+    if(!mShapeAtlas.GetRegion(SHAPE_IMAGE_TABLE[i], region) || region.page != 0u)
+    {
+      return false;
+    }
+    textureRects[i] = region.textureRect;
+  }
+
+  Vector4 colors[NUMBER_OF_BUBBLE_COLORS];
+  for(int i = 0; i < NUMBER_OF_BUBBLE_COLORS; ++i)
+  {
+    colors[i] = GetStyleColor(BUBBLE_COLOR_STYLE_NAME[i]);
+  }
+
+  // Four vertices per bubble, all holding the same attributes apart from the corner.
+  static const Vector2 CORNERS[] = {Vector2(-0.5f, -0.5f), Vector2(0.5f, -0.5f), Vector2(-0.5f, 0.5f), Vector2(0.5f, 0.5f)};
+
+  std::vector<BubbleVertex> vertices(count * 4);
+  std::vector<uint16_t>     indices;
+  indices.reserve(count * 6);
+  for(int i = 0; i < count; ++i)
+  {
+    const float   size      = Random::Range(10.0f, 400.0f);
+    const int     shapeType = static_cast<int>(Random::Range(0.0f, NUMBER_OF_SHAPE_IMAGES - 1) + 0.5f);
+    const Vector4 rect      = textureRects[shapeType];
+
+    // As InitialiseBackgroundActors, but relative to the layer size which the shader applies.
+    const Vector3 position(Random::Range(-0.5f * BACKGROUND_SPREAD_SCALE, 0.85f * BACKGROUND_SPREAD_SCALE),
+                           Random::Range(-1.0f, 1.0f),
+                           Random::Range(BUBBLE_MIN_Z, BUBBLE_MAX_Z));
+    const float   speed    = 2000.0f / Random::Range(30.0f, 160.0f);
+    const float   parallax = Random::Range(-0.85f, 0.25f);
+
+    for(int corner = 0; corner < 4; ++corner)
+    {
+      BubbleVertex& vertex = vertices[i * 4 + corner];
+      vertex.corner        = CORNERS[corner];
+      vertex.texCoord      = Vector2(corner & 1 ? rect.z : rect.x, corner & 2 ? rect.w : rect.y);
+      vertex.position      = position;
+      vertex.size          = size;
+      vertex.speed         = speed;
+      vertex.parallax      = parallax;
+      vertex.color         = colors[i % NUMBER_OF_BUBBLE_COLORS];
+    }
+
+    const uint16_t first = static_cast<uint16_t>(i * 4);
+    indices.insert(indices.end(), {first, uint16_t(first + 1), uint16_t(first + 2), uint16_t(first + 2), uint16_t(first + 1), uint16_t(first + 3)});
+  }
+
+  Property::Map vertexFormat;
+  vertexFormat["aCorner"]   = Property::VECTOR2;
+  vertexFormat["aTexCoord"] = Property::VECTOR2;
+  vertexFormat["aPosition"] = Property::VECTOR3;
+  vertexFormat["aSize"]     = Property::FLOAT;
+  vertexFormat["aSpeed"]    = Property::FLOAT;
+  vertexFormat["aParallax"] = Property::FLOAT;
+  vertexFormat["aColor"]    = Property::VECTOR4;
+
+  VertexBuffer vertexBuffer = VertexBuffer::New(vertexFormat);
+  vertexBuffer.SetData(vertices.data(), vertices.size());
+
+  Geometry geometry = Geometry::New();
+  geometry.AddVertexBuffer(vertexBuffer);
+  geometry.SetIndexBuffer(indices.data(), indices.size());
+  geometry.SetType(Geometry::TRIANGLES);
+
+  TextureSet textureSet = TextureSet::New();
+  textureSet.SetTexture(0u, mShapeAtlas.GetTexture(0u));
+
+  Renderer renderer = Renderer::New(geometry, mShaderCache.Get("bubble", BUBBLE_VERTEX_SHADER, BUBBLE_FRAGMENT_SHADER));
+  renderer.SetTextures(textureSet);
+  renderer.SetProperty(Renderer::Property::BLEND_MODE, BlendMode::ON);
+
+  Actor bubbles = Actor::New();
+  bubbles.SetProperty(Actor::Property::NAME, "BUBBLES");
+  bubbles.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::CENTER);
+  bubbles.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
+  bubbles.SetResizePolicy(ResizePolicy::FILL_TO_PARENT, Dimension::ALL_DIMENSIONS);
+  bubbles.AddRenderer(renderer);
+  layer.Add(bubbles);
+
+  // The only per-frame work left: one constraint for the parallax and one animation for the rising.
+  Property::Index scrollPositionIndex = bubbles.RegisterProperty("uScrollPosition", Vector2::ZERO);
+  Constraint      scrollConstraint    = Constraint::New<Vector2>(bubbles, scrollPositionIndex, EqualToConstraint());
+  scrollConstraint.AddSource(Source(mScrollView, ScrollView::Property::SCROLL_POSITION));
+  scrollConstraint.SetRemoveAction(Constraint::DISCARD);
+  scrollConstraint.Apply();
+
+  // As the time is animated by a relative amount, stopping & replaying carries on from where the bubbles were.
+  Property::Index timeIndex = bubbles.RegisterProperty("uTime", 0.0f);
+  Animation       animation = Animation::New(BUBBLE_TIME_ANIMATION_DURATION);
+  animation.AnimateBy(Property(bubbles, timeIndex), BUBBLE_TIME_ANIMATION_DURATION, AlphaFunction::LINEAR);
+  animation.SetLooping(true);
+  animation.Play();
+  mBackgroundAnimations.push_back(animation);
+
+  return true;
+}
+
 bool DaliTableView::PauseBackgroundAnimation()
 {
   PauseAnimation();
@@ -826,6 +1235,7 @@ Dali::Actor DaliTableView::OnKeyboardPreFocusChange(Dali::Actor current, Dali::A
   if(!current && !proposed)
   {
     // Set the initial focus to the first tile in the current page should be focused.
+    RealisePage(mScrollView.GetCurrentPage());
     nextFocusActor = mPages[mScrollView.GetCurrentPage()].GetChildAt(0);
   }
   else if(!proposed)
@@ -858,6 +1268,7 @@ Dali::Actor DaliTableView::OnKeyboardPreFocusChange(Dali::Actor current, Dali::A
 
     // Scroll to the page in the given direction
     mScrollView.ScrollTo(newPage);
+    RealisePage(newPage);
 
     if(direction == Dali::Toolkit::Control::KeyboardFocus::LEFT)
     {
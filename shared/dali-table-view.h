@@ -21,6 +21,13 @@
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali-toolkit/devel-api/controls/popup/popup.h>
 #include <dali/dali.h>
+#include <chrono>
+#include <deque>
+#include <memory>
+
+#include "shared/frame-time-recorder.h"
+#include "shared/shader-cache.h"
+#include "shared/texture-atlas.h"
 
 class Example;
 
@@ -61,13 +68,43 @@ struct Example
   std::string title; ///< title (caption) of example to appear on tile button.
 };
 
+/**
+ * Launcher options, usually given on the command line
+ */
+struct LauncherOptions
+{
+  using Clock = std::chrono::steady_clock;
+
+  /**
+   * Reads the options from the command line:
+   *   --eager-population        Realise every tile before the first frame instead of only the visible pages'.
+   *   --report-first-frame      Print the time to the first frame as JSON once it has been rendered.
+   *   --example-list-scale N    Repeat the example list N times.
+   *   --zygote                  Launch examples by forking a zygote process rather than exec'ing them. The zygote only
+   *                             has the libraries loaded & fontconfig initialised; each example still sets up
+   *                             DALi, its theme, styles, shaders & fonts itself.
+   *   --report-launch-latency   Make each launched example print the time from its tile being tapped to its first
+   *                             frame as JSON, see DemoHelper::ReportLaunchLatency().
+   *
+   * @note Should be called first thing in main, as the time to the first frame is measured from then.
+   */
+  static LauncherOptions FromCommandLine(int argc, char** argv);
+
+  Clock::time_point startTime{Clock::now()};   ///< When the launcher started
+  int               exampleListScale{1};        ///< How many times the example list is repeated
+  bool              lazyPopulation{true};       ///< Whether tiles are only realised for the current page & its neighbours
+  bool              reportFirstFrame{false};    ///< Whether to print the time to the first frame
+  bool              zygote{false};              ///< Whether examples are launched from a zygote, see StartExecuteProcessZygote()
+  bool              reportLaunchLatency{false}; ///< Whether the launched examples print the time from the tap to their first frame
+};
+
 /**
  * Dali-Demo instance
  */
 class DaliTableView : public Dali::ConnectionTracker
 {
 public:
-  DaliTableView(Dali::Application& application);
+  DaliTableView(Dali::Application& application, const LauncherOptions& options = LauncherOptions());
   ~DaliTableView();
 
 public:
@@ -90,6 +127,17 @@ public:
    */
   void SortAlphabetically(bool sortAlphabetically);
 
+  /**
+   * Chooses how the bubbles in the background are drawn.
+   *
+   * @param[in] instanced If true, all the bubbles are drawn by one renderer which animates them in its
+   *                      shader, otherwise each bubble is an ImageView with its own constraint & animation.
+   *
+   * @note Should be called before the Application MainLoop is started.
+   * @note By default the bubbles are instanced, falling back to ImageViews if the shapes cannot be packed into one texture.
+   */
+  void SetInstancedBackground(bool instanced);
+
 private:                                                      // Application callbacks & implementation
   static const unsigned int FOCUS_ANIMATION_ACTOR_NUMBER = 2; ///< The number of elements used to form the custom focus effect
 
@@ -116,6 +164,50 @@ private:                                                      // Application cal
    */
   void Populate();
 
+  /**
+   * Realises the next tile of a page, taking it from the pool if possible.
+   *
+   * @param[in] pageIndex The page
+   *
+   * @return False if the page was already complete.
+   */
+  bool RealiseTile(int pageIndex);
+
+  /**
+   * Realises all the remaining tiles of a page.
+   *
+   * @param[in] pageIndex The page
+   */
+  void RealisePage(int pageIndex);
+
+  /**
+   * Removes all the tiles of a page, putting them in the pool.
+   *
+   * @param[in] pageIndex The page
+   */
+  void RecyclePage(int pageIndex);
+
+  /**
+   * Realises the given page, queues its neighbours to be realised when idle and recycles the others.
+   *
+   * @param[in] currentPage The page now being shown
+   */
+  void UpdateRealisedPages(int currentPage);
+
+  /**
+   * Idle callback realising the queued pages' tiles, a few at a time.
+   *
+   * @return Whether there are more tiles to realise
+   */
+  bool OnIdlePopulate();
+
+  /**
+   * Timer handler which prints the time to the first frame once it has been rendered.
+   *
+   * @return Return value for timer handler
+   */
+  bool OnFirstFrameTimer();
+
   /**
    * Rotates RootActor orientation to that specified.
    *
@@ -253,6 +345,16 @@ private:                                                      // Application cal
    */
   void AddBackgroundActors(Dali::Actor layer, int count);
 
+  /**
+   * Create a single actor drawing all the background bubbles for the given layer
+   *
+   * @param[in] layer The layer to add the actor to
+   * @param[in] count The number of bubbles to generate
+   *
+   * @return False if the shapes are not all in the first page of mShapeAtlas.
+   */
+  bool AddInstancedBackground(Dali::Actor layer, int count);
+
   /**
    * Timer handler for ending background animation
    *
@@ -363,9 +465,14 @@ private:
   };
   FocusEffect mFocusEffect[FOCUS_ANIMATION_ACTOR_NUMBER]; ///< The elements used to create the custom focus effect
 
-  std::vector<Dali::Actor> mPages;                ///< List of pages.
-  AnimationList            mBackgroundAnimations; ///< List of background bubble animations
-  ExampleList              mExampleList;          ///< List of examples.
+  DemoHelper::TextureAtlas              mShapeAtlas;           ///< The background bubble shapes packed into one texture
+  DemoHelper::ShaderCache               mShaderCache;          ///< The shaders shared by the background bubbles & shapes
+  std::vector<Dali::Actor>              mPages;                ///< List of pages.
+  std::vector<unsigned int>             mRealisedTileCounts;   ///< The number of tiles realised in each page.
+  std::deque<int>                       mPendingPages;         ///< Pages whose tiles are realised when idle.
+  std::vector<std::vector<Dali::Actor>> mTilePools;            ///< Recycled tiles, by column.
+  AnimationList                         mBackgroundAnimations; ///< List of background bubble animations
+  ExampleList                           mExampleList;          ///< List of examples.
 
   float mPageWidth;  ///< The width of a page within the scroll-view, used to calculate the domain
   int   mTotalPages; ///< Total pages within scrollview.
@@ -373,6 +480,14 @@ private:
   bool mScrolling : 1;              ///< Flag indicating whether view is currently being scrolled
   bool mSortAlphabetically : 1;     ///< Sort examples alphabetically.
   bool mBackgroundAnimsPlaying : 1; ///< Are background animations playing
+  bool mInstancedBackground : 1;    ///< Whether the background bubbles are drawn by a single renderer
+  bool mIdlePopulating : 1;         ///< Whether the idle callback realising tiles is installed
+
+  LauncherOptions                                 mOptions;            ///< The launcher options.
+  LauncherOptions::Clock::duration                mPopulateDuration{}; ///< The time taken by Populate().
+  std::unique_ptr<DemoHelper::FirstFrameRecorder> mFirstFrameRecorder; ///< Timestamps the first frame, if reporting it.
+  Dali::Timer                                     mFirstFrameTimer;    ///< Polls mFirstFrameRecorder.
+  LauncherOptions::Clock::time_point              mLaunchTime;         ///< When the pressed tile was tapped.
 };
 
 #endif // DALI_DEMO_TABLEVIEW_H
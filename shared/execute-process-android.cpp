@@ -29,6 +29,11 @@
 #include <android_native_app_glue.h>
 #include <dali-demo-native-activity-jni.h>
 
+bool StartExecuteProcessZygote()
+{
+  return false; // Examples are always started as new processes.
+}
+
 void ExecuteProcess(const std::string& processName, Dali::Application& application)
 {
   struct android_app* nativeApp = Dali::Integration::AndroidFramework::Get().GetNativeApplication();
@@ -41,3 +46,8 @@ void ExecuteProcess(const std::string& processName, Dali::Application& applicati
   DaliDemoNativeActivity nativeActivity(nativeApp->activity);
   nativeActivity.LaunchExample(processName);
 }
+
+void ExecuteProcess(const std::string& processName, Dali::Application& application, std::chrono::steady_clock::time_point launchTime)
+{
+  ExecuteProcess(processName, application); // The activity cannot be given the launch time.
+}
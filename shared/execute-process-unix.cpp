@@ -19,18 +19,225 @@
 #include "execute-process.h"
 
 // EXTERNAL INCLUDES
+#include <dali/integration-api/debug.h>
 #include <dali/public-api/common/dali-common.h>
+#include <dlfcn.h>
+#include <signal.h>
+#include <sys/socket.h>
 #include <unistd.h>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <sstream>
+#include <vector>
 
-void ExecuteProcess(const std::string& processName, Dali::Application& application)
+// INTERNAL INCLUDES
+#include "shared/launch-latency.h"
+
+namespace
+{
+const size_t MAX_PROCESS_NAME_LENGTH = 256u; ///< The longest example name the zygote accepts
+
+int gZygoteSocket = -1; ///< The launcher's end of the connection to the zygote, -1 if there is no zygote
+
+/**
+ * What the launcher sends the zygote to launch an example.
+ */
+struct LaunchRequest
+{
+  int64_t launchTime;                    ///< The launch time in steady_clock nanoseconds, 0 if it is not to be passed on
+  char    name[MAX_PROCESS_NAME_LENGTH]; ///< The example's name, not null-terminated
+};
+
+/**
+ * Tells the example when & how it was launched, so it reports its launch latency, see DemoHelper::ReportLaunchLatency().
+ */
+void SetLaunchEnvironment(const std::string& processName, int64_t launchTime, const char* mode)
+{
+  setenv(DemoHelper::LAUNCH_TIME_VARIABLE, std::to_string(launchTime).c_str(), 1);
+  setenv(DemoHelper::LAUNCH_EXAMPLE_VARIABLE, processName.c_str(), 1);
+  setenv(DemoHelper::LAUNCH_MODE_VARIABLE, mode, 1);
+}
+
+/**
+ * Replaces the current process with the example's binary.
+ */
+void Exec(const std::string& processName)
 {
   std::stringstream stream;
   stream << DEMO_EXAMPLE_BIN << processName.c_str();
+  execlp(stream.str().c_str(), processName.c_str(), NULL);
+  DALI_ASSERT_ALWAYS(false && "exec failed!");
+}
+
+/**
+ * Runs the example in the current process by calling the main() of its module (e.g. "blocks.example.so"),
+ * so that none of the libraries already loaded by the zygote are loaded & relocated again.
+ * Falls back to exec'ing the example's binary, with an error logged, if it has no module or the module does not
+ * export main() (which needs DALI_EXPORT_API as the examples are built with hidden visibility).
+ */
+void RunExample(const std::string& processName)
+{
+  std::stringstream stream;
+  stream << DEMO_EXAMPLE_BIN << processName.c_str() << ".so";
+
+  if(void* module = dlopen(stream.str().c_str(), RTLD_NOW | RTLD_GLOBAL))
+  {
+    using MainFunction = int (*)(int, char**);
+    if(MainFunction exampleMain = reinterpret_cast<MainFunction>(dlsym(module, "main")))
+    {
+      std::vector<char> name(processName.begin(), processName.end());
+      name.push_back('\0');
+      char* argv[] = {name.data(), nullptr};
+      exit(exampleMain(1, argv));
+    }
+    DALI_LOG_ERROR("%s does not export main(), exec'ing %s instead\n", stream.str().c_str(), processName.c_str());
+    dlclose(module);
+  }
+  else
+  {
+    DALI_LOG_ERROR("Unable to load %s (%s), exec'ing %s instead\n", stream.str().c_str(), dlerror(), processName.c_str());
+  }
+
+  if(getenv(DemoHelper::LAUNCH_TIME_VARIABLE))
+  {
+    setenv(DemoHelper::LAUNCH_MODE_VARIABLE, "exec", 1); // So the report does not pass this off as a zygote launch.
+  }
+  Exec(processName);
+}
+
+/**
+ * Loads what every example needs but which does not depend on the display, so the examples forked from the
+ * zygote share it instead of each loading it again.
+ *
+ * Only fontconfig is preloaded. The theme, styles, shaders & font faces belong to the adaptor & toolkit created
+ * with each example's Application, along with its window, GL context & threads, none of which survive a fork.
+ */
+void Preload()
+{
+  // The fontconfig configuration & caches are parsed by every example's first text; do it once here.
+  if(void* fontconfig = dlopen("libfontconfig.so.1", RTLD_NOW | RTLD_GLOBAL))
+  {
+    using FcInitFunction = int (*)();
+    if(FcInitFunction fcInit = reinterpret_cast<FcInitFunction>(dlsym(fontconfig, "FcInit")))
+    {
+      fcInit();
+    }
+  }
+}
+
+/**
+ * The zygote's main loop: forks an example for each name received, until the launcher goes away.
+ */
+void RunZygote(int socket)
+{
+  signal(SIGCHLD, SIG_IGN); // The examples are reaped automatically.
+  Preload();
+
+  LaunchRequest request;
+  for(;;)
+  {
+    const ssize_t length = recv(socket, &request, sizeof(request), 0);
+    if(length <= 0)
+    {
+      _exit(0); // The launcher has exited.
+    }
+    if(length <= static_cast<ssize_t>(offsetof(LaunchRequest, name)))
+    {
+      continue;
+    }
+
+    fflush(nullptr);
+    if(fork() == 0)
+    {
+      close(socket);
+      signal(SIGCHLD, SIG_DFL);
+
+      const std::string name(request.name, length - offsetof(LaunchRequest, name));
+      if(request.launchTime != 0)
+      {
+        SetLaunchEnvironment(name, request.launchTime, "zygote");
+      }
+      RunExample(name);
+    }
+  }
+}
+
+/**
+ * Launches the example from the zygote if there is one, otherwise by fork & exec'ing it.
+ *
+ * @param[in] processName The example's name.
+ * @param[in] launchTime The launch time in steady_clock nanoseconds to pass to the example, 0 for none.
+ */
+void Launch(const std::string& processName, int64_t launchTime)
+{
+  if(gZygoteSocket >= 0)
+  {
+    if(processName.size() <= MAX_PROCESS_NAME_LENGTH)
+    {
+      LaunchRequest request;
+      request.launchTime = launchTime;
+      memcpy(request.name, processName.data(), processName.size());
+
+      const size_t length = offsetof(LaunchRequest, name) + processName.size();
+      if(send(gZygoteSocket, &request, length, MSG_NOSIGNAL) == static_cast<ssize_t>(length))
+      {
+        return;
+      }
+    }
+
+    DALI_LOG_ERROR("Unable to launch %s from the zygote, exec'ing it instead\n", processName.c_str());
+    close(gZygoteSocket);
+    gZygoteSocket = -1;
+  }
+
   pid_t pid = fork();
   if(pid == 0)
   {
-    execlp(stream.str().c_str(), processName.c_str(), NULL);
-    DALI_ASSERT_ALWAYS(false && "exec failed!");
+    if(launchTime != 0)
+    {
+      SetLaunchEnvironment(processName, launchTime, "exec");
+    }
+    Exec(processName);
+  }
+}
+
+} // namespace
+
+bool StartExecuteProcessZygote()
+{
+  int sockets[2];
+  if(socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0, sockets) != 0)
+  {
+    return false;
+  }
+
+  fflush(nullptr); // So nothing buffered is written by both processes.
+  const pid_t pid = fork();
+  if(pid == 0)
+  {
+    close(sockets[0]);
+    RunZygote(sockets[1]);
+  }
+
+  close(sockets[1]);
+  if(pid < 0)
+  {
+    close(sockets[0]);
+    return false;
   }
+
+  gZygoteSocket = sockets[0];
+  return true;
+}
+
+void ExecuteProcess(const std::string& processName, Dali::Application& application)
+{
+  Launch(processName, 0);
+}
+
+void ExecuteProcess(const std::string& processName, Dali::Application& application, std::chrono::steady_clock::time_point launchTime)
+{
+  Launch(processName, std::chrono::duration_cast<std::chrono::nanoseconds>(launchTime.time_since_epoch()).count());
 }
@@ -22,11 +22,19 @@
 #include <dali/public-api/common/dali-common.h>
 #include <windows.h>
 
+// INTERNAL INCLUDES
+#include "shared/launch-latency.h"
+
 namespace
 {
 const std::string PATH_SEPARATOR("\\");
 }
 
+bool StartExecuteProcessZygote()
+{
+  return false; // Examples are always started as new processes.
+}
+
 void ExecuteProcess(const std::string& processName, Dali::Application& application)
 {
   std::string processPathName;
@@ -59,3 +67,17 @@ void ExecuteProcess(const std::string& processName, Dali::Application& applicati
     CloseHandle(processInfo.hThread);
   }
 }
+
+void ExecuteProcess(const std::string& processName, Dali::Application& application, std::chrono::steady_clock::time_point launchTime)
+{
+  // The example inherits the launcher's environment.
+  SetEnvironmentVariable(DemoHelper::LAUNCH_TIME_VARIABLE, std::to_string(std::chrono::duration_cast<std::chrono::nanoseconds>(launchTime.time_since_epoch()).count()).c_str());
+  SetEnvironmentVariable(DemoHelper::LAUNCH_EXAMPLE_VARIABLE, processName.c_str());
+  SetEnvironmentVariable(DemoHelper::LAUNCH_MODE_VARIABLE, "exec");
+
+  ExecuteProcess(processName, application);
+
+  SetEnvironmentVariable(DemoHelper::LAUNCH_TIME_VARIABLE, nullptr);
+  SetEnvironmentVariable(DemoHelper::LAUNCH_EXAMPLE_VARIABLE, nullptr);
+  SetEnvironmentVariable(DemoHelper::LAUNCH_MODE_VARIABLE, nullptr);
+}
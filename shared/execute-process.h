@@ -20,8 +20,27 @@
 
 // EXTERNAL INCLUDES
 #include <dali/public-api/adaptor-framework/application.h>
+#include <chrono>
 #include <string>
 
+/**
+ * Starts a zygote process which forks the examples launched by ExecuteProcess() from then on, instead of
+ * fork & exec'ing them, so they start with the libraries the launcher uses already loaded and fontconfig
+ * initialised. Nothing else is preloaded; each example still initialises DALi itself.
+ *
+ * @note Must be called before the Application is created, while the launcher is still single-threaded.
+ * @return true if the zygote was started, false if it could not be or is not supported on this platform.
+ */
+bool StartExecuteProcessZygote();
+
 void ExecuteProcess(const std::string& processName, Dali::Application& application);
 
+/**
+ * Launches the example like ExecuteProcess(), also passing it the time it was requested at, so that it prints the time
+ * from then to its first frame (see DemoHelper::ReportLaunchLatency()).
+ *
+ * @note Where the launch time cannot be passed to the example, it is launched without it.
+ */
+void ExecuteProcess(const std::string& processName, Dali::Application& application, std::chrono::steady_clock::time_point launchTime);
+
 #endif // DALI_DEMO_EXECUTE_PROCESS_H
@@ -0,0 +1,236 @@
+#ifndef DALI_DEMO_FRAME_TIME_HISTOGRAM_H
+#define DALI_DEMO_FRAME_TIME_HISTOGRAM_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <ostream>
+#include <utility>
+#include <vector>
+
+namespace DemoHelper
+{
+/**
+ * @brief A high-dynamic-range histogram of frame times.
+ *
+ * Frame times are stored in microseconds. Values below 2^subBucketBits get a bucket each, above that
+ * every power of two is split into 2^subBucketBits linear sub-buckets, so the relative error is
+ * constant (around 6% with the default of 4 bits) whether a frame took 1ms or 1s, and the memory
+ * needed only grows with the logarithm of the largest frame time.
+ */
+class FrameTimeHistogram
+{
+public:
+  /**
+   * @brief Constructor.
+   * @param[in]  subBucketBits  The number of bits of precision kept for each recorded value.
+   */
+  explicit FrameTimeHistogram(uint32_t subBucketBits = 4u)
+  : mSubBucketBits(subBucketBits),
+    mSubBucketCount(1u << subBucketBits)
+  {
+  }
+
+  /**
+   * @brief Records a frame time.
+   * @param[in]  frameTimeMs  The frame time in milliseconds.
+   */
+  void Record(float frameTimeMs)
+  {
+    const uint32_t index = GetBucketIndex(static_cast<uint64_t>(std::max(0.0f, frameTimeMs) * 1000.0f));
+    if(index >= mCounts.size())
+    {
+      mCounts.resize(index + 1u, 0u);
+    }
+    ++mCounts[index];
+    ++mTotalCount;
+  }
+
+  /**
+   * @brief Records all the given frame times.
+   */
+  void Record(const std::vector<float>& frameTimesMs)
+  {
+    for(float frameTimeMs : frameTimesMs)
+    {
+      Record(frameTimeMs);
+    }
+  }
+
+  /**
+   * @brief Retrieves the number of recorded frames.
+   */
+  uint32_t GetTotalCount() const
+  {
+    return mTotalCount;
+  }
+
+  /**
+   * @brief Retrieves the frame time at the given percentile.
+   * @param[in]  percentile  The percentile, 0 to 100.
+   * @return The upper bound of the bucket holding the percentile in milliseconds, 0 if nothing was recorded.
+   */
+  float GetValueAtPercentile(float percentile) const
+  {
+    const uint64_t target = static_cast<uint64_t>(std::ceil(percentile * 0.01f * mTotalCount));
+
+    uint64_t count = 0u;
+    for(uint32_t index = 0u; index < mCounts.size(); ++index)
+    {
+      count += mCounts[index];
+      if(count >= target && count > 0u)
+      {
+        return GetBucketRange(index).second * 0.001f;
+      }
+    }
+    return 0.0f;
+  }
+
+  /**
+   * @brief Writes the non-empty buckets as a JSON array of [ lowerMs, upperMs, count ] triplets.
+   */
+  void WriteJson(std::ostream& stream) const
+  {
+    stream << "[";
+    bool first = true;
+    for(uint32_t index = 0u; index < mCounts.size(); ++index)
+    {
+      if(mCounts[index] > 0u)
+      {
+        auto range = GetBucketRange(index);
+        stream << (first ? " " : ", ") << "[ " << range.first * 0.001f << ", " << range.second * 0.001f << ", " << mCounts[index] << " ]";
+        first = false;
+      }
+    }
+    stream << " ]";
+  }
+
+private:
+  /**
+   * @brief Retrieves the bucket the given value (in microseconds) falls into.
+   */
+  uint32_t GetBucketIndex(uint64_t value) const
+  {
+    if(value < mSubBucketCount)
+    {
+      return static_cast<uint32_t>(value);
+    }
+
+    uint32_t mostSignificantBit = 0u;
+    for(uint64_t remaining = value >> 1u; remaining; remaining >>= 1u)
+    {
+      ++mostSignificantBit;
+    }
+
+    // Keep the top mSubBucketBits + 1 bits; the leading one bit means subBucket is within [ mSubBucketCount, 2 * mSubBucketCount ).
+    const uint32_t shift     = mostSignificantBit - mSubBucketBits;
+    const uint32_t subBucket = static_cast<uint32_t>(value >> shift);
+    return shift * mSubBucketCount + subBucket;
+  }
+
+  /**
+   * @brief Retrieves the [ lower, upper ) range, in microseconds, covered by the given bucket.
+   */
+  std::pair<uint64_t, uint64_t> GetBucketRange(uint32_t index) const
+  {
+    if(index < mSubBucketCount)
+    {
+      return {index, index + 1u};
+    }
+
+    const uint32_t shift     = index / mSubBucketCount - 1u;
+    const uint64_t subBucket = index - shift * mSubBucketCount;
+    return {subBucket << shift, (subBucket + 1u) << shift};
+  }
+
+private:
+  std::vector<uint32_t> mCounts;         ///< The number of frames in each bucket.
+  uint32_t              mTotalCount{0u}; ///< The total number of frames recorded.
+  const uint32_t        mSubBucketBits;  ///< Bits of precision kept per value.
+  const uint32_t        mSubBucketCount; ///< 2^mSubBucketBits.
+};
+
+/**
+ * @brief The frames which missed the vsync budget.
+ */
+struct JankReport
+{
+  float                                   budgetMs{0.0f};    ///< The vsync interval the frames were checked against.
+  uint32_t                                frameCount{0u};    ///< The number of frames checked.
+  uint32_t                                droppedFrames{0u}; ///< The number of vsyncs for which no new frame was ready.
+  std::vector<std::pair<uint32_t, float>> jankyFrames;       ///< The index & time (in milliseconds) of every frame that missed its vsync.
+};
+
+/**
+ * @brief Flags the frames that missed the vsync budget.
+ *
+ * A frame which took n vsync intervals (rounded to the nearest) dropped n - 1 frames, so a frame is
+ * flagged when it takes at least one and a half budgets; this avoids flagging frames whose timestamps
+ * just jitter around the vsync interval.
+ *
+ * @param[in]  frameTimesMs  The frame times in milliseconds, in the order they occurred.
+ * @param[in]  budgetMs      The vsync interval in milliseconds.
+ * @return The report, with no frames checked if the budget is not positive.
+ */
+inline JankReport DetectJank(const std::vector<float>& frameTimesMs, float budgetMs)
+{
+  JankReport report;
+  report.budgetMs = budgetMs;
+  if(!(budgetMs > 0.0f))
+  {
+    return report;
+  }
+  report.frameCount = static_cast<uint32_t>(frameTimesMs.size());
+
+  for(uint32_t i = 0u; i < frameTimesMs.size(); ++i)
+  {
+    const float    intervals = frameTimesMs[i] / budgetMs + 0.5f;
+    const uint32_t vsyncs    = intervals < static_cast<float>(std::numeric_limits<uint32_t>::max()) ? static_cast<uint32_t>(intervals) : std::numeric_limits<uint32_t>::max();
+    if(vsyncs > 1u)
+    {
+      report.droppedFrames += vsyncs - 1u;
+      report.jankyFrames.emplace_back(i, frameTimesMs[i]);
+    }
+  }
+  return report;
+}
+
+/**
+ * @brief Writes the jank report as a JSON object (without a trailing newline).
+ */
+inline void WriteJson(std::ostream& stream, const JankReport& report)
+{
+  stream << "{ \"budgetMs\": " << report.budgetMs
+         << ", \"frames\": " << report.frameCount
+         << ", \"jankyFrameCount\": " << report.jankyFrames.size()
+         << ", \"droppedFrames\": " << report.droppedFrames
+         << ", \"jankyFrames\": [";
+  for(size_t i = 0; i < report.jankyFrames.size(); ++i)
+  {
+    stream << (i ? ", " : " ") << "{ \"index\": " << report.jankyFrames[i].first << ", \"ms\": " << report.jankyFrames[i].second << " }";
+  }
+  stream << " ] }";
+}
+
+} // namespace DemoHelper
+
+#endif // DALI_DEMO_FRAME_TIME_HISTOGRAM_H
@@ -0,0 +1,250 @@
+#ifndef DALI_DEMO_FRAME_TIME_RECORDER_H
+#define DALI_DEMO_FRAME_TIME_RECORDER_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/update/frame-callback-interface.h>
+#include <dali/devel-api/update/update-proxy.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+namespace DemoHelper
+{
+/**
+ * @brief Summary of a set of frame times, all values in milliseconds.
+ */
+struct FrameTimeStatistics
+{
+  uint32_t frameCount{0u};
+  float    minimum{0.0f};
+  float    median{0.0f};
+  float    percentile95{0.0f};
+  float    percentile99{0.0f};
+  float    maximum{0.0f};
+  float    mean{0.0f};
+};
+
+/**
+ * @brief Calculates the statistics of the given frame times.
+ * @param[in]  frameTimes  The frame times in milliseconds (taken by value as they need sorting).
+ * @return The statistics, all zero if frameTimes is empty.
+ */
+inline FrameTimeStatistics CalculateFrameTimeStatistics(std::vector<float> frameTimes)
+{
+  FrameTimeStatistics statistics;
+  if(frameTimes.empty())
+  {
+    return statistics;
+  }
+
+  std::sort(frameTimes.begin(), frameTimes.end());
+
+  // Nearest-rank percentile.
+  auto percentile = [&frameTimes](float fraction) {
+    size_t rank = static_cast<size_t>(fraction * static_cast<float>(frameTimes.size() - 1u) + 0.5f);
+    return frameTimes[std::min(rank, frameTimes.size() - 1u)];
+  };
+
+  double total = 0.0;
+  for(float frameTime : frameTimes)
+  {
+    total += frameTime;
+  }
+
+  statistics.frameCount   = static_cast<uint32_t>(frameTimes.size());
+  statistics.minimum      = frameTimes.front();
+  statistics.median       = percentile(0.5f);
+  statistics.percentile95 = percentile(0.95f);
+  statistics.percentile99 = percentile(0.99f);
+  statistics.maximum      = frameTimes.back();
+  statistics.mean         = static_cast<float>(total / frameTimes.size());
+  return statistics;
+}
+
+/**
+ * @brief Writes the statistics as a JSON object (without a trailing newline).
+ */
+inline void WriteJson(std::ostream& stream, const FrameTimeStatistics& statistics)
+{
+  stream << "{ \"frames\": " << statistics.frameCount
+         << ", \"minMs\": " << statistics.minimum
+         << ", \"medianMs\": " << statistics.median
+         << ", \"p95Ms\": " << statistics.percentile95
+         << ", \"p99Ms\": " << statistics.percentile99
+         << ", \"maxMs\": " << statistics.maximum
+         << ", \"meanMs\": " << statistics.mean << " }";
+}
+
+/**
+ * @brief A FrameCallbackInterface which timestamps every frame on the update thread.
+ *
+ * The time between two consecutive updates is the full frame time (update, render and the wait for
+ * the next vsync), which is what the user perceives. Add it with DevelStage::AddFrameCallback() and
+ * call Start() / Stop() from the event thread around the section to be measured.
+ */
+class FrameTimeRecorder : public Dali::FrameCallbackInterface
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+  /**
+   * @brief Starts recording, discarding any previously recorded frames.
+   */
+  void Start()
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mFrameTimes.clear();
+    mLastFrame = Clock::time_point();
+    mRecording = true;
+  }
+
+  /**
+   * @brief Stops recording.
+   * @return The frame times, in milliseconds, recorded since Start().
+   */
+  std::vector<float> Stop()
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mRecording = false;
+    return std::move(mFrameTimes);
+  }
+
+  /**
+   * @brief Queries whether the recorder is currently recording.
+   */
+  bool IsRecording()
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mRecording;
+  }
+
+private:
+  /**
+   * @copydoc Dali::FrameCallbackInterface::Update
+   */
+  void Update(Dali::UpdateProxy& /* updateProxy */, float /* elapsedSeconds */) override
+  {
+    const Clock::time_point now = Clock::now();
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    if(mRecording)
+    {
+      if(mLastFrame != Clock::time_point())
+      {
+        mFrameTimes.push_back(std::chrono::duration<float, std::milli>(now - mLastFrame).count());
+      }
+      mLastFrame = now;
+    }
+  }
+
+private:
+  std::mutex         mMutex;             ///< Guards the members below, which are shared between the event & update threads.
+  std::vector<float> mFrameTimes;        ///< Frame times in milliseconds.
+  Clock::time_point  mLastFrame;         ///< Time of the previous update, default constructed if there was none.
+  bool               mRecording{false}; ///< Whether frames are currently being recorded.
+};
+
+/**
+ * @brief A FrameCallbackInterface which timestamps the first frame updated after it was added.
+ *
+ * Added once a scene has been built, the time of that frame gives its time-to-first-frame. Poll HasFrame()
+ * from the event thread, e.g. with a Timer, then remove the callback with DevelStage::RemoveFrameCallback().
+ */
+class FirstFrameRecorder : public Dali::FrameCallbackInterface
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+  /**
+   * @brief Queries whether the first frame has been updated yet.
+   */
+  bool HasFrame()
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mHasFrame;
+  }
+
+  /**
+   * @brief Retrieves the time of the first frame, only valid once HasFrame() returns true.
+   */
+  Clock::time_point GetFrameTime()
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mFrameTime;
+  }
+
+private:
+  /**
+   * @copydoc Dali::FrameCallbackInterface::Update
+   */
+  void Update(Dali::UpdateProxy& /* updateProxy */, float /* elapsedSeconds */) override
+  {
+    const Clock::time_point now = Clock::now();
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    if(!mHasFrame)
+    {
+      mFrameTime = now;
+      mHasFrame  = true;
+    }
+  }
+
+private:
+  std::mutex        mMutex;           ///< Guards the members below, which are shared between the event & update threads.
+  Clock::time_point mFrameTime;       ///< Time of the first update.
+  bool              mHasFrame{false}; ///< Whether there has been an update.
+};
+
+/**
+ * @brief A FrameCallbackInterface which counts the frames updated since it was added.
+ *
+ * Lets the event thread tell whether a frame has gone by, e.g. to do no more than one slice of deferred work per frame.
+ */
+class FrameCounter : public Dali::FrameCallbackInterface
+{
+public:
+  /**
+   * @brief Retrieves the number of frames updated so far.
+   */
+  uint32_t GetFrameCount() const
+  {
+    return mFrameCount.load();
+  }
+
+private:
+  /**
+   * @copydoc Dali::FrameCallbackInterface::Update
+   */
+  void Update(Dali::UpdateProxy& /* updateProxy */, float /* elapsedSeconds */) override
+  {
+    ++mFrameCount;
+  }
+
+private:
+  std::atomic<uint32_t> mFrameCount{0u}; ///< Incremented on the update thread, read on the event thread.
+};
+
+} // namespace DemoHelper
+
+#endif // DALI_DEMO_FRAME_TIME_RECORDER_H
@@ -0,0 +1,356 @@
+#ifndef DALI_DEMO_JSON_STREAM_PARSER_H
+#define DALI_DEMO_JSON_STREAM_PARSER_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstring>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include "third-party/pico-json.h"
+
+namespace DemoHelper
+{
+/**
+ * @brief The location of a value within a JSON document: the object keys and array indices leading to it.
+ *
+ * Depth 0 is the outermost container, so the value of "count" in { "accessors": [ { "count": 3 } ] } is at
+ * a path of depth 3: key "accessors", index 0, key "count".
+ */
+class JsonPath
+{
+public:
+  /**
+   * @brief Retrieves the number of keys & indices in the path, 0 for the root value.
+   */
+  size_t GetDepth() const
+  {
+    return mDepth;
+  }
+
+  /**
+   * @brief Queries whether the element at the given depth is the given object key.
+   */
+  bool IsKey(size_t depth, const char* key) const
+  {
+    return depth < mDepth && !mElements[depth].isIndex && mElements[depth].key == key;
+  }
+
+  /**
+   * @brief Retrieves the object key at the given depth, empty for array elements.
+   */
+  const std::string& GetKey(size_t depth) const
+  {
+    return mElements[depth].key;
+  }
+
+  /**
+   * @brief Retrieves the array index at the given depth, 0 for object members.
+   */
+  size_t GetIndex(size_t depth) const
+  {
+    return mElements[depth].index;
+  }
+
+  /**
+   * @brief Retrieves the last key of the path, i.e. the name of the current value, empty for array elements.
+   */
+  const std::string& GetName() const
+  {
+    static const std::string EMPTY;
+    return mDepth ? mElements[mDepth - 1].key : EMPTY;
+  }
+
+  /**
+   * @brief Queries whether the path matches the given keys exactly.
+   *
+   * A nullptr matches any array index and "*" any object key, e.g. { "nodes", nullptr, "*" } matches every
+   * member of every object in the "nodes" array.
+   */
+  bool Matches(std::initializer_list<const char*> keys) const
+  {
+    if(keys.size() != mDepth)
+    {
+      return false;
+    }
+
+    size_t depth = 0u;
+    for(const char* key : keys)
+    {
+      const Element& element = mElements[depth];
+      if(key ? (element.isIndex || (strcmp(key, "*") != 0 && element.key != key)) : !element.isIndex)
+      {
+        return false;
+      }
+      ++depth;
+    }
+    return true;
+  }
+
+private:
+  template<typename Handler>
+  friend class JsonStreamContext;
+
+  void PushKey(const std::string& key)
+  {
+    Element& element = Push();
+    element.key      = key; // Reuses the string's capacity.
+    element.index    = 0u;
+    element.isIndex  = false;
+  }
+
+  void PushIndex(size_t index)
+  {
+    Element& element = Push();
+    element.key.clear();
+    element.index   = index;
+    element.isIndex = true;
+  }
+
+  void Pop()
+  {
+    --mDepth;
+  }
+
+  struct Element
+  {
+    std::string key;
+    size_t      index;
+    bool        isIndex;
+  };
+
+  Element& Push()
+  {
+    if(mDepth == mElements.size())
+    {
+      mElements.emplace_back();
+    }
+    return mElements[mDepth++];
+  }
+
+  std::vector<Element> mElements;  ///< The elements, only the first mDepth are in use so their strings are reused.
+  size_t               mDepth{0u}; ///< The current depth.
+};
+
+/**
+ * @brief Receives the values of a JSON document as ParseJsonStream() reads them, in document order.
+ *
+ * Nothing is built in memory: a handler copies what it needs straight into its own structures, so a
+ * loader never pays for a DOM it only walks once. Every callback can return false to abort parsing.
+ */
+class JsonStreamHandler
+{
+public:
+  virtual ~JsonStreamHandler() = default;
+
+  virtual bool OnNull(const JsonPath& /* path */)
+  {
+    return true;
+  }
+
+  virtual bool OnBool(const JsonPath& /* path */, bool /* value */)
+  {
+    return true;
+  }
+
+  virtual bool OnNumber(const JsonPath& /* path */, double /* value */)
+  {
+    return true;
+  }
+
+  /**
+   * @brief Called for each string; the value is only valid during the call.
+   */
+  virtual bool OnString(const JsonPath& /* path */, const std::string& /* value */)
+  {
+    return true;
+  }
+
+  virtual bool OnObjectStart(const JsonPath& /* path */)
+  {
+    return true;
+  }
+
+  virtual bool OnObjectEnd(const JsonPath& /* path */)
+  {
+    return true;
+  }
+
+  virtual bool OnArrayStart(const JsonPath& /* path */)
+  {
+    return true;
+  }
+
+  virtual bool OnArrayEnd(const JsonPath& /* path */, size_t /* count */)
+  {
+    return true;
+  }
+};
+
+/**
+ * @brief A picojson parse context which forwards the values to a JsonStreamHandler instead of building a picojson::value.
+ */
+template<typename Handler>
+class JsonStreamContext
+{
+public:
+  explicit JsonStreamContext(Handler& handler)
+  : mHandler(handler)
+  {
+  }
+
+  /**
+   * @brief Parses the JSON in [ begin, end ).
+   * @return An empty string on success, otherwise the error.
+   */
+  std::string Parse(const char* begin, const char* end)
+  {
+    std::string error;
+    picojson::_parse(*this, begin, end, &error);
+    if(error.empty() && mOpenObjects > 0u)
+    {
+      --mOpenObjects;
+      if(!mHandler.OnObjectEnd(mPath))
+      {
+        error = "aborted";
+      }
+    }
+    return error;
+  }
+
+  // picojson context interface
+
+  bool set_null()
+  {
+    return mHandler.OnNull(mPath);
+  }
+
+  bool set_bool(bool value)
+  {
+    return mHandler.OnBool(mPath, value);
+  }
+
+#ifdef PICOJSON_USE_INT64
+  bool set_int64(int64_t value)
+  {
+    return mHandler.OnNumber(mPath, static_cast<double>(value));
+  }
+#endif
+
+  bool set_number(double value)
+  {
+    return mHandler.OnNumber(mPath, value);
+  }
+
+  template<typename Iter>
+  bool parse_string(picojson::input<Iter>& in)
+  {
+    mString.clear(); // Reuses the capacity from the previous strings.
+    return picojson::_parse_string(mString, in) && mHandler.OnString(mPath, mString);
+  }
+
+  bool parse_array_start()
+  {
+    return mHandler.OnArrayStart(mPath);
+  }
+
+  template<typename Iter>
+  bool parse_array_item(picojson::input<Iter>& in, size_t index)
+  {
+    mPath.PushIndex(index);
+    const bool parsed = ParseValue(in);
+    mPath.Pop();
+    return parsed;
+  }
+
+  bool parse_array_stop(size_t count)
+  {
+    return mHandler.OnArrayEnd(mPath, count);
+  }
+
+  bool parse_object_start()
+  {
+    ++mOpenObjects;
+    return mHandler.OnObjectStart(mPath);
+  }
+
+  template<typename Iter>
+  bool parse_object_item(picojson::input<Iter>& in, const std::string& key)
+  {
+    mPath.PushKey(key);
+    const bool parsed = ParseValue(in);
+    mPath.Pop();
+    return parsed;
+  }
+
+private:
+  /**
+   * @brief Parses a value, then tells the handler if it was an object which has now ended.
+   *
+   * picojson has no callback for the end of an object, but once _parse() returns, any object it started is complete.
+   */
+  template<typename Iter>
+  bool ParseValue(picojson::input<Iter>& in)
+  {
+    const size_t openObjects = mOpenObjects;
+    if(!picojson::_parse(*this, in))
+    {
+      return false;
+    }
+
+    if(mOpenObjects > openObjects)
+    {
+      --mOpenObjects;
+      return mHandler.OnObjectEnd(mPath);
+    }
+    return true;
+  }
+
+private:
+  Handler&    mHandler;         ///< Receives the values.
+  JsonPath    mPath;            ///< The location of the current value.
+  std::string mString;          ///< Holds the current string value.
+  size_t      mOpenObjects{0u}; ///< The number of objects started and not yet ended.
+};
+
+/**
+ * @brief Parses the JSON in [ begin, end ), passing each value to the handler as it is read.
+ * @return An empty string on success, otherwise the error.
+ */
+template<typename Handler>
+std::string ParseJsonStream(const char* begin, const char* end, Handler& handler)
+{
+  JsonStreamContext<Handler> context(handler);
+  return context.Parse(begin, end);
+}
+
+/**
+ * @copydoc ParseJsonStream(const char*, const char*, Handler&)
+ */
+template<typename Handler>
+std::string ParseJsonStream(const std::string& json, Handler& handler)
+{
+  return ParseJsonStream(json.data(), json.data() + json.size(), handler);
+}
+
+} // namespace DemoHelper
+
+#endif // DALI_DEMO_JSON_STREAM_PARSER_H
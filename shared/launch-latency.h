@@ -0,0 +1,130 @@
+#ifndef DALI_DEMO_LAUNCH_LATENCY_H
+#define DALI_DEMO_LAUNCH_LATENCY_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/common/stage-devel.h>
+#include <dali/public-api/adaptor-framework/application.h>
+#include <dali/public-api/adaptor-framework/timer.h>
+#include <dali/public-api/common/stage.h>
+#include <dali/public-api/signals/connection-tracker.h>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+// INTERNAL INCLUDES
+#include "shared/frame-time-recorder.h"
+
+namespace DemoHelper
+{
+/**
+ * Environment variables through which a launcher started with --report-launch-latency tells the example it launches
+ * when & how it was launched. The launch time is a std::chrono::steady_clock time in nanoseconds, which is comparable
+ * between processes as the clock is system-wide (CLOCK_MONOTONIC on Linux).
+ */
+const char* const LAUNCH_TIME_VARIABLE    = "DALI_DEMO_LAUNCH_TIME";    ///< When the example's tile was pressed
+const char* const LAUNCH_EXAMPLE_VARIABLE = "DALI_DEMO_LAUNCH_EXAMPLE"; ///< The name of the example
+const char* const LAUNCH_MODE_VARIABLE    = "DALI_DEMO_LAUNCH_MODE";    ///< How the example was started, "exec" or "zygote"
+
+/**
+ * @brief Prints the time from an example's launch to its first frame as JSON, see ReportLaunchLatency().
+ */
+class LaunchLatencyReporter : public Dali::ConnectionTracker
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+  /**
+   * @brief Constructor.
+   *
+   * @param[in]  application  The example's application.
+   * @param[in]  launchTime   When the example was launched.
+   */
+  LaunchLatencyReporter(Dali::Application& application, Clock::time_point launchTime)
+  : mLaunchTime(launchTime)
+  {
+    application.InitSignal().Connect(this, &LaunchLatencyReporter::OnInit);
+  }
+
+private:
+  /**
+   * @brief Called once the example has created its scene; the first update from now on renders it.
+   */
+  void OnInit(Dali::Application& application)
+  {
+    Dali::DevelStage::AddFrameCallback(Dali::Stage::GetCurrent(), mFirstFrameRecorder, application.GetWindow().GetRootLayer());
+
+    mTimer = Dali::Timer::New(POLL_INTERVAL);
+    mTimer.TickSignal().Connect(this, &LaunchLatencyReporter::OnTimer);
+    mTimer.Start();
+  }
+
+  /**
+   * @brief Polls mFirstFrameRecorder and prints the report once the first frame has been updated.
+   */
+  bool OnTimer()
+  {
+    if(!mFirstFrameRecorder.HasFrame())
+    {
+      return true;
+    }
+    Dali::DevelStage::RemoveFrameCallback(Dali::Stage::GetCurrent(), mFirstFrameRecorder);
+
+    using Milliseconds = std::chrono::duration<float, std::milli>;
+
+    const char* example = getenv(LAUNCH_EXAMPLE_VARIABLE);
+    const char* mode    = getenv(LAUNCH_MODE_VARIABLE);
+    std::cout << "{ \"example\": \"" << (example ? example : "")
+              << "\", \"mode\": \"" << (mode ? mode : "")
+              << "\", \"tapToFirstFrameMs\": " << Milliseconds(mFirstFrameRecorder.GetFrameTime() - mLaunchTime).count()
+              << " }" << std::endl;
+    return false;
+  }
+
+private:
+  static constexpr unsigned int POLL_INTERVAL = 16u; ///< How often to check whether the first frame has been updated, in milliseconds
+
+  FirstFrameRecorder mFirstFrameRecorder; ///< Timestamps the first frame.
+  Dali::Timer        mTimer;              ///< Polls mFirstFrameRecorder.
+  Clock::time_point  mLaunchTime;         ///< When the example was launched.
+};
+
+/**
+ * @brief Prints the time from the example being launched to its first frame, if the launcher asked for it.
+ *
+ * Does nothing unless the example was launched by a launcher started with --report-launch-latency. Call it after
+ * the example's controller has connected to the InitSignal, i.e. just before MainLoop(), so the first frame measured
+ * is the one which renders the example's scene.
+ *
+ * @param[in]  application  The example's application.
+ */
+inline void ReportLaunchLatency(Dali::Application& application)
+{
+  const char* launchTime = getenv(LAUNCH_TIME_VARIABLE);
+  if(launchTime)
+  {
+    // Kept until the process exits, as the report may come at any time after the MainLoop() has started.
+    new LaunchLatencyReporter(application, LaunchLatencyReporter::Clock::time_point(std::chrono::nanoseconds(strtoll(launchTime, nullptr, 10))));
+  }
+}
+
+} // namespace DemoHelper
+
+#endif // DALI_DEMO_LAUNCH_LATENCY_H
@@ -0,0 +1,166 @@
+#ifndef DALI_DEMO_MEMORY_MAPPED_FILE_H
+#define DALI_DEMO_MEMORY_MAPPED_FILE_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/file-loader.h>
+#include <dali/public-api/common/dali-vector.h>
+#include <cstddef>
+#include <string>
+
+#if !defined(_WIN32) && !defined(ANDROID)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define DALI_DEMO_USE_MMAP 1
+#endif
+
+namespace DemoHelper
+{
+/**
+ * @brief A read-only view of a whole file.
+ *
+ * Where the platform allows it the file is memory-mapped, so its pages are only read in when they
+ * are touched and no copy is made. Otherwise (e.g. Windows or files packed in an Android APK), the
+ * file is read into memory with Dali::FileLoader, so callers can use the same code everywhere.
+ */
+class MemoryMappedFile
+{
+public:
+  MemoryMappedFile() = default;
+
+  /**
+   * @brief Opens the file at the given path.
+   * @see Open()
+   */
+  explicit MemoryMappedFile(const std::string& path)
+  {
+    Open(path);
+  }
+
+  ~MemoryMappedFile()
+  {
+    Close();
+  }
+
+  MemoryMappedFile(const MemoryMappedFile&) = delete;
+  MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+  /**
+   * @brief Maps the file at the given path, closing any previously opened file.
+   * @param[in]  path  The path of the file.
+   * @return Whether the file could be opened; an empty file counts as a failure.
+   */
+  bool Open(const std::string& path)
+  {
+    Close();
+
+#ifdef DALI_DEMO_USE_MMAP
+    int fd = open(path.c_str(), O_RDONLY);
+    if(fd >= 0)
+    {
+      struct stat fileStatus;
+      if(fstat(fd, &fileStatus) == 0 && fileStatus.st_size > 0)
+      {
+        void* mapping = mmap(nullptr, static_cast<size_t>(fileStatus.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if(mapping != MAP_FAILED)
+        {
+          mMapping = mapping;
+          mData    = static_cast<const char*>(mapping);
+          mSize    = static_cast<size_t>(fileStatus.st_size);
+        }
+      }
+      close(fd); // The mapping stays valid once the descriptor is closed.
+
+      if(mMapping)
+      {
+        return true;
+      }
+    }
+#endif
+
+    std::streampos fileSize;
+    if(Dali::FileLoader::ReadFile(path, fileSize, mBuffer, Dali::FileLoader::BINARY) && fileSize > 0)
+    {
+      mData = mBuffer.Begin();
+      mSize = static_cast<size_t>(fileSize);
+      return true;
+    }
+
+    mBuffer.Clear();
+    return false;
+  }
+
+  /**
+   * @brief Unmaps the file.
+   */
+  void Close()
+  {
+#ifdef DALI_DEMO_USE_MMAP
+    if(mMapping)
+    {
+      munmap(mMapping, mSize);
+      mMapping = nullptr;
+    }
+#endif
+    mBuffer.Clear();
+    mData = nullptr;
+    mSize = 0u;
+  }
+
+  /**
+   * @brief Retrieves the contents of the file, nullptr if no file is open.
+   */
+  const char* GetData() const
+  {
+    return mData;
+  }
+
+  /**
+   * @brief Retrieves the size of the file in bytes.
+   */
+  size_t GetSize() const
+  {
+    return mSize;
+  }
+
+  /**
+   * @brief Whether the file is mapped rather than copied into memory.
+   */
+  bool IsMapped() const
+  {
+    return mMapping != nullptr;
+  }
+
+  explicit operator bool() const
+  {
+    return mData != nullptr;
+  }
+
+private:
+  void*              mMapping{nullptr}; ///< The start of the mapping, nullptr if the file was read into mBuffer instead.
+  const char*        mData{nullptr};    ///< The contents of the file.
+  size_t             mSize{0u};         ///< The size of the file in bytes.
+  Dali::Vector<char> mBuffer;           ///< Holds the contents when the file could not be mapped.
+};
+
+} // namespace DemoHelper
+
+#endif // DALI_DEMO_MEMORY_MAPPED_FILE_H
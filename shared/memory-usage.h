@@ -0,0 +1,156 @@
+#ifndef DALI_DEMO_MEMORY_USAGE_H
+#define DALI_DEMO_MEMORY_USAGE_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace DemoHelper
+{
+/**
+ * @brief The memory used by the process, all values in kilobytes.
+ */
+struct MemoryUsage
+{
+  bool     valid{false};     ///< Whether the values could be read; only on Linux.
+  uint64_t rss{0u};          ///< Resident set size.
+  uint64_t rssAnonymous{0u}; ///< The part of the resident set which is anonymous memory, i.e. the heap.
+  uint64_t graphics{0u};     ///< Resident memory mapped from the graphics driver, e.g. textures on unified memory.
+};
+
+/**
+ * @brief Samples the memory used by the calling process.
+ *
+ * The resident set is read from /proc/self/status. The graphics memory is the resident size of the mappings of
+ * the GPU device files in /proc/self/smaps, which is where drivers on unified memory architectures account for
+ * textures & buffers; it is zero for drivers which do not map them into the process.
+ */
+inline MemoryUsage SampleMemoryUsage()
+{
+  MemoryUsage usage;
+#ifdef __linux__
+  if(FILE* status = fopen("/proc/self/status", "r"))
+  {
+    char               line[256];
+    unsigned long long value;
+    while(fgets(line, sizeof(line), status))
+    {
+      if(sscanf(line, "VmRSS: %llu kB", &value) == 1)
+      {
+        usage.rss   = value;
+        usage.valid = true;
+      }
+      else if(sscanf(line, "RssAnon: %llu kB", &value) == 1)
+      {
+        usage.rssAnonymous = value;
+      }
+    }
+    fclose(status);
+  }
+
+  if(FILE* smaps = fopen("/proc/self/smaps", "r"))
+  {
+    static const char* const GRAPHICS_DEVICES[] = {"/dev/dri/", "/dev/mali", "/dev/kgsl", "/dev/nvidia", "/dev/pvr"};
+
+    char               line[512];
+    bool               graphicsMapping = false;
+    unsigned long long value;
+    while(fgets(line, sizeof(line), smaps))
+    {
+      // Mapping headers start with the address range, e.g. "7f0000000000-7f0000001000 rw-s 00000000 00:05 42 /dev/mali0"
+      char* separator = strchr(line, ' ');
+      if(separator && separator != line && separator[-1] != ':' && strchr(line, '-') < separator)
+      {
+        graphicsMapping = false;
+        for(const char* device : GRAPHICS_DEVICES)
+        {
+          graphicsMapping = graphicsMapping || strstr(line, device);
+        }
+      }
+      else if(graphicsMapping && sscanf(line, "Rss: %llu kB", &value) == 1)
+      {
+        usage.graphics += value;
+      }
+    }
+    fclose(smaps);
+  }
+#endif
+  return usage;
+}
+
+/**
+ * @brief The least squares fit of memory against a count, e.g. of the objects created.
+ */
+struct MemoryFit
+{
+  double perItem{0.0}; ///< The slope: the memory used by each item, in kilobytes.
+  double fixed{0.0};   ///< The intercept less the first sample: the memory used once, e.g. by caches, in kilobytes.
+};
+
+/**
+ * @brief Fits memory samples taken after creating increasing numbers of items.
+ *
+ * Fitting a line rather than dividing the total by the count separates the one-off costs, e.g. loading a font,
+ * from the cost of each item.
+ *
+ * @param[in]  counts   The number of items at each sample, the first usually 0.
+ * @param[in]  samples  The memory at each sample, in kilobytes.
+ * @return The fit, zero unless there are at least two different counts.
+ */
+inline MemoryFit FitMemoryUsage(const std::vector<double>& counts, const std::vector<double>& samples)
+{
+  MemoryFit    fit;
+  const size_t size = std::min(counts.size(), samples.size());
+  if(size < 2u)
+  {
+    return fit;
+  }
+
+  double meanCount = 0.0;
+  double meanValue = 0.0;
+  for(size_t i = 0u; i < size; ++i)
+  {
+    meanCount += counts[i];
+    meanValue += samples[i];
+  }
+  meanCount /= size;
+  meanValue /= size;
+
+  double covariance = 0.0;
+  double variance   = 0.0;
+  for(size_t i = 0u; i < size; ++i)
+  {
+    covariance += (counts[i] - meanCount) * (samples[i] - meanValue);
+    variance += (counts[i] - meanCount) * (counts[i] - meanCount);
+  }
+  if(variance > 0.0)
+  {
+    fit.perItem = covariance / variance;
+    fit.fixed   = meanValue - fit.perItem * meanCount - samples[0];
+  }
+  return fit;
+}
+
+} // namespace DemoHelper
+
+#endif // DALI_DEMO_MEMORY_USAGE_H
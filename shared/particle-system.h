@@ -0,0 +1,318 @@
+#ifndef DALI_DEMO_PARTICLE_SYSTEM_H
+#define DALI_DEMO_PARTICLE_SYSTEM_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/images/pixel-data.h>
+#include <dali/public-api/math/vector3.h>
+#include <dali/public-api/object/property-map.h>
+#include <dali/public-api/rendering/geometry.h>
+#include <dali/public-api/rendering/renderer.h>
+#include <dali/public-api/rendering/sampler.h>
+#include <dali/public-api/rendering/shader.h>
+#include <dali/public-api/rendering/texture-set.h>
+#include <dali/public-api/rendering/texture.h>
+#include <dali/public-api/rendering/vertex-buffer.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace DemoHelper
+{
+/**
+ * @brief Draws up to a fixed number of particles with a single renderer, keeping the state of each particle in
+ * an RGB32F texture which the vertex shader reads with texelFetch(), rather than in uniform arrays.
+ *
+ * DALi has no instanced draw call, so the geometry is a quad per particle, holding only the particle's index
+ * and the corner of the quad; it is created once for the capacity and never changes. The number of particles
+ * drawn is a uniform, so changing it does not touch the geometry either, and neither does updating the state
+ * of some particles: SetState() then Flush() uploads the texture rows which have changed.
+ *
+ * Particles which are continuously emitted & respawned should derive their life from a time uniform, see
+ * ParticleLife() below, so that the shader respawns them without any work on the CPU.
+ *
+ * The vertex shader is the source returned by GetVertexShaderPrologue() followed by the caller's main(),
+ * which can use:
+ *   int   ParticleIndex();            The index of the particle.
+ *   vec2  ParticleCorner();           The corner of the particle's quad, each component -1 or 1.
+ *   bool  IsParticleVisible();        Whether the particle is within the particle count.
+ *   vec3  ParticleState(int row);     A row of the particle's state, as set with SetState().
+ *   float ParticleHash(float seed);   A pseudo random number in [0, 1).
+ *   vec2  ParticleLife(float time, float emitTime, float lifetime);
+ *                                     The age of a continuously respawned particle through its current
+ *                                     life, in [0, 1), and the number of that life, e.g. as a hash seed.
+ * Both shaders must be GLSL ES 3.00; the state texture is sParticleState, the first sampler.
+ */
+class ParticleSystem
+{
+public:
+  static constexpr uint32_t MAX_CAPACITY        = 16384u; ///< The most particles that 16 bit indices can address.
+  static constexpr uint32_t STATE_TEXTURE_WIDTH = 1024u;  ///< The most particles per row of the state texture.
+
+  /**
+   * @brief Constructor.
+   *
+   * @param[in]  capacity   The most particles that can be drawn, up to MAX_CAPACITY.
+   * @param[in]  stateRows  The number of vec3 of state of each particle.
+   */
+  ParticleSystem(uint32_t capacity, uint32_t stateRows)
+  : mCapacity(std::min(std::max(capacity, 1u), MAX_CAPACITY)),
+    mStateRows(std::max(stateRows, 1u)),
+    mColumns(std::min(mCapacity, STATE_TEXTURE_WIDTH)),
+    mTextureHeight((mCapacity + mColumns - 1u) / mColumns * mStateRows),
+    mState(mColumns * mTextureHeight * 3u, 0.0f),
+    mParticleCount(mCapacity)
+  {
+  }
+
+  /**
+   * @brief Retrieves the start of the vertex shader, which declares the attribute & the functions above.
+   */
+  std::string GetVertexShaderPrologue() const
+  {
+    // clang-format off
+    std::ostringstream stream;
+    stream << "#version 300 es\n"
+           << "#define PARTICLE_STATE_ROWS " << mStateRows << "\n"
+           << "#define PARTICLE_STATE_COLUMNS " << mColumns << "\n"
+           << DALI_COMPOSE_SHADER(
+      precision highp float;\n
+      \n
+      in vec3 aParticle;\n // corner.xy, index
+      uniform highp sampler2D sParticleState;\n
+      uniform float uParticleCount;\n
+      \n
+      int ParticleIndex()\n
+      {\n
+        return int(aParticle.z);\n
+      }\n
+      \n
+      vec2 ParticleCorner()\n
+      {\n
+        return aParticle.xy;\n
+      }\n
+      \n
+      bool IsParticleVisible()\n
+      {\n
+        return aParticle.z < uParticleCount;\n
+      }\n
+      \n
+      vec3 ParticleState(int row)\n
+      {\n
+        int index = ParticleIndex();\n
+        return texelFetch(sParticleState, ivec2(index % PARTICLE_STATE_COLUMNS, (index / PARTICLE_STATE_COLUMNS) * PARTICLE_STATE_ROWS + row), 0).xyz;\n
+      }\n
+      \n
+      float ParticleHash(float seed)\n
+      {\n
+        return fract(sin(seed * 12.9898) * 43758.5453);\n
+      }\n
+      \n
+      vec2 ParticleLife(float time, float emitTime, float lifetime)\n
+      {\n
+        float lives = max(time - emitTime, 0.0) / lifetime;\n
+        return vec2(fract(lives), floor(lives));\n
+      }\n
+    );
+    // clang-format on
+    return stream.str();
+  }
+
+  /**
+   * @brief Creates the renderer which draws the particles with the given shader.
+   *
+   * The renderer's texture set holds the state texture at index 0; further textures go after it.
+   *
+   * @param[in]  shader  The shader, whose vertex shader starts with GetVertexShaderPrologue().
+   * @return The renderer, which is only created once.
+   */
+  Dali::Renderer CreateRenderer(Dali::Shader shader)
+  {
+    if(!mRenderer)
+    {
+      mStateTexture = Dali::Texture::New(Dali::TextureType::TEXTURE_2D, Dali::Pixel::RGB32F, mColumns, mTextureHeight);
+      mDirtyBegin   = 0u;
+      mDirtyEnd     = mTextureHeight;
+      Flush();
+
+      Dali::Sampler sampler = Dali::Sampler::New();
+      sampler.SetFilterMode(Dali::FilterMode::NEAREST, Dali::FilterMode::NEAREST);
+
+      Dali::TextureSet textureSet = Dali::TextureSet::New();
+      textureSet.SetTexture(0u, mStateTexture);
+      textureSet.SetSampler(0u, sampler);
+
+      mRenderer = Dali::Renderer::New(CreateGeometry(), shader);
+      mRenderer.SetTextures(textureSet);
+      mParticleCountIndex = mRenderer.RegisterProperty("uParticleCount", static_cast<float>(mParticleCount));
+    }
+    return mRenderer;
+  }
+
+  /**
+   * @brief Sets a row of a particle's state, which is uploaded by the next Flush().
+   */
+  void SetState(uint32_t particle, uint32_t row, const Dali::Vector3& value)
+  {
+    if(particle < mCapacity && row < mStateRows)
+    {
+      const uint32_t y = particle / mColumns * mStateRows + row;
+      std::copy(value.AsFloat(), value.AsFloat() + 3u, &mState[(y * mColumns + particle % mColumns) * 3u]);
+
+      mDirtyBegin = std::min(mDirtyBegin, y);
+      mDirtyEnd   = std::max(mDirtyEnd, y + 1u);
+    }
+  }
+
+  /**
+   * @brief Retrieves a row of a particle's state, as last set.
+   */
+  Dali::Vector3 GetState(uint32_t particle, uint32_t row) const
+  {
+    if(particle < mCapacity && row < mStateRows)
+    {
+      const uint32_t y = particle / mColumns * mStateRows + row;
+      return Dali::Vector3(&mState[(y * mColumns + particle % mColumns) * 3u]);
+    }
+    return Dali::Vector3::ZERO;
+  }
+
+  /**
+   * @brief Uploads the rows of the state texture that have been changed since the last Flush().
+   *
+   * Does nothing until the renderer has been created.
+   */
+  void Flush()
+  {
+    if(!mStateTexture || mDirtyBegin >= mDirtyEnd)
+    {
+      return;
+    }
+
+    const uint32_t height = mDirtyEnd - mDirtyBegin;
+    const uint32_t size   = mColumns * height * 3u * sizeof(float);
+    uint8_t*       buffer = new uint8_t[size];
+    memcpy(buffer, &mState[mDirtyBegin * mColumns * 3u], size);
+
+    Dali::PixelData pixelData = Dali::PixelData::New(buffer, size, mColumns, height, Dali::Pixel::RGB32F, Dali::PixelData::ReleaseFunction::DELETE_ARRAY);
+    mStateTexture.Upload(pixelData, 0u, 0u, 0u, mDirtyBegin, mColumns, height);
+
+    mDirtyBegin = std::numeric_limits<uint32_t>::max();
+    mDirtyEnd   = 0u;
+  }
+
+  /**
+   * @brief Sets the number of particles drawn, the first count of them; does not change the geometry.
+   */
+  void SetParticleCount(uint32_t count)
+  {
+    mParticleCount = std::min(count, mCapacity);
+    if(mRenderer)
+    {
+      mRenderer.SetProperty(mParticleCountIndex, static_cast<float>(mParticleCount));
+    }
+  }
+
+  /**
+   * @brief Retrieves the number of particles drawn.
+   */
+  uint32_t GetParticleCount() const
+  {
+    return mParticleCount;
+  }
+
+  /**
+   * @brief Retrieves the most particles that can be drawn.
+   */
+  uint32_t GetCapacity() const
+  {
+    return mCapacity;
+  }
+
+private:
+  /**
+   * @brief Creates two triangles per particle, each vertex holding the corner of its quad & the particle index.
+   *
+   *  (-1,-1)---(1,-1)
+   *     |\       |
+   *     |  \     |
+   *     |    \   |
+   *     |      \ |
+   *  (-1, 1)---(1, 1)
+   */
+  Dali::Geometry CreateGeometry() const
+  {
+    std::vector<Dali::Vector3>  vertices;
+    std::vector<unsigned short> indices;
+    vertices.reserve(mCapacity * 4u);
+    indices.reserve(mCapacity * 6u);
+
+    for(uint32_t i = 0u; i < mCapacity; ++i)
+    {
+      const float          index = static_cast<float>(i);
+      const unsigned short first = static_cast<unsigned short>(vertices.size());
+
+      vertices.push_back(Dali::Vector3(-1.0f, -1.0f, index));
+      vertices.push_back(Dali::Vector3(-1.0f, 1.0f, index));
+      vertices.push_back(Dali::Vector3(1.0f, 1.0f, index));
+      vertices.push_back(Dali::Vector3(1.0f, -1.0f, index));
+
+      const unsigned short quad[] = {0u, 1u, 2u, 0u, 2u, 3u};
+      for(unsigned short offset : quad)
+      {
+        indices.push_back(first + offset);
+      }
+    }
+
+    Dali::Property::Map vertexFormat;
+    vertexFormat["aParticle"] = Dali::Property::VECTOR3;
+
+    Dali::VertexBuffer vertexBuffer = Dali::VertexBuffer::New(vertexFormat);
+    vertexBuffer.SetData(vertices.data(), vertices.size());
+
+    Dali::Geometry geometry = Dali::Geometry::New();
+    geometry.AddVertexBuffer(vertexBuffer);
+    geometry.SetIndexBuffer(indices.data(), indices.size());
+    geometry.SetType(Dali::Geometry::TRIANGLES);
+    return geometry;
+  }
+
+private:
+  const uint32_t mCapacity;      ///< The most particles that can be drawn.
+  const uint32_t mStateRows;     ///< The rows of state per particle.
+  const uint32_t mColumns;       ///< The width of the state texture, in particles.
+  const uint32_t mTextureHeight; ///< The height of the state texture.
+
+  std::vector<float> mState;                                            ///< The contents of the state texture.
+  uint32_t           mDirtyBegin{std::numeric_limits<uint32_t>::max()}; ///< The first texture row changed since the last Flush().
+  uint32_t           mDirtyEnd{0u};                                     ///< One past the last texture row changed since the last Flush().
+  uint32_t           mParticleCount;                                    ///< The number of particles drawn.
+
+  Dali::Texture         mStateTexture;         ///< The particles' state, one column per particle.
+  Dali::Renderer        mRenderer;             ///< Draws the particles.
+  Dali::Property::Index mParticleCountIndex{}; ///< The index of the renderer's uParticleCount property.
+};
+
+} // namespace DemoHelper
+
+#endif // DALI_DEMO_PARTICLE_SYSTEM_H
@@ -0,0 +1,182 @@
+#ifndef DALI_DEMO_POOLED_ITEM_FACTORY_H
+#define DALI_DEMO_POOLED_ITEM_FACTORY_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali-toolkit/public-api/controls/scrollable/item-view/item-factory.h>
+#include <dali/public-api/actors/actor.h>
+#include <dali/public-api/math/quaternion.h>
+#include <dali/public-api/math/vector3.h>
+#include <dali/public-api/math/vector4.h>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+namespace DemoHelper
+{
+/**
+ * @brief An ItemFactory which keeps the actors of the items an ItemView releases, e.g. when they scroll
+ * out of view, and reuses them for the items it asks for next.
+ *
+ * Instead of NewItem(), derived classes implement CreateItem(), which builds the parts of an item's actor
+ * which are the same for every item of a type, and BindItem(), which sets only what depends on the item,
+ * e.g. its text or image. Items with different actor trees are given different types by GetItemType().
+ */
+class PooledItemFactory : public Dali::Toolkit::ItemFactory
+{
+public:
+  /**
+   * @brief How often the pool could be used.
+   */
+  struct Statistics
+  {
+    unsigned int hits{0u};      ///< The items bound to a pooled actor
+    unsigned int misses{0u};    ///< The items for which an actor had to be created
+    unsigned int released{0u};  ///< The actors returned to the pool
+    unsigned int discarded{0u}; ///< The actors released when their pool was full, which were destroyed
+  };
+
+  /**
+   * @brief Creates the factory with empty pools.
+   * @param[in]  maximumPooled  The most actors kept for each type; more than a screenful is not needed.
+   */
+  explicit PooledItemFactory(unsigned int maximumPooled = 64u)
+  : mMaximumPooled(maximumPooled)
+  {
+  }
+
+  /**
+   * @brief Retrieves the counters since the factory was created or the last ResetStatistics().
+   */
+  const Statistics& GetStatistics() const
+  {
+    return mStatistics;
+  }
+
+  void ResetStatistics()
+  {
+    mStatistics = Statistics();
+  }
+
+  /**
+   * @brief Destroys the pooled actors, e.g. once the view is gone.
+   */
+  void ClearPool()
+  {
+    mPools.clear();
+  }
+
+public: // From ItemFactory
+  Dali::Actor NewItem(unsigned int itemId) override
+  {
+    const unsigned int        type = GetItemType(itemId);
+    std::vector<Dali::Actor>& pool = mPools[type];
+
+    Dali::Actor actor;
+    if(!pool.empty())
+    {
+      actor = pool.back();
+      pool.pop_back();
+      ++mStatistics.hits;
+    }
+    else
+    {
+      actor = CreateItem(type);
+      ++mStatistics.misses;
+    }
+
+    mLiveTypes[actor.GetProperty<int>(Dali::Actor::Property::ID)] = type;
+    BindItem(itemId, actor);
+    return actor;
+  }
+
+  void ItemReleased(unsigned int itemId, Dali::Actor actor) override
+  {
+    // The item's type is looked up from its actor as the item may have been replaced since it was created.
+    auto live = mLiveTypes.find(actor.GetProperty<int>(Dali::Actor::Property::ID));
+    if(live == mLiveTypes.end())
+    {
+      return; // Not created by this factory, e.g. inserted into the view directly.
+    }
+
+    std::vector<Dali::Actor>& pool = mPools[live->second];
+    mLiveTypes.erase(live);
+
+    if(pool.size() < mMaximumPooled)
+    {
+      actor.Unparent();
+      ResetLayout(actor);
+      pool.push_back(actor);
+      ++mStatistics.released;
+    }
+    else
+    {
+      ++mStatistics.discarded;
+    }
+  }
+
+protected:
+  /**
+   * @brief Retrieves the type of an item; items of the same type share their pooled actors.
+   */
+  virtual unsigned int GetItemType(unsigned int itemId)
+  {
+    return 0u;
+  }
+
+  /**
+   * @brief Creates the actor for an item of the given type, without anything specific to an item.
+   */
+  virtual Dali::Actor CreateItem(unsigned int type) = 0;
+
+  /**
+   * @brief Updates a new or pooled actor to show the given item.
+   *
+   * Pooled actors keep whatever was set on them for their previous item, apart from the layout ItemView
+   * applies, so everything else which differs between items (including transient state such as a
+   * selection) has to be set.
+   */
+  virtual void BindItem(unsigned int itemId, Dali::Actor actor) = 0;
+
+private:
+  /**
+   * @brief Removes what ItemView set on an item's actor, so a reused actor does not keep the layout
+   * constraints bound to its previous item on top of those ItemView applies for its new one.
+   */
+  static void ResetLayout(Dali::Actor actor)
+  {
+    actor.RemoveConstraints();
+    actor.SetProperty(Dali::Actor::Property::POSITION, Dali::Vector3::ZERO);
+    actor.SetProperty(Dali::Actor::Property::SIZE, Dali::Vector3::ZERO);
+    actor.SetProperty(Dali::Actor::Property::ORIENTATION, Dali::Quaternion::IDENTITY);
+    actor.SetProperty(Dali::Actor::Property::SCALE, Dali::Vector3::ONE);
+    actor.SetProperty(Dali::Actor::Property::COLOR, Dali::Vector4::ONE);
+    actor.SetProperty(Dali::Actor::Property::VISIBLE, true);
+  }
+
+private:
+  std::map<unsigned int, std::vector<Dali::Actor>> mPools;         ///< The released actors, by type
+  std::unordered_map<int, unsigned int>            mLiveTypes;     ///< The type of each actor handed out, by actor ID
+  Statistics                                       mStatistics;    ///< The pool's counters
+  unsigned int                                     mMaximumPooled; ///< The most actors kept for each type
+};
+
+} // namespace DemoHelper
+
+#endif // DALI_DEMO_POOLED_ITEM_FACTORY_H
@@ -0,0 +1,95 @@
+#ifndef DALI_DEMO_SHADER_CACHE_H
+#define DALI_DEMO_SHADER_CACHE_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/object/property-map.h>
+#include <dali/public-api/rendering/shader.h>
+#include <string>
+#include <unordered_map>
+
+namespace DemoHelper
+{
+/**
+ * @brief Hands out one Shader (or visual shader map) per effect, so that everything drawn with the same
+ * effect shares it instead of creating and compiling its own.
+ *
+ * The cache holds handles, so it has to be owned by something destroyed before the Application, e.g. the
+ * example's controller, rather than be a global.
+ */
+class ShaderCache
+{
+public:
+  /**
+   * @brief Retrieves the shader for the given effect, creating it from the given sources on first use.
+   *
+   * @param[in]  effect          The name of the effect, which identifies the shader in the cache.
+   * @param[in]  vertexShader    The vertex shader source, only used if the shader is not cached yet.
+   * @param[in]  fragmentShader  The fragment shader source, only used if the shader is not cached yet.
+   * @param[in]  hints           The hints for the shader, only used if the shader is not cached yet.
+   * @return The shader.
+   */
+  Dali::Shader Get(const std::string& effect, const char* vertexShader, const char* fragmentShader, Dali::Shader::Hint::Value hints = Dali::Shader::Hint::NONE)
+  {
+    Dali::Shader& shader = mShaders[effect];
+    if(!shader)
+    {
+      shader = Dali::Shader::New(vertexShader, fragmentShader, hints);
+    }
+    return shader;
+  }
+
+  /**
+   * @brief Retrieves the shader map for the given visual effect, creating it on first use.
+   *
+   * For effects which are passed to a visual as its Toolkit::Visual::Property::SHADER, e.g.
+   * Toolkit::CreateDistanceFieldEffect().
+   *
+   * @param[in]  effect  The name of the effect, which identifies the map in the cache.
+   * @param[in]  create  Called with no arguments to create the map if it is not cached yet.
+   * @return The map, valid until the cache is cleared or destroyed.
+   */
+  template<typename Create>
+  const Dali::Property::Map& GetShaderMap(const std::string& effect, Create create)
+  {
+    auto iter = mShaderMaps.find(effect);
+    if(iter == mShaderMaps.end())
+    {
+      iter = mShaderMaps.emplace(effect, create()).first;
+    }
+    return iter->second;
+  }
+
+  /**
+   * @brief Releases all the cached shaders & maps.
+   */
+  void Clear()
+  {
+    mShaders.clear();
+    mShaderMaps.clear();
+  }
+
+private:
+  std::unordered_map<std::string, Dali::Shader>        mShaders;    ///< The shaders, by effect.
+  std::unordered_map<std::string, Dali::Property::Map> mShaderMaps; ///< The visual shader maps, by effect.
+};
+
+} // namespace DemoHelper
+
+#endif // DALI_DEMO_SHADER_CACHE_H
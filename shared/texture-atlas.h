@@ -0,0 +1,548 @@
+#ifndef DALI_DEMO_TEXTURE_ATLAS_H
+#define DALI_DEMO_TEXTURE_ATLAS_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/image-loading.h>
+#include <dali/devel-api/adaptor-framework/pixel-buffer.h>
+#include <dali/integration-api/debug.h>
+#include <dali/public-api/images/pixel.h>
+#include <dali/public-api/math/vector4.h>
+#include <dali/public-api/rendering/texture.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include "shared/cache-directory.h"
+#include "shared/memory-mapped-file.h"
+
+namespace DemoHelper
+{
+/**
+ * @brief Packs a set of images into as few textures ("pages") as possible, so that whatever draws them
+ * can share one texture set and, with a suitable geometry, one draw call.
+ *
+ * Images are added by path then packed together by Build(). The packed pages can be cached on disk, in
+ * which case a later Build() with the same, unmodified images maps the cache instead of decoding them.
+ */
+class TextureAtlas
+{
+public:
+  /**
+   * @brief Where an image was placed.
+   */
+  struct Region
+  {
+    unsigned int  page{0u};      ///< The index of the page holding the image
+    Dali::Vector4 textureRect{}; ///< The image's texture coordinates within the page as ( left, top, right, bottom )
+    unsigned int  width{0u};     ///< The width of the image in pixels
+    unsigned int  height{0u};    ///< The height of the image in pixels
+  };
+
+  /**
+   * @brief Creates an empty atlas.
+   * @param[in]  pageSize  The maximum width & height of a page; larger images get a page of their own.
+   * @param[in]  padding   The transparent pixels left between the images, so filtering never mixes neighbours.
+   */
+  explicit TextureAtlas(unsigned int pageSize = 1024u, unsigned int padding = 2u)
+  : mPageSize(pageSize),
+    mPadding(padding)
+  {
+  }
+
+  /**
+   * @brief Adds an image to be packed by the next Build(); adding the same path twice has no effect.
+   */
+  void Add(const std::string& path)
+  {
+    if(FindImage(path) == mImages.end())
+    {
+      Image image;
+      image.path = path;
+      mImages.push_back(std::move(image));
+    }
+  }
+
+  /**
+   * @brief Packs the added images and uploads the pages.
+   *
+   * Images which fail to load are logged and left out, GetRegion() returns false for them.
+   *
+   * @param[in]  cacheName  If not empty, the name under which the packed pages are cached on disk.
+   * @return Whether any image was packed.
+   */
+  bool Build(const std::string& cacheName = std::string())
+  {
+    mTextures.clear();
+    mIsFromCache = false;
+
+    const std::string cachePath = cacheName.empty() ? cacheName : GetCachePath(cacheName);
+    std::vector<Page> pages;
+    if(!cachePath.empty() && LoadCache(cachePath, pages))
+    {
+      mIsFromCache = true;
+    }
+    else
+    {
+      Pack(pages);
+      if(!cachePath.empty() && !pages.empty() && !StoreCache(cachePath, pages))
+      {
+        DALI_LOG_ERROR("Unable to cache the texture atlas in %s\n", cachePath.c_str());
+      }
+    }
+
+    for(auto& page : pages)
+    {
+      Dali::Texture texture = Dali::Texture::New(Dali::TextureType::TEXTURE_2D, page.pixels.GetPixelFormat(), page.pixels.GetWidth(), page.pixels.GetHeight());
+      texture.Upload(Dali::Devel::PixelBuffer::Convert(page.pixels));
+      mTextures.push_back(texture);
+    }
+    return !mTextures.empty();
+  }
+
+  /**
+   * @brief Retrieves where the image with the given path was placed by Build().
+   * @return Whether the image is in the atlas.
+   */
+  bool GetRegion(const std::string& path, Region& region) const
+  {
+    auto image = std::find_if(mImages.begin(), mImages.end(), [&path](const Image& image) { return image.path == path; });
+    if(image == mImages.end() || !image->packed)
+    {
+      return false;
+    }
+    region = image->region;
+    return true;
+  }
+
+  /**
+   * @brief Retrieves the number of pages created by Build().
+   */
+  unsigned int GetPageCount() const
+  {
+    return static_cast<unsigned int>(mTextures.size());
+  }
+
+  /**
+   * @brief Retrieves the texture of the given page.
+   */
+  Dali::Texture GetTexture(unsigned int page) const
+  {
+    return page < mTextures.size() ? mTextures[page] : Dali::Texture();
+  }
+
+  /**
+   * @brief Queries whether the last Build() used the on-disk cache rather than decoding the images.
+   */
+  bool IsFromCache() const
+  {
+    return mIsFromCache;
+  }
+
+private:
+  struct Image
+  {
+    std::string  path;
+    Region       region;
+    unsigned int x{0u};
+    unsigned int y{0u};
+    bool         packed{false};
+  };
+
+  struct Page
+  {
+    Dali::Devel::PixelBuffer pixels;
+  };
+
+  /**
+   * @brief Header of a cached atlas, followed by an AtlasCacheImage (and its path) per image then an
+   * AtlasCachePage (and its pixels) per page. As with the other demo caches, it is in native byte order.
+   */
+  struct AtlasCacheHeader
+  {
+    uint32_t tag;        ///< 'DATL' tag, also used to reject files written with a different byte order
+    uint32_t version;    ///< File version
+    uint32_t pageSize;   ///< The page size the atlas was packed with
+    uint32_t padding;    ///< The padding the atlas was packed with
+    uint32_t imageCount; ///< Number of images, in the order they were added
+    uint32_t pageCount;  ///< Number of pages
+  };
+
+  struct AtlasCacheImage
+  {
+    uint64_t sourceSize;         ///< Size of the image file, 0 if it does not exist
+    int64_t  sourceModifiedTime; ///< Modification time of the image file in nanoseconds, 0 if it does not exist
+    uint32_t pathLength;         ///< Length of the path stored after this, padded to 4 bytes
+    uint32_t page;               ///< The page holding the image, ~0 if the image failed to load
+    uint32_t x;                  ///< The position & size of the image within its page
+    uint32_t y;
+    uint32_t width;
+    uint32_t height;
+  };
+
+  struct AtlasCachePage
+  {
+    uint32_t format; ///< The Dali::Pixel::Format of the page
+    uint32_t width;
+    uint32_t height;
+    uint32_t size; ///< Size of the pixels stored after this, padded to 4 bytes
+  };
+
+  static constexpr uint32_t ATLAS_CACHE_TAG     = 0x4C544144; // 'DATL' in the native byte order
+  static constexpr uint32_t ATLAS_CACHE_VERSION = 2u;
+  static constexpr uint32_t NOT_PACKED          = ~0u;
+
+  static uint32_t AlignTo4(uint32_t offset)
+  {
+    return (offset + 3u) & ~3u;
+  }
+
+  std::vector<Image>::iterator FindImage(const std::string& path)
+  {
+    return std::find_if(mImages.begin(), mImages.end(), [&path](const Image& image) { return image.path == path; });
+  }
+
+  /**
+   * @brief Sets an image's texture coordinates from its position within the given page.
+   */
+  static void SetTextureRect(Image& image, const Page& page)
+  {
+    // Keep half a texel inside the image so that linear filtering never reaches the padding.
+    const float width  = static_cast<float>(page.pixels.GetWidth());
+    const float height = static_cast<float>(page.pixels.GetHeight());
+    image.region.textureRect = Dali::Vector4((image.x + 0.5f) / width,
+                                             (image.y + 0.5f) / height,
+                                             (image.x + image.region.width - 0.5f) / width,
+                                             (image.y + image.region.height - 0.5f) / height);
+  }
+
+  /**
+   * @brief Decodes the images and packs them into shelves, tallest first.
+   */
+  void Pack(std::vector<Page>& pages)
+  {
+    std::vector<Dali::Devel::PixelBuffer> pixels(mImages.size());
+    std::vector<size_t>                   order;
+    for(size_t i = 0u; i < mImages.size(); ++i)
+    {
+      Image& image = mImages[i];
+      image.packed = false;
+      pixels[i]    = Dali::LoadImageFromFile(image.path);
+      if(!pixels[i])
+      {
+        DALI_LOG_ERROR("Unable to add %s to the texture atlas\n", image.path.c_str());
+        continue;
+      }
+      image.region.width  = pixels[i].GetWidth();
+      image.region.height = pixels[i].GetHeight();
+      order.push_back(i);
+    }
+    std::stable_sort(order.begin(), order.end(), [this](size_t lhs, size_t rhs) { return mImages[lhs].region.height > mImages[rhs].region.height; });
+
+    // The pages being filled: a page only holds one pixel format, its shelves grow downwards.
+    struct Shelves
+    {
+      Dali::Pixel::Format format;
+      unsigned int        width{0u};       ///< The width used so far
+      unsigned int        shelfX{0u};      ///< Where the next image goes on the current shelf
+      unsigned int        shelfY{0u};      ///< The top of the current shelf
+      unsigned int        shelfHeight{0u}; ///< The height of the current shelf
+      std::vector<size_t> images;
+    };
+    std::vector<Shelves> layouts;
+
+    for(size_t index : order)
+    {
+      Image&                    image  = mImages[index];
+      const Dali::Pixel::Format format = pixels[index].GetPixelFormat();
+      const unsigned int        width  = image.region.width;
+      const unsigned int        height = image.region.height;
+
+      Shelves* layout = nullptr;
+      for(auto& candidate : layouts)
+      {
+        if(candidate.format != format)
+        {
+          continue;
+        }
+        if(candidate.shelfX + width <= mPageSize && candidate.shelfY + height <= mPageSize && height <= candidate.shelfHeight)
+        {
+          layout = &candidate;
+          break;
+        }
+        const unsigned int nextShelfY = candidate.shelfY + candidate.shelfHeight + mPadding;
+        if(width <= mPageSize && nextShelfY + height <= mPageSize)
+        {
+          candidate.shelfX      = 0u;
+          candidate.shelfY      = nextShelfY;
+          candidate.shelfHeight = height;
+          layout                = &candidate;
+          break;
+        }
+      }
+      if(!layout)
+      {
+        layouts.emplace_back();
+        layout              = &layouts.back();
+        layout->format      = format;
+        layout->shelfHeight = height;
+      }
+
+      image.x            = layout->shelfX;
+      image.y            = layout->shelfY;
+      image.region.page  = static_cast<unsigned int>(layout - layouts.data());
+      image.packed       = true;
+      layout->shelfX     = image.x + width + mPadding;
+      layout->width      = std::max(layout->width, image.x + width);
+      layout->images.push_back(index);
+    }
+
+    // Create each page at the size actually used and copy the images in.
+    for(auto& layout : layouts)
+    {
+      const unsigned int height        = layout.shelfY + layout.shelfHeight;
+      const unsigned int bytesPerPixel = Dali::Pixel::GetBytesPerPixel(layout.format);
+      const size_t       pageStride    = size_t(layout.width) * bytesPerPixel;
+
+      Page page;
+      page.pixels = Dali::Devel::PixelBuffer::New(layout.width, height, layout.format);
+      memset(page.pixels.GetBuffer(), 0, pageStride * height);
+
+      for(size_t index : layout.images)
+      {
+        Image&               image       = mImages[index];
+        const size_t         imageStride = size_t(image.region.width) * bytesPerPixel;
+        const unsigned char* source      = pixels[index].GetBuffer();
+        unsigned char*       destination = page.pixels.GetBuffer() + image.y * pageStride + image.x * bytesPerPixel;
+        for(unsigned int row = 0u; row < image.region.height; ++row)
+        {
+          memcpy(destination + row * pageStride, source + row * imageStride, imageStride);
+        }
+        SetTextureRect(image, page);
+      }
+      pages.push_back(std::move(page));
+    }
+  }
+
+  /**
+   * @brief Retrieves the path of the cache entry for the current images, empty if there is no cache directory.
+   */
+  std::string GetCachePath(const std::string& cacheName) const
+  {
+    static const std::string cacheDirectory = GetCacheDirectory("texture-atlas");
+    if(cacheDirectory.empty())
+    {
+      return cacheDirectory;
+    }
+
+    std::string key;
+    for(const auto& image : mImages)
+    {
+      key += image.path + '\n';
+    }
+
+    char suffix[32];
+    snprintf(suffix, sizeof(suffix), "-%zx.atlas", std::hash<std::string>()(key));
+    return cacheDirectory + cacheName + suffix;
+  }
+
+  /**
+   * @brief Loads the pages & regions from the cache, if it is valid for the current images.
+   */
+  bool LoadCache(const std::string& cachePath, std::vector<Page>& pages)
+  {
+    MemoryMappedFile file(cachePath);
+    if(!file || file.GetSize() < sizeof(AtlasCacheHeader))
+    {
+      return false;
+    }
+
+    AtlasCacheHeader header;
+    memcpy(&header, file.GetData(), sizeof(header));
+    if(header.tag != ATLAS_CACHE_TAG ||
+       header.version != ATLAS_CACHE_VERSION ||
+       header.pageSize != mPageSize ||
+       header.padding != mPadding ||
+       header.imageCount != mImages.size())
+    {
+      return false;
+    }
+
+    // Validate everything before touching the images, so a stale, truncated or foreign file changes nothing.
+    std::vector<AtlasCacheImage> cachedImages(header.imageCount);
+    size_t                       offset = sizeof(AtlasCacheHeader);
+    for(uint32_t i = 0u; i < header.imageCount; ++i)
+    {
+      AtlasCacheImage& cached             = cachedImages[i];
+      uint64_t         sourceSize         = 0u;
+      int64_t          sourceModifiedTime = 0;
+      if(offset + sizeof(AtlasCacheImage) > file.GetSize())
+      {
+        return false;
+      }
+      memcpy(&cached, file.GetData() + offset, sizeof(cached));
+      offset += sizeof(AtlasCacheImage);
+
+      const std::string& path = mImages[i].path;
+      if(cached.pathLength != path.size() ||
+         offset + AlignTo4(cached.pathLength) > file.GetSize() ||
+         path.compare(0, path.size(), file.GetData() + offset, cached.pathLength) != 0 ||
+         (!GetFileSizeAndTime(path, sourceSize, sourceModifiedTime) && cached.page != NOT_PACKED) ||
+         cached.sourceSize != sourceSize ||
+         cached.sourceModifiedTime != sourceModifiedTime ||
+         (cached.page != NOT_PACKED && cached.page >= header.pageCount))
+      {
+        return false;
+      }
+      offset += AlignTo4(cached.pathLength);
+    }
+
+    std::vector<AtlasCachePage> cachedPages(header.pageCount);
+    std::vector<size_t>         pixelOffsets(header.pageCount);
+    for(uint32_t i = 0u; i < header.pageCount; ++i)
+    {
+      AtlasCachePage& cached = cachedPages[i];
+      if(offset + sizeof(AtlasCachePage) > file.GetSize())
+      {
+        return false;
+      }
+      memcpy(&cached, file.GetData() + offset, sizeof(cached));
+      offset += sizeof(AtlasCachePage);
+
+      const uint64_t size = uint64_t(cached.width) * cached.height * Dali::Pixel::GetBytesPerPixel(static_cast<Dali::Pixel::Format>(cached.format));
+      if(size == 0u || size != cached.size || offset + AlignTo4(cached.size) > file.GetSize())
+      {
+        return false;
+      }
+      pixelOffsets[i] = offset;
+      offset += AlignTo4(cached.size);
+    }
+
+    for(uint32_t i = 0u; i < header.imageCount; ++i)
+    {
+      const AtlasCacheImage& cached = cachedImages[i];
+      if(cached.page != NOT_PACKED &&
+         (uint64_t(cached.x) + cached.width > cachedPages[cached.page].width || uint64_t(cached.y) + cached.height > cachedPages[cached.page].height))
+      {
+        return false;
+      }
+    }
+
+    for(uint32_t i = 0u; i < header.pageCount; ++i)
+    {
+      const AtlasCachePage& cached = cachedPages[i];
+      Page                  page;
+      page.pixels = Dali::Devel::PixelBuffer::New(cached.width, cached.height, static_cast<Dali::Pixel::Format>(cached.format));
+      memcpy(page.pixels.GetBuffer(), file.GetData() + pixelOffsets[i], cached.size);
+      pages.push_back(std::move(page));
+    }
+
+    for(uint32_t i = 0u; i < header.imageCount; ++i)
+    {
+      const AtlasCacheImage& cached = cachedImages[i];
+      Image&                 image  = mImages[i];
+      image.packed                  = cached.page != NOT_PACKED;
+      image.x                       = cached.x;
+      image.y                       = cached.y;
+      image.region.page             = image.packed ? cached.page : 0u;
+      image.region.width            = cached.width;
+      image.region.height           = cached.height;
+      if(image.packed)
+      {
+        SetTextureRect(image, pages[cached.page]);
+      }
+    }
+    return true;
+  }
+
+  /**
+   * @brief Writes the pages & regions to the cache.
+   */
+  bool StoreCache(const std::string& cachePath, const std::vector<Page>& pages) const
+  {
+    AtlasCacheHeader header;
+    header.tag        = ATLAS_CACHE_TAG;
+    header.version    = ATLAS_CACHE_VERSION;
+    header.pageSize   = mPageSize;
+    header.padding    = mPadding;
+    header.imageCount = static_cast<uint32_t>(mImages.size());
+    header.pageCount  = static_cast<uint32_t>(pages.size());
+
+    std::vector<AtlasCacheImage> cachedImages(mImages.size());
+    for(size_t i = 0u; i < mImages.size(); ++i)
+    {
+      const Image&     image  = mImages[i];
+      AtlasCacheImage& cached = cachedImages[i];
+      memset(&cached, 0, sizeof(cached));
+      if(!GetFileSizeAndTime(image.path, cached.sourceSize, cached.sourceModifiedTime) && image.packed)
+      {
+        return false;
+      }
+      cached.pathLength = static_cast<uint32_t>(image.path.size());
+      cached.page       = image.packed ? image.region.page : NOT_PACKED;
+      cached.x          = image.x;
+      cached.y          = image.y;
+      cached.width      = image.region.width;
+      cached.height     = image.region.height;
+    }
+
+    return WriteFileAtomically(cachePath, [&](FILE* file) {
+      const char padding[4] = {0, 0, 0, 0};
+      bool       written    = fwrite(&header, sizeof(header), 1, file) == 1;
+      for(size_t i = 0u; written && i < mImages.size(); ++i)
+      {
+        const std::string& path        = mImages[i].path;
+        const size_t       pathPadding = AlignTo4(cachedImages[i].pathLength) - cachedImages[i].pathLength;
+        written                        = fwrite(&cachedImages[i], sizeof(AtlasCacheImage), 1, file) == 1 &&
+                  fwrite(path.data(), 1, path.size(), file) == path.size() &&
+                  fwrite(padding, 1, pathPadding, file) == pathPadding;
+      }
+      for(size_t i = 0u; written && i < pages.size(); ++i)
+      {
+        const Dali::Devel::PixelBuffer& pixels = pages[i].pixels;
+        AtlasCachePage                  cached;
+        cached.format                    = static_cast<uint32_t>(pixels.GetPixelFormat());
+        cached.width                     = pixels.GetWidth();
+        cached.height                    = pixels.GetHeight();
+        cached.size                      = cached.width * cached.height * Dali::Pixel::GetBytesPerPixel(pixels.GetPixelFormat());
+        const size_t pixelPadding        = AlignTo4(cached.size) - cached.size;
+        written                          = fwrite(&cached, sizeof(cached), 1, file) == 1 &&
+                  fwrite(const_cast<Dali::Devel::PixelBuffer&>(pixels).GetBuffer(), 1, cached.size, file) == cached.size &&
+                  fwrite(padding, 1, pixelPadding, file) == pixelPadding;
+      }
+      return written;
+    });
+  }
+
+private:
+  std::vector<Image>         mImages;            ///< The images, in the order they were added.
+  std::vector<Dali::Texture> mTextures;          ///< The uploaded pages.
+  unsigned int               mPageSize;          ///< The maximum width & height of a page.
+  unsigned int               mPadding;           ///< The pixels left between images.
+  bool                       mIsFromCache{false}; ///< Whether the last Build() used the cache.
+};
+
+} // namespace DemoHelper
+
+#endif // DALI_DEMO_TEXTURE_ATLAS_H
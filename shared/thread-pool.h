@@ -0,0 +1,168 @@
+#ifndef DALI_DEMO_THREAD_POOL_H
+#define DALI_DEMO_THREAD_POOL_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace DemoHelper
+{
+/**
+ * @brief A fixed set of worker threads which run submitted tasks in submission order.
+ *
+ * Tasks must not touch DALi handles: those may only be used on the event thread, so results have to
+ * be handed back (e.g. through the returned futures or an EventThreadCallback) and applied there.
+ */
+class ThreadPool
+{
+public:
+  /**
+   * @brief Creates the pool and starts its threads.
+   * @param[in]  threadCount  The number of worker threads, at least one is always created.
+   */
+  explicit ThreadPool(unsigned int threadCount = std::thread::hardware_concurrency())
+  {
+    threadCount = std::max(threadCount, 1u);
+    for(unsigned int i = 0u; i < threadCount; ++i)
+    {
+      mThreads.emplace_back(&ThreadPool::Run, this);
+    }
+  }
+
+  /**
+   * @brief Finishes the queued tasks and joins the threads.
+   */
+  ~ThreadPool()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mMutex);
+      mStopping = true;
+    }
+    mCondition.notify_all();
+
+    for(auto& thread : mThreads)
+    {
+      thread.join();
+    }
+  }
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  /**
+   * @brief Retrieves the number of worker threads.
+   */
+  unsigned int GetThreadCount() const
+  {
+    return static_cast<unsigned int>(mThreads.size());
+  }
+
+  /**
+   * @brief Queues a task to run on one of the worker threads.
+   * @param[in]  task  A callable taking no arguments.
+   * @return A future for the task's result; it rethrows any exception the task threw.
+   */
+  template<typename Task>
+  auto Submit(Task task) -> std::future<decltype(task())>
+  {
+    using Result = decltype(task());
+
+    auto packagedTask = std::make_shared<std::packaged_task<Result()>>(std::move(task));
+    auto future       = packagedTask->get_future();
+    {
+      std::lock_guard<std::mutex> lock(mMutex);
+      mTasks.emplace_back([packagedTask]() { (*packagedTask)(); });
+    }
+    mCondition.notify_one();
+    return future;
+  }
+
+  /**
+   * @brief Splits [ 0, count ) into contiguous ranges and processes them in parallel, returning once all are done.
+   *
+   * The first range is processed on the calling thread, the rest on the worker threads.
+   *
+   * @param[in]  count       The number of items.
+   * @param[in]  rangeCount  The number of ranges to split the items into, e.g. the number of threads to use.
+   * @param[in]  function    Called as function(begin, end, rangeIndex) for each range.
+   */
+  template<typename Function>
+  void ParallelFor(size_t count, unsigned int rangeCount, Function function)
+  {
+    rangeCount = static_cast<unsigned int>(std::max<size_t>(1u, std::min<size_t>(rangeCount, count)));
+
+    std::vector<std::future<void>> futures;
+    futures.reserve(rangeCount - 1u);
+    for(unsigned int range = 1u; range < rangeCount; ++range)
+    {
+      const size_t begin = count * range / rangeCount;
+      const size_t end   = count * (range + 1u) / rangeCount;
+      futures.push_back(Submit([&function, begin, end, range]() { function(begin, end, range); }));
+    }
+
+    function(0u, count / rangeCount, 0u);
+
+    for(auto& future : futures)
+    {
+      future.get();
+    }
+  }
+
+private:
+  /**
+   * @brief The main loop of the worker threads.
+   */
+  void Run()
+  {
+    for(;;)
+    {
+      std::function<void()> task;
+      {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mCondition.wait(lock, [this]() { return mStopping || !mTasks.empty(); });
+        if(mTasks.empty())
+        {
+          return; // Stopping, and nothing left to do.
+        }
+        task = std::move(mTasks.front());
+        mTasks.pop_front();
+      }
+      task();
+    }
+  }
+
+private:
+  std::vector<std::thread>          mThreads;          ///< The worker threads.
+  std::deque<std::function<void()>> mTasks;            ///< The queued tasks.
+  std::mutex                        mMutex;            ///< Guards mTasks & mStopping.
+  std::condition_variable           mCondition;        ///< Signalled when a task is queued or the pool is stopping.
+  bool                              mStopping{false};  ///< Set when the pool is being destroyed.
+};
+
+} // namespace DemoHelper
+
+#endif // DALI_DEMO_THREAD_POOL_H
@@ -0,0 +1,362 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// FILE HEADER
+#include "etc2-encoder.h"
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace TextureBaker
+{
+namespace
+{
+const uint32_t BLOCK_PIXELS(16u);
+
+// The intensity modifiers of the individual & differential modes, in the order of the pixel index values.
+const int ETC_MODIFIERS[8][4] =
+  {
+    {2, 8, -2, -8},
+    {5, 17, -5, -17},
+    {9, 29, -9, -29},
+    {13, 42, -13, -42},
+    {18, 60, -18, -60},
+    {24, 80, -24, -80},
+    {33, 106, -33, -106},
+    {47, 183, -47, -183}};
+
+// The EAC modifiers, scaled by the block's multiplier.
+const int EAC_MODIFIERS[16][8] =
+  {
+    {-3, -6, -9, -15, 2, 5, 8, 14},
+    {-3, -7, -10, -13, 2, 6, 9, 12},
+    {-2, -5, -8, -13, 1, 4, 7, 12},
+    {-2, -4, -6, -13, 1, 3, 5, 12},
+    {-3, -6, -8, -12, 2, 5, 7, 11},
+    {-3, -7, -9, -11, 2, 6, 8, 10},
+    {-4, -7, -8, -11, 3, 6, 7, 10},
+    {-3, -5, -8, -11, 2, 4, 7, 10},
+    {-2, -6, -8, -10, 1, 5, 7, 9},
+    {-2, -5, -8, -10, 1, 4, 7, 9},
+    {-2, -4, -8, -10, 1, 3, 7, 9},
+    {-2, -5, -7, -10, 1, 4, 6, 9},
+    {-3, -4, -7, -10, 2, 3, 6, 9},
+    {-1, -2, -3, -10, 0, 1, 2, 9},
+    {-4, -6, -8, -9, 3, 5, 7, 8},
+    {-3, -5, -7, -9, 2, 4, 6, 8}};
+
+const uint32_t EAC_ZERO_TABLE(13u); ///< The only EAC table with a zero modifier
+const uint32_t EAC_ZERO_INDEX(4u);  ///< The index of its zero modifier
+
+inline int Clamp255(int value)
+{
+  return std::min(std::max(value, 0), 255);
+}
+
+/**
+ * The best way to encode one half of a block with a given base colour.
+ */
+struct SubBlockEncoding
+{
+  uint32_t error{std::numeric_limits<uint32_t>::max()};
+  uint32_t table{0u};
+  uint32_t indices[BLOCK_PIXELS]{}; ///< The pixel index values, by position in the block (x * 4 + y)
+};
+
+/**
+ * Whether the pixel at position x * 4 + y is in the second half of the block.
+ */
+inline bool InSecondHalf(uint32_t position, bool flip)
+{
+  return flip ? (position % 4u) >= 2u : (position / 4u) >= 2u;
+}
+
+/**
+ * Finds the table & pixel indices which best encode one half of the block with the given base colour.
+ */
+SubBlockEncoding EncodeSubBlock(const uint8_t* pixels, bool flip, bool secondHalf, const int base[3])
+{
+  SubBlockEncoding best;
+  for(uint32_t table = 0u; table < 8u; ++table)
+  {
+    SubBlockEncoding candidate;
+    candidate.error = 0u;
+    candidate.table = table;
+    for(uint32_t position = 0u; position < BLOCK_PIXELS && candidate.error < best.error; ++position)
+    {
+      if(InSecondHalf(position, flip) != secondHalf)
+      {
+        continue;
+      }
+
+      const uint8_t* pixel     = pixels + ((position % 4u) * 4u + position / 4u) * 4u;
+      uint32_t       bestError = std::numeric_limits<uint32_t>::max();
+      for(uint32_t index = 0u; index < 4u; ++index)
+      {
+        uint32_t error = 0u;
+        for(uint32_t channel = 0u; channel < 3u; ++channel)
+        {
+          const int difference = Clamp255(base[channel] + ETC_MODIFIERS[table][index]) - pixel[channel];
+          error += difference * difference;
+        }
+        if(error < bestError)
+        {
+          bestError                   = error;
+          candidate.indices[position] = index;
+        }
+      }
+      candidate.error += bestError;
+    }
+
+    if(candidate.error < best.error)
+    {
+      best = candidate;
+    }
+  }
+  return best;
+}
+
+/**
+ * Averages the colour of one half of the block.
+ */
+void AverageSubBlock(const uint8_t* pixels, bool flip, bool secondHalf, float average[3])
+{
+  average[0] = average[1] = average[2] = 0.0f;
+  for(uint32_t position = 0u; position < BLOCK_PIXELS; ++position)
+  {
+    if(InSecondHalf(position, flip) == secondHalf)
+    {
+      const uint8_t* pixel = pixels + ((position % 4u) * 4u + position / 4u) * 4u;
+      for(uint32_t channel = 0u; channel < 3u; ++channel)
+      {
+        average[channel] += pixel[channel] / 8.0f;
+      }
+    }
+  }
+}
+
+inline int Quantize(float value, int maximum)
+{
+  return std::min(std::max(static_cast<int>(std::lround(value * maximum / 255.0f)), 0), maximum);
+}
+
+inline int Expand4(int value)
+{
+  return (value << 4) | value;
+}
+
+inline int Expand5(int value)
+{
+  return (value << 3) | (value >> 2);
+}
+
+void WriteBigEndian(uint64_t bits, uint8_t* block)
+{
+  for(uint32_t i = 0u; i < 8u; ++i)
+  {
+    block[i] = static_cast<uint8_t>(bits >> (56u - i * 8u));
+  }
+}
+
+} // namespace
+
+void EncodeEtc2RgbBlock(const uint8_t* pixels, uint8_t* block)
+{
+  uint64_t bestBits  = 0u;
+  uint32_t bestError = std::numeric_limits<uint32_t>::max();
+
+  for(uint32_t flip = 0u; flip < 2u; ++flip)
+  {
+    float average[2][3];
+    AverageSubBlock(pixels, flip, false, average[0]);
+    AverageSubBlock(pixels, flip, true, average[1]);
+
+    for(uint32_t differential = 0u; differential < 2u; ++differential)
+    {
+      int quantized[2][3];
+      int base[2][3];
+      for(uint32_t channel = 0u; channel < 3u; ++channel)
+      {
+        if(differential)
+        {
+          // The second colour is stored as a 3 bit signed difference from the first, which keeps it in range.
+          quantized[0][channel] = Quantize(average[0][channel], 31);
+          quantized[1][channel] = quantized[0][channel] + std::min(std::max(Quantize(average[1][channel], 31) - quantized[0][channel], -4), 3);
+          quantized[1][channel] = std::min(std::max(quantized[1][channel], 0), 31);
+          base[0][channel]      = Expand5(quantized[0][channel]);
+          base[1][channel]      = Expand5(quantized[1][channel]);
+        }
+        else
+        {
+          quantized[0][channel] = Quantize(average[0][channel], 15);
+          quantized[1][channel] = Quantize(average[1][channel], 15);
+          base[0][channel]      = Expand4(quantized[0][channel]);
+          base[1][channel]      = Expand4(quantized[1][channel]);
+        }
+      }
+
+      const SubBlockEncoding first  = EncodeSubBlock(pixels, flip, false, base[0]);
+      const SubBlockEncoding second = EncodeSubBlock(pixels, flip, true, base[1]);
+      const uint32_t         error  = first.error + second.error;
+      if(error >= bestError)
+      {
+        continue;
+      }
+      bestError = error;
+
+      uint64_t bits = 0u;
+      for(uint32_t channel = 0u; channel < 3u; ++channel)
+      {
+        const uint32_t shift = 56u - channel * 8u;
+        if(differential)
+        {
+          const int delta = quantized[1][channel] - quantized[0][channel];
+          bits |= uint64_t(quantized[0][channel]) << (shift + 3u);
+          bits |= uint64_t(delta & 7) << shift;
+        }
+        else
+        {
+          bits |= uint64_t(quantized[0][channel]) << (shift + 4u);
+          bits |= uint64_t(quantized[1][channel]) << shift;
+        }
+      }
+      bits |= uint64_t(first.table) << 37u;
+      bits |= uint64_t(second.table) << 34u;
+      bits |= uint64_t(differential) << 33u;
+      bits |= uint64_t(flip) << 32u;
+
+      for(uint32_t position = 0u; position < BLOCK_PIXELS; ++position)
+      {
+        const uint32_t index = InSecondHalf(position, flip) ? second.indices[position] : first.indices[position];
+        bits |= uint64_t(index >> 1u) << (16u + position);
+        bits |= uint64_t(index & 1u) << position;
+      }
+      bestBits = bits;
+    }
+  }
+
+  WriteBigEndian(bestBits, block);
+}
+
+void EncodeEacAlphaBlock(const uint8_t* pixels, uint8_t* block)
+{
+  int minimum = 255;
+  int maximum = 0;
+  for(uint32_t i = 0u; i < BLOCK_PIXELS; ++i)
+  {
+    minimum = std::min(minimum, int(pixels[i * 4u + 3u]));
+    maximum = std::max(maximum, int(pixels[i * 4u + 3u]));
+  }
+
+  uint64_t bestBits = 0u;
+  if(minimum == maximum)
+  {
+    // A constant alpha, e.g. opaque: the zero modifier reproduces it exactly.
+    bestBits = (uint64_t(minimum) << 56u) | (uint64_t(1u) << 52u) | (uint64_t(EAC_ZERO_TABLE) << 48u);
+    for(uint32_t position = 0u; position < BLOCK_PIXELS; ++position)
+    {
+      bestBits |= uint64_t(EAC_ZERO_INDEX) << (45u - position * 3u);
+    }
+    WriteBigEndian(bestBits, block);
+    return;
+  }
+
+  uint32_t bestError = std::numeric_limits<uint32_t>::max();
+  for(uint32_t table = 0u; table < 16u && bestError > 0u; ++table)
+  {
+    const int tableMinimum = EAC_MODIFIERS[table][3];
+    const int tableMaximum = EAC_MODIFIERS[table][7];
+
+    // Search around the multiplier & base which map the table's range onto the block's.
+    const int idealMultiplier = static_cast<int>(std::lround(float(maximum - minimum) / (tableMaximum - tableMinimum)));
+    for(int multiplier = std::max(idealMultiplier - 1, 1); multiplier <= std::min(idealMultiplier + 1, 15); ++multiplier)
+    {
+      const int idealBase = minimum - tableMinimum * multiplier;
+      for(int base = std::max(idealBase - 2, 0); base <= std::min(idealBase + 2, 255); ++base)
+      {
+        uint32_t error   = 0u;
+        uint64_t indices = 0u;
+        for(uint32_t position = 0u; position < BLOCK_PIXELS && error < bestError; ++position)
+        {
+          const int alpha        = pixels[((position % 4u) * 4u + position / 4u) * 4u + 3u];
+          uint32_t  bestDistance = std::numeric_limits<uint32_t>::max();
+          uint32_t  bestIndex    = 0u;
+          for(uint32_t index = 0u; index < 8u; ++index)
+          {
+            const int      difference = Clamp255(base + EAC_MODIFIERS[table][index] * multiplier) - alpha;
+            const uint32_t distance   = difference * difference;
+            if(distance < bestDistance)
+            {
+              bestDistance = distance;
+              bestIndex    = index;
+            }
+          }
+          error += bestDistance;
+          indices |= uint64_t(bestIndex) << (45u - position * 3u);
+        }
+
+        if(error < bestError)
+        {
+          bestError = error;
+          bestBits  = (uint64_t(base) << 56u) | (uint64_t(multiplier) << 52u) | (uint64_t(table) << 48u) | indices;
+        }
+      }
+    }
+  }
+
+  WriteBigEndian(bestBits, block);
+}
+
+void EncodeEtc2Image(const std::vector<uint8_t>& rgba, uint32_t width, uint32_t height, bool withAlpha, std::vector<uint8_t>& output)
+{
+  const uint32_t blocksWide = (width + ETC2_BLOCK_SIZE - 1u) / ETC2_BLOCK_SIZE;
+  const uint32_t blocksHigh = (height + ETC2_BLOCK_SIZE - 1u) / ETC2_BLOCK_SIZE;
+  const uint32_t blockBytes = withAlpha ? ETC2_RGBA_BLOCK_BYTES : ETC2_RGB_BLOCK_BYTES;
+  output.resize(size_t(blocksWide) * blocksHigh * blockBytes);
+
+  uint8_t  pixels[BLOCK_PIXELS * 4u];
+  uint8_t* block = output.data();
+  for(uint32_t blockY = 0u; blockY < blocksHigh; ++blockY)
+  {
+    for(uint32_t blockX = 0u; blockX < blocksWide; ++blockX, block += blockBytes)
+    {
+      for(uint32_t y = 0u; y < ETC2_BLOCK_SIZE; ++y)
+      {
+        const uint32_t sourceY = std::min(blockY * ETC2_BLOCK_SIZE + y, height - 1u);
+        for(uint32_t x = 0u; x < ETC2_BLOCK_SIZE; ++x)
+        {
+          const uint32_t sourceX = std::min(blockX * ETC2_BLOCK_SIZE + x, width - 1u);
+          std::copy_n(&rgba[(size_t(sourceY) * width + sourceX) * 4u], 4u, &pixels[(y * ETC2_BLOCK_SIZE + x) * 4u]);
+        }
+      }
+
+      if(withAlpha)
+      {
+        EncodeEacAlphaBlock(pixels, block);
+        EncodeEtc2RgbBlock(pixels, block + ETC2_RGB_BLOCK_BYTES);
+      }
+      else
+      {
+        EncodeEtc2RgbBlock(pixels, block);
+      }
+    }
+  }
+}
+
+} // namespace TextureBaker
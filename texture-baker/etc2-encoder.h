@@ -0,0 +1,64 @@
+#ifndef DALI_DEMO_TEXTURE_BAKER_ETC2_ENCODER_H
+#define DALI_DEMO_TEXTURE_BAKER_ETC2_ENCODER_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+#include <vector>
+
+namespace TextureBaker
+{
+const uint32_t ETC2_BLOCK_SIZE(4u);        ///< The width & height of a block in pixels
+const uint32_t ETC2_RGB_BLOCK_BYTES(8u);   ///< The size of an ETC2 RGB8 block
+const uint32_t ETC2_RGBA_BLOCK_BYTES(16u); ///< The size of an ETC2 RGBA8 (EAC alpha followed by RGB) block
+
+/**
+ * @brief Encodes a 4x4 block of pixels as ETC2 RGB8.
+ *
+ * Only the individual & differential modes, which ETC2 shares with ETC1, are searched: they cover
+ * photographic content well and keep the encoder quick enough to run at build time.
+ *
+ * @param[in] pixels The 16 RGBA pixels of the block, row by row.
+ * @param[out] block The 8 bytes of the encoded block.
+ */
+void EncodeEtc2RgbBlock(const uint8_t* pixels, uint8_t* block);
+
+/**
+ * @brief Encodes the alpha of a 4x4 block of pixels as EAC, the first half of an ETC2 RGBA8 block.
+ * @param[in] pixels The 16 RGBA pixels of the block, row by row.
+ * @param[out] block The 8 bytes of the encoded block.
+ */
+void EncodeEacAlphaBlock(const uint8_t* pixels, uint8_t* block);
+
+/**
+ * @brief Encodes an RGBA image as ETC2 RGB8, or ETC2 RGBA8 if @p withAlpha.
+ *
+ * Images whose size is not a multiple of 4 are padded by repeating their last row & column.
+ *
+ * @param[in] rgba The RGBA pixels of the image, row by row.
+ * @param[in] width The width of the image.
+ * @param[in] height The height of the image.
+ * @param[in] withAlpha Whether the alpha is encoded too.
+ * @param[out] output The encoded blocks, row by row.
+ */
+void EncodeEtc2Image(const std::vector<uint8_t>& rgba, uint32_t width, uint32_t height, bool withAlpha, std::vector<uint8_t>& output);
+
+} // namespace TextureBaker
+
+#endif // DALI_DEMO_TEXTURE_BAKER_ETC2_ENCODER_H
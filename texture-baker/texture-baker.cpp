@@ -0,0 +1,264 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/**
+ * Bakes images into mipmapped, ETC2 compressed KTX files, so the examples can upload them as they are
+ * instead of decoding the images at startup (see shared/baked-texture.h):
+ *
+ *   texture-baker [--report] <image> <output.ktx> [<image> <output.ktx>...]
+ *
+ * With --report, a CSV line comparing the decoded image with the baked file is printed for each image.
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/image-loading.h>
+#include <dali/devel-api/adaptor-framework/pixel-buffer.h>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include "etc2-encoder.h"
+#include "shared/baked-texture.h"
+#include "shared/memory-mapped-file.h"
+
+using namespace Dali;
+
+namespace
+{
+/**
+ * Converts the decoded pixels to RGBA, which is what the encoder takes.
+ */
+bool ConvertToRgba(Devel::PixelBuffer& pixelBuffer, std::vector<uint8_t>& rgba)
+{
+  const size_t   pixelCount = size_t(pixelBuffer.GetWidth()) * pixelBuffer.GetHeight();
+  const uint8_t* source     = pixelBuffer.GetBuffer();
+  rgba.resize(pixelCount * 4u);
+  for(size_t i = 0u; i < pixelCount; ++i)
+  {
+    uint8_t* pixel = &rgba[i * 4u];
+    switch(pixelBuffer.GetPixelFormat())
+    {
+      case Pixel::L8:
+      {
+        pixel[0] = pixel[1] = pixel[2] = source[i];
+        pixel[3]                       = 255u;
+        break;
+      }
+      case Pixel::LA88:
+      {
+        pixel[0] = pixel[1] = pixel[2] = source[i * 2u];
+        pixel[3]                       = source[i * 2u + 1u];
+        break;
+      }
+      case Pixel::RGB888:
+      {
+        memcpy(pixel, source + i * 3u, 3u);
+        pixel[3] = 255u;
+        break;
+      }
+      case Pixel::RGB8888:
+      {
+        memcpy(pixel, source + i * 4u, 3u);
+        pixel[3] = 255u;
+        break;
+      }
+      case Pixel::RGBA8888:
+      {
+        memcpy(pixel, source + i * 4u, 4u);
+        break;
+      }
+      default:
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+/**
+ * Halves the size of an image with a box filter, for the next level of the mipmap chain.
+ */
+void Downsample(const std::vector<uint8_t>& source, uint32_t width, uint32_t height, std::vector<uint8_t>& destination)
+{
+  const uint32_t halfWidth  = std::max(width / 2u, 1u);
+  const uint32_t halfHeight = std::max(height / 2u, 1u);
+  destination.resize(size_t(halfWidth) * halfHeight * 4u);
+  for(uint32_t y = 0u; y < halfHeight; ++y)
+  {
+    const uint32_t y0 = std::min(y * 2u, height - 1u);
+    const uint32_t y1 = std::min(y * 2u + 1u, height - 1u);
+    for(uint32_t x = 0u; x < halfWidth; ++x)
+    {
+      const uint32_t x0 = std::min(x * 2u, width - 1u);
+      const uint32_t x1 = std::min(x * 2u + 1u, width - 1u);
+      for(uint32_t channel = 0u; channel < 4u; ++channel)
+      {
+        const uint32_t sum = source[(size_t(y0) * width + x0) * 4u + channel] +
+                             source[(size_t(y0) * width + x1) * 4u + channel] +
+                             source[(size_t(y1) * width + x0) * 4u + channel] +
+                             source[(size_t(y1) * width + x1) * 4u + channel];
+        destination[(size_t(y) * halfWidth + x) * 4u + channel] = static_cast<uint8_t>((sum + 2u) / 4u);
+      }
+    }
+  }
+}
+
+/**
+ * Encodes the image and its mipmaps, down to 1x1, and writes them to a KTX file.
+ * @return The size of the file, 0 if it could not be written.
+ */
+size_t WriteBakedImage(std::vector<uint8_t> rgba, uint32_t width, uint32_t height, const std::string& path)
+{
+  bool withAlpha = false;
+  for(size_t i = 3u; i < rgba.size() && !withAlpha; i += 4u)
+  {
+    withAlpha = rgba[i] != 255u;
+  }
+
+  DemoHelper::BakedKtxHeader header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.identifier, DemoHelper::BAKED_KTX_IDENTIFIER, sizeof(header.identifier));
+  header.endianness           = DemoHelper::BAKED_KTX_ENDIANNESS;
+  header.glTypeSize           = 1u; // Compressed, so glType & glFormat are 0
+  header.glInternalFormat     = withAlpha ? DemoHelper::BAKED_FORMAT_RGBA8_ETC2_EAC : DemoHelper::BAKED_FORMAT_RGB8_ETC2;
+  header.glBaseInternalFormat = withAlpha ? 0x1908u : 0x1907u; // GL_RGBA : GL_RGB
+  header.pixelWidth           = width;
+  header.pixelHeight          = height;
+  header.numberOfFaces        = 1u;
+  header.numberOfMipmapLevels = 1u;
+  for(uint32_t size = std::max(width, height); size > 1u; size /= 2u)
+  {
+    ++header.numberOfMipmapLevels;
+  }
+
+  FILE* file = fopen(path.c_str(), "wb");
+  if(!file)
+  {
+    return 0u;
+  }
+
+  bool                 written = fwrite(&header, sizeof(header), 1u, file) == 1u;
+  size_t               size    = sizeof(header);
+  std::vector<uint8_t> level;
+  std::vector<uint8_t> encoded;
+  for(uint32_t mipmap = 0u; mipmap < header.numberOfMipmapLevels && written; ++mipmap)
+  {
+    TextureBaker::EncodeEtc2Image(rgba, width, height, withAlpha, encoded);
+
+    // The blocks are 8 or 16 bytes, so no padding is needed after them.
+    const uint32_t imageSize = encoded.size();
+    written                  = fwrite(&imageSize, sizeof(imageSize), 1u, file) == 1u;
+    written                  = written && fwrite(encoded.data(), encoded.size(), 1u, file) == 1u;
+    size += sizeof(imageSize) + encoded.size();
+
+    Downsample(rgba, width, height, level);
+    rgba.swap(level);
+    width  = std::max(width / 2u, 1u);
+    height = std::max(height / 2u, 1u);
+  }
+
+  written = fclose(file) == 0 && written;
+  if(!written)
+  {
+    remove(path.c_str());
+  }
+  return written ? size : 0u;
+}
+
+double MillisecondsSince(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  bool report = false;
+  int  first  = 1;
+  if(argc > 1 && strcmp(argv[1], "--report") == 0)
+  {
+    report = true;
+    ++first;
+  }
+
+  if(argc <= first || (argc - first) % 2 != 0)
+  {
+    fprintf(stderr, "Usage: %s [--report] <image> <output.ktx> [<image> <output.ktx>...]\n", argv[0]);
+    return 1;
+  }
+
+  if(report)
+  {
+    // The decoded image is what the examples upload without mipmaps; the baked file includes them.
+    printf("image,width,height,sourceBytes,decodeMs,decodedGpuBytes,bakedBytes,bakedLoadMs\n");
+  }
+
+  int result = 0;
+  for(int i = first; i + 1 < argc; i += 2)
+  {
+    const std::string image(argv[i]);
+    const std::string output(argv[i + 1]);
+
+    const auto         decodeStart = std::chrono::steady_clock::now();
+    Devel::PixelBuffer pixelBuffer = LoadImageFromFile(image);
+    const double       decodeMs    = MillisecondsSince(decodeStart);
+
+    std::vector<uint8_t> rgba;
+    if(!pixelBuffer || !ConvertToRgba(pixelBuffer, rgba))
+    {
+      fprintf(stderr, "%s: unable to decode %s\n", argv[0], image.c_str());
+      result = 1;
+      continue;
+    }
+
+    const uint32_t width     = pixelBuffer.GetWidth();
+    const uint32_t height    = pixelBuffer.GetHeight();
+    const size_t   bakedSize = WriteBakedImage(rgba, width, height, output);
+    if(bakedSize == 0u)
+    {
+      fprintf(stderr, "%s: unable to write %s\n", argv[0], output.c_str());
+      result = 1;
+      continue;
+    }
+
+    if(report)
+    {
+      // Time what loading the baked file costs at runtime: mapping it and copying each level for upload.
+      const auto     loadStart = std::chrono::steady_clock::now();
+      const uint32_t levels    = DemoHelper::ForEachBakedMipmap(output, [](PixelData, uint32_t, size_t) {});
+      const double   loadMs    = MillisecondsSince(loadStart);
+
+      DemoHelper::MemoryMappedFile source(image);
+      printf("%s,%u,%u,%zu,%.2f,%zu,%zu,%.2f\n",
+             image.substr(image.find_last_of("/\\") + 1u).c_str(),
+             width,
+             height,
+             source.GetSize(),
+             decodeMs,
+             size_t(width) * height * Pixel::GetBytesPerPixel(pixelBuffer.GetPixelFormat()),
+             bakedSize,
+             levels ? loadMs : -1.0);
+    }
+  }
+
+  return result;
+}